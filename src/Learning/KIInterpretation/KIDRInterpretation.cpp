@@ -609,7 +609,7 @@ KIDRClassifierInterpreter::KIDRClassifierInterpreter()
 	SetStructureName("ClassifierInterpreter");
 
 	// Initialisation des resultats de compilation
-	bIsRankedContributionComputed = false;
+	nRequestedContributionNumber = 0;
 }
 
 KIDRClassifierInterpreter::~KIDRClassifierInterpreter()
@@ -692,7 +692,7 @@ Object* KIDRClassifierInterpreter::ComputeStructureResult(const KWObject* kwoObj
 	KIDRClassifierService::ComputeStructureResult(kwoObject);
 
 	// On indique que les contributions sont a recalculer si necessaire
-	bIsRankedContributionComputed = false;
+	ivTargetValueRankedContributionNumbers.Initialize();
 	return (Object*)this;
 }
 
@@ -721,8 +721,8 @@ Symbol KIDRClassifierInterpreter::GetRankedContributionAttributeAt(int nTargetVa
 	require(0 <= nContributionRank and nContributionRank < GetPredictorAttributeNumber());
 
 	// Calcul des contributions pour des acces par rang
-	if (not bIsRankedContributionComputed)
-		ComputeRankedContributions();
+	if (nContributionRank >= ivTargetValueRankedContributionNumbers.GetAt(nTargetValueRank))
+		ComputeTargetRankedContributions(nTargetValueRank, nContributionRank + 1);
 
 	// On renvoie le nom de l'attribut correspondant
 	return GetRankedContributionAt(nTargetValueRank, nContributionRank)->GetAttributeName();
@@ -741,8 +741,8 @@ Symbol KIDRClassifierInterpreter::GetRankedContributionPartAt(int nTargetValueRa
 	require(0 <= nContributionRank and nContributionRank < GetPredictorAttributeNumber());
 
 	// Calcul des contributions pour des acces par rang
-	if (not bIsRankedContributionComputed)
-		ComputeRankedContributions();
+	if (nContributionRank >= ivTargetValueRankedContributionNumbers.GetAt(nTargetValueRank))
+		ComputeTargetRankedContributions(nTargetValueRank, nContributionRank + 1);
 
 	// Acces a l'attribut, la grille corespondant, et l'index source dans la grille
 	nAttributeIndex = GetRankedContributionAt(nTargetValueRank, nContributionRank)->GetAttributeIndex();
@@ -761,8 +761,8 @@ Continuous KIDRClassifierInterpreter::GetRankedContributionValueAt(int nTargetVa
 	require(0 <= nContributionRank and nContributionRank < GetPredictorAttributeNumber());
 
 	// Calcul des contributions pour des acces par rang
-	if (not bIsRankedContributionComputed)
-		ComputeRankedContributions();
+	if (nContributionRank >= ivTargetValueRankedContributionNumbers.GetAt(nTargetValueRank))
+		ComputeTargetRankedContributions(nTargetValueRank, nContributionRank + 1);
 
 	// On renvoie la valeur de contribution correspondante
 	return GetRankedContributionAt(nTargetValueRank, nContributionRank)->GetContribution();
@@ -790,6 +790,7 @@ longint KIDRClassifierInterpreter::GetUsedMemory() const
 	lUsedMemory = KIDRClassifierService::GetUsedMemory();
 	lUsedMemory += sizeof(KIDRClassifierInterpreter) - sizeof(KIDRClassifierService);
 	lUsedMemory += oaPredictorAttributeShapleyTables.GetOverallUsedMemory() - sizeof(ObjectArray);
+	lUsedMemory += ivTargetValueRankedContributionNumbers.GetUsedMemory() - sizeof(IntVector);
 	lUsedMemory += oaTargetValueRankedAttributeContributions.GetSize() *
 		       (sizeof(ObjectArray) + svPredictorAttributeNames.GetSize() *
 						  (sizeof(KIAttributeContribution*) + sizeof(KIAttributeContribution)));
@@ -813,7 +814,7 @@ void KIDRClassifierInterpreter::Clean()
 		oaRankedAttributeContributions->DeleteAll();
 	}
 	oaTargetValueRankedAttributeContributions.DeleteAll();
-	bIsRankedContributionComputed = false;
+	ivTargetValueRankedContributionNumbers.SetSize(0);
 }
 
 void KIDRClassifierInterpreter::CreateRankedContributionStructures(int nTargetValueNumber, int nAttributeNumber,
@@ -850,15 +851,20 @@ void KIDRClassifierInterpreter::CreateRankedContributionStructures(int nTargetVa
 			oaRankedAttributeContributions->SetAt(nAttribute, attributeContribution);
 		}
 	}
+
+	// Aucune contribution n'est calculee initialement
+	ivTargetValueRankedContributionNumbers.SetSize(nTargetValueNumber);
 }
 
-void KIDRClassifierInterpreter::ComputeRankedContributions() const
+void KIDRClassifierInterpreter::ComputeTargetRankedContributions(int nTarget, int nRankNumber) const
 {
 	const boolean bTrace = false;
 	ObjectArray* oaRankedAttributeContributions;
 	KIAttributeContribution* attributeContribution;
-	int nTarget;
+	Object* oInsertedContribution;
+	Object* oRankContribution;
 	int nAttribute;
+	int nRank;
 	int nSourceCellIndex;
 	Continuous cShapleyValue;
 
@@ -866,59 +872,87 @@ void KIDRClassifierInterpreter::ComputeRankedContributions() const
 	require(ivDataGridSourceIndexes.GetSize() == GetPredictorAttributeNumber());
 	require(classifierRule != NULL);
 	require(oaTargetValueRankedAttributeContributions.GetSize() == GetTargetValueNumber());
-	require(not bIsRankedContributionComputed);
+	require(0 <= nTarget and nTarget < GetTargetValueNumber());
+	require(0 < nRankNumber and nRankNumber <= GetPredictorAttributeNumber());
+	require(nRankNumber > ivTargetValueRankedContributionNumbers.GetAt(nTarget));
 
-	// Calcul des contributions par valeur cible
-	for (nTarget = 0; nTarget < GetTargetValueNumber(); nTarget++)
-	{
-		oaRankedAttributeContributions =
-		    cast(ObjectArray*, oaTargetValueRankedAttributeContributions.GetAt(nTarget));
-		assert(oaRankedAttributeContributions->GetSize() == GetPredictorAttributeNumber());
+	// On calcule au moins le nombre de rangs demandes par les regles d'interpretation, et au moins le double
+	// du nombre de rangs deja calcules, pour limiter le nombre de recalculs en cas d'acces a des rangs croissants
+	nRankNumber = max(nRankNumber, nRequestedContributionNumber);
+	nRankNumber = max(nRankNumber, 2 * ivTargetValueRankedContributionNumbers.GetAt(nTarget));
+	nRankNumber = min(nRankNumber, GetPredictorAttributeNumber());
 
-		// Calcul des contribution par attributs
-		for (nAttribute = 0; nAttribute < GetPredictorAttributeNumber(); nAttribute++)
-		{
-			attributeContribution =
-			    cast(KIAttributeContribution*, oaRankedAttributeContributions->GetAt(nAttribute));
+	// Acces au contributions de la valeur cible
+	oaRankedAttributeContributions = cast(ObjectArray*, oaTargetValueRankedAttributeContributions.GetAt(nTarget));
+	assert(oaRankedAttributeContributions->GetSize() == GetPredictorAttributeNumber());
 
-			// Recheche des index source et cible dans la grille correspondante
-			nSourceCellIndex = ivDataGridSourceIndexes.GetAt(nAttribute);
+	// Calcul des contribution par attributs, dans les objets prealloues
+	for (nAttribute = 0; nAttribute < GetPredictorAttributeNumber(); nAttribute++)
+	{
+		attributeContribution = cast(KIAttributeContribution*, oaRankedAttributeContributions->GetAt(nAttribute));
 
-			// Recherche de la valeur de Shapley
-			cShapleyValue = GetPredictorAttributeShapleyTableAt(nAttribute)
-					    ->GetShapleyValueAt(nSourceCellIndex, nTarget);
-			assert(cShapleyValue == GetContributionAt(nTarget, nAttribute));
+		// Recheche des index source et cible dans la grille correspondante
+		nSourceCellIndex = ivDataGridSourceIndexes.GetAt(nAttribute);
 
-			// Memorisation de l'index de l'attribut et de sa contribution
-			attributeContribution->SetAttributeIndex(nAttribute);
-			attributeContribution->SetContribution(cShapleyValue);
-		}
+		// Recherche de la valeur de Shapley
+		cShapleyValue =
+		    GetPredictorAttributeShapleyTableAt(nAttribute)->GetShapleyValueAt(nSourceCellIndex, nTarget);
+		assert(cShapleyValue == GetContributionAt(nTarget, nAttribute));
 
-		// Tri des contribution
+		// Memorisation de l'index de l'attribut et de sa contribution
+		attributeContribution->SetAttributeIndex(nAttribute);
+		attributeContribution->SetContribution(cShapleyValue);
+	}
+
+	// Tri complet des contributions si l'on demande beaucoup de rangs
+	if (nRankNumber > nMaxInsertionSelectionRankNumber or nRankNumber == GetPredictorAttributeNumber())
 		oaRankedAttributeContributions->Sort();
+	// Sinon, selection des meilleures contributions par insertion dans les premiers rangs, maintenus tries
+	// Le critere de comparaison etant un ordre total, les premiers rangs sont les memes qu'avec un tri complet
+	else
+	{
+		for (nAttribute = 1; nAttribute < GetPredictorAttributeNumber(); nAttribute++)
+		{
+			oInsertedContribution = oaRankedAttributeContributions->GetAt(nAttribute);
+
+			// Position d'insertion parmi les premiers rangs, en partant du dernier rang trie
+			nRank = min(nAttribute, nRankNumber);
+			oRankContribution = oaRankedAttributeContributions->GetAt(nRank - 1);
+			if (nRank == nRankNumber and
+			    KIAttributeContributionCompare(&oInsertedContribution, &oRankContribution) >= 0)
+				continue;
+
+			// Insertion par decalage des contributions moins bonnes, en echangeant l'objet de fin de
+			// selection avec l'objet insere pour conserver tous les objets dans le tableau
+			if (nRank == nRankNumber)
+			{
+				oaRankedAttributeContributions->SetAt(nAttribute, oRankContribution);
+				nRank--;
+			}
+			while (nRank > 0)
+			{
+				oRankContribution = oaRankedAttributeContributions->GetAt(nRank - 1);
+				if (KIAttributeContributionCompare(&oInsertedContribution, &oRankContribution) >= 0)
+					break;
+				oaRankedAttributeContributions->SetAt(nRank, oRankContribution);
+				nRank--;
+			}
+			oaRankedAttributeContributions->SetAt(nRank, oInsertedContribution);
+		}
 	}
 
-	// On memorise que la calcul est effectue
-	bIsRankedContributionComputed = true;
+	// On memorise le nombre de rangs calcules
+	ivTargetValueRankedContributionNumbers.SetAt(nTarget, nRankNumber);
 
 	// Trace des resultats
 	if (bTrace)
 	{
-		// Affichage par valeur cible
-		for (nTarget = 0; nTarget < GetTargetValueNumber(); nTarget++)
+		cout << "Contributions for " << GetTargetValueAt(nTarget) << "\n";
+		for (nRank = 0; nRank < nRankNumber; nRank++)
 		{
-			cout << "Contributions for " << GetTargetValueAt(nTarget) << "\n";
-
-			// Affichage par attributs
-			oaRankedAttributeContributions =
-			    cast(ObjectArray*, oaTargetValueRankedAttributeContributions.GetAt(nTarget));
-			for (nAttribute = 0; nAttribute < oaRankedAttributeContributions->GetSize(); nAttribute++)
-			{
-				attributeContribution =
-				    cast(KIAttributeContribution*, oaRankedAttributeContributions->GetAt(nAttribute));
-				cout << "\t" << attributeContribution->GetContribution() << "\t"
-				     << attributeContribution->GetAttributeName() << "\n";
-			}
+			attributeContribution = cast(KIAttributeContribution*, oaRankedAttributeContributions->GetAt(nRank));
+			cout << "\t" << attributeContribution->GetContribution() << "\t"
+			     << attributeContribution->GetAttributeName() << "\n";
 		}
 	}
 }
@@ -979,6 +1013,10 @@ void KIDRInterpretationRule::Compile(KWClass* kwcOwnerClass)
 		{
 			assert(GetOperandAt(2)->GetType() == KWType::Continuous);
 			nConstantContributionRank = (int)floor(GetOperandAt(2)->GetContinuousConstant() - 0.5);
+
+			// Mise a jour du nombre de contributions par rang a calculer par l'interpreteur
+			if (nConstantContributionRank >= 0)
+				classifierInterpreter->UpdateRequestedContributionNumber(nConstantContributionRank + 1);
 		}
 	}
 }
@@ -157,6 +157,14 @@ public:
 	// Valeur de contribution pour une valeur cible et un rang de variable
 	Continuous GetRankedContributionValueAt(int nTargetValueRank, int nContributionRank) const;
 
+	// Nombre de contributions par rang demandees par les regles d'interpretation utilisant l'interpreteur
+	// Chaque regle d'acces par rang met a jour ce nombre lors de sa compilation, avec son rang constant s'il
+	// existe, ou avec un nombre arbitrairement grand sinon. Seules les contributions de meilleur rang sont
+	// alors selectionnees par valeur cible, sans tri complet. Il s'agit d'une optimisation: les acces
+	// a des rangs au dela de ce nombre restent valides, au prix d'un recalcul de la selection
+	void UpdateRequestedContributionNumber(int nValue);
+	int GetRequestedContributionNumber() const;
+
 	////////////////////////////////////////////////////////////////////
 	// Services divers
 
@@ -176,8 +184,13 @@ protected:
 	void CreateRankedContributionStructures(int nTargetValueNumber, int nAttributeNumber,
 						const SymbolVector* svAttributeNames);
 
-	// Calcul de toutes les contributions triees pour les acces aux contributions par rang
-	void ComputeRankedContributions() const;
+	// Calcul des contributions d'une valeur cible, triees au moins jusqu'au nombre de rangs demande,
+	// pour les acces aux contributions par rang
+	// Les contributions sont calculees dans les objets prealloues, sans allocation memoire
+	void ComputeTargetRankedContributions(int nTarget, int nRankNumber) const;
+
+	// Nombre maximum de rangs pour lequel on effectue une selection par insertion plutot qu'un tri complet
+	static const int nMaxInsertionSelectionRankNumber = 32;
 
 	// Contribution par valeur cible et par rang
 	const KIAttributeContribution* GetRankedContributionAt(int nTarget, int nAttributeRank) const;
@@ -186,10 +199,15 @@ protected:
 	ObjectArray oaPredictorAttributeShapleyTables;
 
 	// Tableau par valeur cible de tableaux de KIAttributeContribution, tries par contribution decroissante
+	// Seuls les premiers rangs sont tries, selon le nombre de rangs calcules par valeur cible
 	ObjectArray oaTargetValueRankedAttributeContributions;
 
-	// Indicateur de calcul des contributions par rang, pour bufferisation des calculs
-	mutable boolean bIsRankedContributionComputed;
+	// Nombre de contributions par rang demandees par les regles d'interpretation
+	int nRequestedContributionNumber;
+
+	// Nombre de rangs calcules par valeur cible, pour bufferisation des calculs pour l'objet courant
+	// (0 si les contributions de la valeur cible ne sont pas calculees)
+	mutable IntVector ivTargetValueRankedContributionNumbers;
 };
 
 ////////////////////////////////////////////////////////////
@@ -396,14 +414,25 @@ inline const KIAttributeContribution* KIDRClassifierInterpreter::GetRankedContri
 	const ObjectArray* oaRankedAttributeContributions;
 
 	require(IsCompiled());
-	require(bIsRankedContributionComputed);
 	require(0 <= nTarget and nTarget < GetTargetValueNumber());
-	require(0 <= nAttributeRank and nAttributeRank < GetPredictorAttributeNumber());
+	require(0 <= nAttributeRank and nAttributeRank < ivTargetValueRankedContributionNumbers.GetAt(nTarget));
 	oaRankedAttributeContributions =
 	    cast(const ObjectArray*, oaTargetValueRankedAttributeContributions.GetAt(nTarget));
 	return cast(const KIAttributeContribution*, oaRankedAttributeContributions->GetAt(nAttributeRank));
 }
 
+inline void KIDRClassifierInterpreter::UpdateRequestedContributionNumber(int nValue)
+{
+	require(nValue >= 0);
+	if (nValue > nRequestedContributionNumber)
+		nRequestedContributionNumber = nValue;
+}
+
+inline int KIDRClassifierInterpreter::GetRequestedContributionNumber() const
+{
+	return nRequestedContributionNumber;
+}
+
 inline void KIAttributeContribution::SetAttributeIndex(int nValue)
 {
 	require(nValue >= 0);
@@ -1974,10 +1974,113 @@ KWDRTableStats::KWDRTableStats()
 	SetMultipleScope(true);
 	SetOperandNumber(1);
 	GetFirstOperand()->SetType(KWType::ObjectArray);
+	sharedValues = NULL;
 }
 
 KWDRTableStats::~KWDRTableStats() {}
 
+void KWDRTableStats::Compile(KWClass* kwcOwnerClass)
+{
+	// Les valeurs partagees sont eventuellement reattribuees par la classe apres sa compilation
+	sharedValues = NULL;
+
+	// Appel de la methode ancetre
+	KWDerivationRule::Compile(kwcOwnerClass);
+}
+
+const ALString KWDRTableStats::GetSharedComputationKey() const
+{
+	ALString sKey;
+
+	require(IsCompiled());
+
+	// Partage uniquement pour une table et un attribut secondaire directement issus d'attributs
+	if (IsStatsFromSharedValuesImplemented() and GetOperandNumber() == 2 and
+	    GetFirstOperand()->GetOrigin() == KWDerivationRuleOperand::OriginAttribute and
+	    GetSecondOperand()->GetOrigin() == KWDerivationRuleOperand::OriginAttribute and
+	    GetSecondOperand()->GetScopeLevel() == 0)
+	{
+		assert(KWType::IsSimple(GetSecondOperand()->GetType()));
+		sKey = "TableStats(" + GetFirstOperand()->GetAttributeName() + ", " +
+		       KWType::ToString(GetSecondOperand()->GetType()) + " " + GetSecondOperand()->GetAttributeName() +
+		       ")";
+	}
+	return sKey;
+}
+
+KWDRSharedComputation* KWDRTableStats::CreateSharedComputation() const
+{
+	require(GetSharedComputationKey() != "");
+	return new KWDRTableStatsSharedValues;
+}
+
+void KWDRTableStats::SetSharedComputation(KWDRSharedComputation* sharedComputation)
+{
+	require(sharedComputation == NULL or GetSharedComputationKey() != "");
+	sharedValues = cast(KWDRTableStatsSharedValues*, sharedComputation);
+}
+
+const ALString KWDRTableStats::GetStreamedTableAttributeName() const
+{
+	KWAttribute* tableAttribute;
+	KWAttribute* valueAttribute;
+
+	require(IsCompiled());
+
+	// Calcul en flux uniquement pour un attribut table natif
+	if (not IsStatsFromSharedValuesImplemented() or GetOperandNumber() > 2 or
+	    GetFirstOperand()->GetOrigin() != KWDerivationRuleOperand::OriginAttribute)
+		return "";
+	tableAttribute = GetFirstOperand()->GetOriginAttribute();
+	if (tableAttribute == NULL or tableAttribute->GetAnyDerivationRule() != NULL)
+		return "";
+
+	// Et pour une valeur eventuelle provenant d'un attribut natif de la table secondaire
+	if (GetOperandNumber() == 2)
+	{
+		if (GetSecondOperand()->GetOrigin() != KWDerivationRuleOperand::OriginAttribute or
+		    GetSecondOperand()->GetScopeLevel() != 0)
+			return "";
+		valueAttribute = GetSecondOperand()->GetOriginAttribute();
+		if (valueAttribute == NULL or not valueAttribute->IsNative())
+			return "";
+	}
+	return tableAttribute->GetName();
+}
+
+KWDRSharedComputation* KWDRTableStats::CreateStreamedComputation() const
+{
+	KWDRTableStatsSharedValues* streamedValues;
+
+	require(GetStreamedTableAttributeName() != "");
+
+	streamedValues = new KWDRTableStatsSharedValues;
+	streamedValues->SetStreamedRule(this, IsStatsFromSortedValues());
+	return streamedValues;
+}
+
+boolean KWDRTableStats::IsStatsFromSharedValuesImplemented() const
+{
+	return false;
+}
+
+boolean KWDRTableStats::IsStatsFromSortedValues() const
+{
+	return false;
+}
+
+Continuous KWDRTableStats::ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const
+{
+	assert(false);
+	return KWContinuous::GetMissingValue();
+}
+
+Symbol KWDRTableStats::ComputeSymbolStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const
+{
+	assert(false);
+	return Symbol();
+}
+
 Continuous KWDRTableStats::ComputeContinuousStatsFromContinuousVector(int nRecordNumber, Continuous cDefaultValue,
 								      const ContinuousVector* cvValues) const
 {
@@ -2023,6 +2126,16 @@ Continuous KWDRTableStatsContinuous::ComputeContinuousResult(const KWObject* kwo
 
 	require(IsCompiled());
 
+	// Calcul a partir des valeurs partagees avec d'autres regles si possible
+	// Dans ce cas, il n'y a pas d'operande secondaire de scope principal
+	if (sharedValues != NULL and sharedValues->CollectValues(kwoObject, this))
+	{
+		if (sharedValues->GetObjectNumber() == 0)
+			return GetDefaultContinuousStats();
+		else
+			return ComputeContinuousStatsFromSharedValues(sharedValues);
+	}
+
 	// Evaluation des operandes secondaires de scope principal
 	EvaluateMainScopeSecondaryOperands(kwoObject);
 
@@ -2039,6 +2152,22 @@ Continuous KWDRTableStatsContinuous::ComputeContinuousResult(const KWObject* kwo
 	return cResult;
 }
 
+Continuous KWDRTableStatsContinuous::ComputeContinuousStreamedResult(KWDRSharedComputation* streamedComputation) const
+{
+	KWDRTableStatsSharedValues* streamedValues;
+
+	require(IsCompiled());
+	require(streamedComputation != NULL);
+
+	// Calcul a partir des valeurs accumulees, comme pour des valeurs partagees
+	streamedValues = cast(KWDRTableStatsSharedValues*, streamedComputation);
+	assert(streamedValues->GetStreamedRule() == this);
+	if (streamedValues->GetObjectNumber() == 0)
+		return GetDefaultContinuousStats();
+	else
+		return ComputeContinuousStatsFromSharedValues(streamedValues);
+}
+
 Continuous KWDRTableStatsContinuous::GetDefaultContinuousStats() const
 {
 	return KWContinuous::GetMissingValue();
@@ -2061,6 +2190,15 @@ Symbol KWDRTableStatsSymbol::ComputeSymbolResult(const KWObject* kwoObject) cons
 
 	require(IsCompiled());
 
+	// Calcul a partir des valeurs partagees avec d'autres regles si possible
+	// Dans ce cas, il n'y a pas d'operande secondaire de scope principal
+	if (sharedValues != NULL and sharedValues->CollectValues(kwoObject, this))
+	{
+		if (sharedValues->GetObjectNumber() > 0)
+			sResult = ComputeSymbolStatsFromSharedValues(sharedValues);
+		return sResult;
+	}
+
 	// Evaluation des operandes secondaires de scope principal
 	EvaluateMainScopeSecondaryOperands(kwoObject);
 
@@ -2075,6 +2213,240 @@ Symbol KWDRTableStatsSymbol::ComputeSymbolResult(const KWObject* kwoObject) cons
 	return sResult;
 }
 
+Symbol KWDRTableStatsSymbol::ComputeSymbolStreamedResult(KWDRSharedComputation* streamedComputation) const
+{
+	KWDRTableStatsSharedValues* streamedValues;
+	Symbol sResult;
+
+	require(IsCompiled());
+	require(streamedComputation != NULL);
+
+	// Calcul a partir des valeurs accumulees, comme pour des valeurs partagees
+	streamedValues = cast(KWDRTableStatsSharedValues*, streamedComputation);
+	assert(streamedValues->GetStreamedRule() == this);
+	if (streamedValues->GetObjectNumber() > 0)
+		sResult = ComputeSymbolStatsFromSharedValues(streamedValues);
+	return sResult;
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Classe KWDRTableStatsSharedValues
+
+KWDRTableStatsSharedValues::KWDRTableStatsSharedValues()
+{
+	nObjectNumber = 0;
+	nValueNumber = 0;
+	dValueSum = 0;
+	dValueSquareSum = 0;
+	cMinValue = KWContinuous::GetMaxValue();
+	cMaxValue = KWContinuous::GetMinValue();
+	bAreValuesSorted = false;
+	bIsCollecting = false;
+	streamedRule = NULL;
+	bKeepValues = true;
+}
+
+KWDRTableStatsSharedValues::~KWDRTableStatsSharedValues()
+{
+	nkdSymbolFrequencies.DeleteAll();
+}
+
+boolean KWDRTableStatsSharedValues::CollectValues(const KWObject* kwoObject, const KWDRTableStats* statsRule)
+{
+	KWDerivationRuleOperand* valueOperand;
+	ObjectArray* oaObjects;
+	int nObject;
+
+	require(kwoObject != NULL);
+	require(statsRule != NULL);
+	require(statsRule->GetSharedComputationKey() != "");
+	require(streamedRule == NULL);
+
+	// Arret si appel reentrant
+	if (bIsCollecting)
+		return false;
+
+	// Arret si les valeurs sont deja collectees pour l'objet
+	if (kwoObject == GetComputedObject())
+		return true;
+
+	// Reinitialisation des valeurs, et memorisation de l'objet
+	Reset();
+	bIsCollecting = true;
+
+	// Collecte des valeurs du deuxieme operande pour le tableau du premier operande,
+	// en calculant les sommes dans le meme ordre que les regles de stats
+	oaObjects = statsRule->GetFirstOperand()->GetObjectArrayValue(kwoObject);
+	if (oaObjects != NULL)
+	{
+		valueOperand = statsRule->GetSecondOperand();
+		for (nObject = 0; nObject < oaObjects->GetSize(); nObject++)
+			CollectObjectValue(cast(KWObject*, oaObjects->GetAt(nObject)), valueOperand);
+	}
+	SetComputedObject(kwoObject);
+	bIsCollecting = false;
+	return true;
+}
+
+void KWDRTableStatsSharedValues::SetStreamedRule(const KWDRTableStats* statsRule, boolean bKeepValuesValue)
+{
+	require(statsRule != NULL);
+	require(statsRule->GetStreamedTableAttributeName() != "");
+	require(GetComputedObject() == NULL);
+
+	streamedRule = statsRule;
+	bKeepValues = bKeepValuesValue;
+}
+
+const KWDRTableStats* KWDRTableStatsSharedValues::GetStreamedRule() const
+{
+	return streamedRule;
+}
+
+void KWDRTableStatsSharedValues::AddStreamedObject(const KWObject* kwoSubObject)
+{
+	require(streamedRule != NULL);
+	require(GetComputedObject() != NULL);
+	require(kwoSubObject != NULL);
+
+	// Collecte de la valeur de l'eventuel deuxieme operande de la regle
+	if (streamedRule->GetOperandNumber() == 1)
+		CollectObjectValue(kwoSubObject, NULL);
+	else
+		CollectObjectValue(kwoSubObject, streamedRule->GetSecondOperand());
+}
+
+void KWDRTableStatsSharedValues::Reset()
+{
+	require(not bIsCollecting);
+
+	KWDRSharedComputation::Reset();
+	nObjectNumber = 0;
+	nValueNumber = 0;
+	dValueSum = 0;
+	dValueSquareSum = 0;
+	cMinValue = KWContinuous::GetMaxValue();
+	cMaxValue = KWContinuous::GetMinValue();
+	cvValues.SetSize(0);
+	bAreValuesSorted = false;
+
+	// On utilise DeleteAll, qui reinitialise la table de hashage: les valeurs seront ainsi parcourues
+	// dans le meme ordre que dans un dictionnaire nouvellement cree
+	nkdSymbolFrequencies.DeleteAll();
+}
+
+int KWDRTableStatsSharedValues::GetObjectNumber() const
+{
+	require(GetComputedObject() != NULL);
+	return nObjectNumber;
+}
+
+int KWDRTableStatsSharedValues::GetValueNumber() const
+{
+	require(GetComputedObject() != NULL);
+	return nValueNumber;
+}
+
+double KWDRTableStatsSharedValues::GetValueSum() const
+{
+	require(GetComputedObject() != NULL);
+	return dValueSum;
+}
+
+double KWDRTableStatsSharedValues::GetValueSquareSum() const
+{
+	require(GetComputedObject() != NULL);
+	return dValueSquareSum;
+}
+
+Continuous KWDRTableStatsSharedValues::GetMinValue() const
+{
+	require(GetComputedObject() != NULL);
+	return cMinValue;
+}
+
+Continuous KWDRTableStatsSharedValues::GetMaxValue() const
+{
+	require(GetComputedObject() != NULL);
+	return cMaxValue;
+}
+
+const ContinuousVector* KWDRTableStatsSharedValues::GetSortedValues()
+{
+	require(GetComputedObject() != NULL);
+	require(bKeepValues);
+
+	// Tri des valeurs lors du premier acces
+	if (not bAreValuesSorted)
+	{
+		cvValues.Sort();
+		bAreValuesSorted = true;
+	}
+	return &cvValues;
+}
+
+const NumericKeyDictionary* KWDRTableStatsSharedValues::GetSymbolFrequencies() const
+{
+	require(GetComputedObject() != NULL);
+	return &nkdSymbolFrequencies;
+}
+
+const ALString KWDRTableStatsSharedValues::GetClassLabel() const
+{
+	return "Table stats shared values";
+}
+
+void KWDRTableStatsSharedValues::CollectObjectValue(const KWObject* kwoContainedObject,
+						    const KWDerivationRuleOperand* valueOperand)
+{
+	Continuous cValue;
+	double dValue;
+	Symbol sValue;
+	KWSortableSymbol* symbolFrequency;
+
+	require(kwoContainedObject != NULL);
+
+	// Comptage de l'objet
+	nObjectNumber++;
+	if (valueOperand == NULL)
+		return;
+
+	// Cas numerique
+	if (valueOperand->GetType() == KWType::Continuous)
+	{
+		cValue = valueOperand->GetContinuousValue(kwoContainedObject);
+		if (cValue != KWContinuous::GetMissingValue())
+		{
+			dValue = cValue;
+			dValueSum += dValue;
+			dValueSquareSum += dValue * dValue;
+			if (cValue < cMinValue)
+				cMinValue = cValue;
+			if (cValue > cMaxValue)
+				cMaxValue = cValue;
+			if (bKeepValues)
+				cvValues.Add(cValue);
+			nValueNumber++;
+		}
+	}
+	// Cas categoriel
+	else
+	{
+		assert(valueOperand->GetType() == KWType::Symbol);
+		sValue = valueOperand->GetSymbolValue(kwoContainedObject);
+
+		// Comptage de la valeur, en memorisant le Symbol pour qu'il ne soit pas detruit
+		symbolFrequency = cast(KWSortableSymbol*, nkdSymbolFrequencies.Lookup(sValue.GetNumericKey()));
+		if (symbolFrequency == NULL)
+		{
+			symbolFrequency = new KWSortableSymbol;
+			symbolFrequency->SetSortValue(sValue);
+			nkdSymbolFrequencies.SetAt(sValue.GetNumericKey(), symbolFrequency);
+		}
+		symbolFrequency->SetIndex(symbolFrequency->GetIndex() + 1);
+	}
+}
+
 ////////////////////////////////////////////////////////////////////////////
 // Classe KWDRTableCount
 
@@ -2116,6 +2488,18 @@ Continuous KWDRTableCount::GetDefaultContinuousStats() const
 	return 0;
 }
 
+boolean KWDRTableCount::IsStatsFromSharedValuesImplemented() const
+{
+	return true;
+}
+
+Continuous KWDRTableCount::ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const
+{
+	require(tableSharedValues != NULL);
+	require(tableSharedValues->GetObjectNumber() > 0);
+	return (Continuous)tableSharedValues->GetObjectNumber();
+}
+
 ////////////////////////////////////////////////////////////////////////////
 // Classe KWDRTableCountDistinct
 
@@ -2196,6 +2580,19 @@ Continuous KWDRTableCountDistinct::ComputeContinuousStatsFromSymbolVector(int nR
 	return cResult;
 }
 
+boolean KWDRTableCountDistinct::IsStatsFromSharedValuesImplemented() const
+{
+	return true;
+}
+
+Continuous KWDRTableCountDistinct::ComputeContinuousStatsFromSharedValues(
+    KWDRTableStatsSharedValues* tableSharedValues) const
+{
+	require(tableSharedValues != NULL);
+	require(tableSharedValues->GetObjectNumber() > 0);
+	return (Continuous)tableSharedValues->GetSymbolFrequencies()->GetCount();
+}
+
 Continuous KWDRTableCountDistinct::GetDefaultContinuousStats() const
 {
 	return 0;
@@ -2346,6 +2743,43 @@ Continuous KWDRTableEntropy::ComputeContinuousStatsFromSymbolVector(int nRecordN
 	return cResult;
 }
 
+boolean KWDRTableEntropy::IsStatsFromSharedValuesImplemented() const
+{
+	return true;
+}
+
+Continuous
+KWDRTableEntropy::ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const
+{
+	const NumericKeyDictionary* nkdSymbolFrequencies;
+	KWSortableSymbol* symbolCount;
+	POSITION position;
+	NUMERIC rKey;
+	Object* oElement;
+	double dProb;
+	Continuous cResult;
+
+	require(tableSharedValues != NULL);
+	require(tableSharedValues->GetObjectNumber() > 0);
+
+	// Calcul de l'entropie a partir des effectifs par valeur
+	cResult = 0;
+	nkdSymbolFrequencies = tableSharedValues->GetSymbolFrequencies();
+	position = nkdSymbolFrequencies->GetStartPosition();
+	while (position != NULL)
+	{
+		nkdSymbolFrequencies->GetNextAssoc(position, rKey, oElement);
+		symbolCount = cast(KWSortableSymbol*, oElement);
+
+		// Calcul de la probabilite de la valeur
+		dProb = symbolCount->GetIndex() * 1.0 / tableSharedValues->GetObjectNumber();
+
+		// Mise a jour de l'entropie
+		cResult -= dProb * log(dProb);
+	}
+	return cResult;
+}
+
 Continuous KWDRTableEntropy::GetDefaultContinuousStats() const
 {
 	return 0;
@@ -2481,6 +2915,43 @@ Symbol KWDRTableMode::ComputeSymbolStatsFromSymbolVector(int nRecordNumber, Symb
 	return sMode;
 }
 
+boolean KWDRTableMode::IsStatsFromSharedValuesImplemented() const
+{
+	return true;
+}
+
+Symbol KWDRTableMode::ComputeSymbolStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const
+{
+	const NumericKeyDictionary* nkdSymbolFrequencies;
+	KWSortableSymbol* kwssValueFrequency;
+	POSITION position;
+	NUMERIC rKey;
+	Object* oElement;
+	Symbol sMode;
+	int nModeFrequency;
+
+	require(tableSharedValues != NULL);
+	require(tableSharedValues->GetObjectNumber() > 0);
+
+	// Recherche de la valeur d'effectif maximal, la plus petite selon l'ordre lexicographique en cas d'egalite
+	nModeFrequency = 0;
+	nkdSymbolFrequencies = tableSharedValues->GetSymbolFrequencies();
+	position = nkdSymbolFrequencies->GetStartPosition();
+	while (position != NULL)
+	{
+		nkdSymbolFrequencies->GetNextAssoc(position, rKey, oElement);
+		kwssValueFrequency = cast(KWSortableSymbol*, oElement);
+		if (kwssValueFrequency->GetIndex() > nModeFrequency or
+		    (kwssValueFrequency->GetIndex() == nModeFrequency and
+		     kwssValueFrequency->GetSortValue().CompareValue(sMode) < 0))
+		{
+			nModeFrequency = kwssValueFrequency->GetIndex();
+			sMode = kwssValueFrequency->GetSortValue();
+		}
+	}
+	return sMode;
+}
+
 ////////////////////////////////////////////////////////////////////////////
 // Classe KWDRTableModeAt
 
@@ -2670,6 +3141,22 @@ Continuous KWDRTableMean::ComputeContinuousStatsFromContinuousVector(int nRecord
 	return cMean;
 }
 
+boolean KWDRTableMean::IsStatsFromSharedValuesImplemented() const
+{
+	return true;
+}
+
+Continuous KWDRTableMean::ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const
+{
+	require(tableSharedValues != NULL);
+	require(tableSharedValues->GetObjectNumber() > 0);
+
+	if (tableSharedValues->GetValueNumber() > 0)
+		return (Continuous)(tableSharedValues->GetValueSum() / tableSharedValues->GetValueNumber());
+	else
+		return KWContinuous::GetMissingValue();
+}
+
 ////////////////////////////////////////////////////////////////////////////
 // Classe KWDRTableStandardDeviation
 
@@ -2787,6 +3274,35 @@ KWDRTableStandardDeviation::ComputeContinuousStatsFromContinuousVector(int nReco
 	return cStandardDeviation;
 }
 
+boolean KWDRTableStandardDeviation::IsStatsFromSharedValuesImplemented() const
+{
+	return true;
+}
+
+Continuous KWDRTableStandardDeviation::ComputeContinuousStatsFromSharedValues(
+    KWDRTableStatsSharedValues* tableSharedValues) const
+{
+	int nValueNumber;
+	double dSum;
+	double dStandardDeviation;
+
+	require(tableSharedValues != NULL);
+	require(tableSharedValues->GetObjectNumber() > 0);
+
+	// Calcul de l'ecart type a partir des sommes
+	nValueNumber = tableSharedValues->GetValueNumber();
+	if (nValueNumber > 0)
+	{
+		dSum = tableSharedValues->GetValueSum();
+		dStandardDeviation =
+		    sqrt(fabs((tableSharedValues->GetValueSquareSum() - dSum * dSum / nValueNumber) / nValueNumber));
+		assert(dStandardDeviation >= 0);
+		return (Continuous)dStandardDeviation;
+	}
+	else
+		return KWContinuous::GetMissingValue();
+}
+
 ////////////////////////////////////////////////////////////////////////////
 // Classe KWDRTableMedian
 
@@ -2982,6 +3498,41 @@ Continuous KWDRTableMedian::ComputeContinuousStatsFromContinuousVector(int nReco
 	return cMedian;
 }
 
+boolean KWDRTableMedian::IsStatsFromSharedValuesImplemented() const
+{
+	return true;
+}
+
+boolean KWDRTableMedian::IsStatsFromSortedValues() const
+{
+	return true;
+}
+
+Continuous
+KWDRTableMedian::ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const
+{
+	const ContinuousVector* cvSortedValues;
+	Continuous cMedian;
+
+	require(tableSharedValues != NULL);
+	require(tableSharedValues->GetObjectNumber() > 0);
+
+	// Calcul de la valeur mediane, a partir des valeurs triees une seule fois pour toutes les regles
+	if (tableSharedValues->GetValueNumber() == 0)
+		cMedian = KWContinuous::GetMissingValue();
+	else
+	{
+		cvSortedValues = tableSharedValues->GetSortedValues();
+		if (cvSortedValues->GetSize() % 2 == 0)
+			cMedian = (cvSortedValues->GetAt(cvSortedValues->GetSize() / 2 - 1) +
+				   cvSortedValues->GetAt(cvSortedValues->GetSize() / 2)) /
+				  2;
+		else
+			cMedian = cvSortedValues->GetAt(cvSortedValues->GetSize() / 2);
+	}
+	return cMedian;
+}
+
 ////////////////////////////////////////////////////////////////////////////
 // Classe KWDRTableMin
 
@@ -3067,6 +3618,22 @@ Continuous KWDRTableMin::ComputeContinuousStatsFromContinuousVector(int nRecordN
 	return cMin;
 }
 
+boolean KWDRTableMin::IsStatsFromSharedValuesImplemented() const
+{
+	return true;
+}
+
+Continuous KWDRTableMin::ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const
+{
+	require(tableSharedValues != NULL);
+	require(tableSharedValues->GetObjectNumber() > 0);
+
+	if (tableSharedValues->GetValueNumber() > 0)
+		return tableSharedValues->GetMinValue();
+	else
+		return KWContinuous::GetMissingValue();
+}
+
 ////////////////////////////////////////////////////////////////////////////
 // Classe KWDRTableMax
 
@@ -3152,6 +3719,22 @@ Continuous KWDRTableMax::ComputeContinuousStatsFromContinuousVector(int nRecordN
 	return cMax;
 }
 
+boolean KWDRTableMax::IsStatsFromSharedValuesImplemented() const
+{
+	return true;
+}
+
+Continuous KWDRTableMax::ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const
+{
+	require(tableSharedValues != NULL);
+	require(tableSharedValues->GetObjectNumber() > 0);
+
+	if (tableSharedValues->GetValueNumber() > 0)
+		return tableSharedValues->GetMaxValue();
+	else
+		return KWContinuous::GetMissingValue();
+}
+
 ////////////////////////////////////////////////////////////////////////////
 // Classe KWDRTableSum
 
@@ -3237,6 +3820,22 @@ Continuous KWDRTableSum::ComputeContinuousStatsFromContinuousVector(int nRecordN
 	return cSum;
 }
 
+boolean KWDRTableSum::IsStatsFromSharedValuesImplemented() const
+{
+	return true;
+}
+
+Continuous KWDRTableSum::ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const
+{
+	require(tableSharedValues != NULL);
+	require(tableSharedValues->GetObjectNumber() > 0);
+
+	if (tableSharedValues->GetValueNumber() > 0)
+		return (Continuous)tableSharedValues->GetValueSum();
+	else
+		return KWContinuous::GetMissingValue();
+}
+
 ////////////////////////////////////////////////////////////////////////////
 // Classe KWDRTableCountSum
 
@@ -3311,6 +3910,19 @@ Continuous KWDRTableCountSum::ComputeContinuousStatsFromContinuousVector(int nRe
 	return cCountSum;
 }
 
+boolean KWDRTableCountSum::IsStatsFromSharedValuesImplemented() const
+{
+	return true;
+}
+
+Continuous
+KWDRTableCountSum::ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const
+{
+	require(tableSharedValues != NULL);
+	require(tableSharedValues->GetObjectNumber() > 0);
+	return (Continuous)tableSharedValues->GetValueSum();
+}
+
 Continuous KWDRTableCountSum::GetDefaultContinuousStats() const
 {
 	return 0;
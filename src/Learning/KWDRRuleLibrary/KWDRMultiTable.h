@@ -54,6 +54,7 @@ class KWDRTableSort;
 class KWDRTableStats;
 class KWDRTableStatsContinuous;
 class KWDRTableStatsSymbol;
+class KWDRTableStatsSharedValues;
 
 // Calcul de stats pour des regle ayant un premier operande ObjectArray
 class KWDRTableCount;
@@ -634,9 +635,44 @@ public:
 	KWDRTableStats();
 	~KWDRTableStats();
 
+	// Compilation, avec reinitialisation des valeurs partagees
+	void Compile(KWClass* kwcOwnerClass) override;
+
+	// Partage des valeurs collectees entre les regles de stats d'une classe portant sur le meme attribut table
+	// et le meme attribut secondaire, pour ne parcourir la table qu'une seule fois par objet
+	// Seules sont concernees les regles ayant exactement deux operandes, directement issus d'attributs,
+	// et implementant le calcul des stats a partir de valeurs partagees
+	const ALString GetSharedComputationKey() const override;
+	KWDRSharedComputation* CreateSharedComputation() const override;
+	void SetSharedComputation(KWDRSharedComputation* sharedComputation) override;
+
+	// Calcul en flux, en accumulant les valeurs dans un objet de valeurs partagees dedie
+	// Seules sont concernees les regles implementant le calcul des stats a partir de valeurs partagees,
+	// dont le premier operande est un attribut table natif et l'eventuel deuxieme operande un attribut
+	// natif de la table secondaire
+	const ALString GetStreamedTableAttributeName() const override;
+	KWDRSharedComputation* CreateStreamedComputation() const override;
+
 	///////////////////////////////////////////////////////
 	///// Implementation
 protected:
+	// Indique si la regle implemente le calcul des stats a partir de valeurs partagees (defaut: false)
+	virtual boolean IsStatsFromSharedValuesImplemented() const;
+
+	// Indique si le calcul a partir de valeurs partagees exploite le vecteur des valeurs triees (defaut: false)
+	// Permet de ne pas memoriser ce vecteur lors d'un calcul en flux
+	virtual boolean IsStatsFromSortedValues() const;
+
+	// Calcul d'une valeur a partir des valeurs partagees, collectees pour une table non vide
+	// Le resultat doit etre le meme qu'avec la methode prenant en entree un tableau d'objets
+	// Par defaut, ces methodes sont implementees avec assert(false), et seule la methode compatible
+	// avec le type de la regle doit etre reimplementee
+	virtual Continuous ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const;
+	virtual Symbol ComputeSymbolStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const;
+
+	// Valeurs partagees avec d'autres regles de la classe (NULL si pas de partage)
+	KWDRTableStatsSharedValues* sharedValues;
+
 	// Calcul d'une valeur a partir d'un vecteur de valeur
 	// En entree, on a en complement du vecteur de valeurs:
 	//  . RecordNumber: nombre total d'enregistrement de table secondaire, d'ou ont ete extraites les valeurs
@@ -686,6 +722,9 @@ public:
 	// Calcul de l'attribut derive (renvoie Missing par defaut pour un ObjectArray vide)
 	Continuous ComputeContinuousResult(const KWObject* kwoObject) const override;
 
+	// Calcul de l'attribut derive a partir des valeurs accumulees en flux
+	Continuous ComputeContinuousStreamedResult(KWDRSharedComputation* streamedComputation) const override;
+
 	///////////////////////////////////////////////////////
 	///// Implementation
 protected:
@@ -720,6 +759,9 @@ public:
 	// Calcul de l'attribut derive (renvoie "" pour un ObjectArray vide)
 	Symbol ComputeSymbolResult(const KWObject* kwoObject) const override;
 
+	// Calcul de l'attribut derive a partir des valeurs accumulees en flux
+	Symbol ComputeSymbolStreamedResult(KWDRSharedComputation* streamedComputation) const override;
+
 	///////////////////////////////////////////////////////
 	///// Implementation
 protected:
@@ -735,6 +777,90 @@ protected:
 	friend class KWDRTablePartitionStatsSymbol;
 };
 
+////////////////////////////////////////////////////////////////////////////
+// Classe KWDRTableStatsSharedValues
+// Valeurs d'un attribut secondaire collectees en une seule passe sur les objets d'une table,
+// partagees entre les regles de stats d'une classe portant sur la meme table et le meme attribut
+// (cf. KWDRTableStats::GetSharedComputationKey)
+// Pour un attribut numerique, on collecte l'effectif, la somme, la somme des carres, le min et le max
+// des valeurs non manquantes, ainsi que ces valeurs elles-memes, triees uniquement a la demande
+// Pour un attribut categoriel, on collecte l'effectif par valeur distincte
+class KWDRTableStatsSharedValues : public KWDRSharedComputation
+{
+public:
+	// Constructeur
+	KWDRTableStatsSharedValues();
+	~KWDRTableStatsSharedValues();
+
+	// Collecte des valeurs du deuxieme operande d'une regle de stats, pour les objets de la table
+	// de son premier operande, uniquement si elles ne sont pas deja collectees pour l'objet
+	// Renvoie false en cas d'appel reentrant pendant une collecte (par exemple si un attribut secondaire
+	// est calcule a partir d'une table de meme classe que l'objet): la regle doit alors faire son calcul
+	// sans utiliser les valeurs partagees
+	boolean CollectValues(const KWObject* kwoObject, const KWDRTableStats* statsRule);
+
+	// Parametrage d'un objet de valeurs dedie au calcul en flux d'une regle de stats
+	// (cf. KWDRTableStats::CreateStreamedComputation), en precisant s'il faut memoriser les valeurs
+	// numeriques elles-memes, ce qui n'est necessaire que pour les regles exploitant les valeurs triees
+	void SetStreamedRule(const KWDRTableStats* statsRule, boolean bKeepValues);
+	const KWDRTableStats* GetStreamedRule() const;
+
+	// Accumulation en flux de la valeur d'un sous-objet de la table de la regle de stats parametree
+	void AddStreamedObject(const KWObject* kwoSubObject) override;
+
+	// Reinitialisation
+	void Reset() override;
+
+	// Nombre d'objets de la table
+	int GetObjectNumber() const;
+
+	// Stats sur les valeurs numeriques non manquantes
+	int GetValueNumber() const;
+	double GetValueSum() const;
+	double GetValueSquareSum() const;
+	Continuous GetMinValue() const;
+	Continuous GetMaxValue() const;
+
+	// Valeurs numeriques non manquantes, triees lors du premier acces
+	const ContinuousVector* GetSortedValues();
+
+	// Dictionnaire des effectifs par valeur categorielle, indexe par la cle numerique des valeurs
+	// Les effectifs sont memorises dans des KWSortableSymbol, avec la valeur en SortValue et l'effectif en Index,
+	// et sont inseres dans l'ordre d'apparition des valeurs dans la table
+	const NumericKeyDictionary* GetSymbolFrequencies() const;
+
+	// Libelles utilisateurs
+	const ALString GetClassLabel() const override;
+
+	///////////////////////////////////////////////////////
+	///// Implementation
+protected:
+	// Collecte de la valeur d'un objet de la table, pour l'operande de valeur (NULL si pas de valeur)
+	void CollectObjectValue(const KWObject* kwoContainedObject, const KWDerivationRuleOperand* valueOperand);
+
+	// Nombre d'objets de la table
+	int nObjectNumber;
+
+	// Stats sur les valeurs numeriques
+	int nValueNumber;
+	double dValueSum;
+	double dValueSquareSum;
+	Continuous cMinValue;
+	Continuous cMaxValue;
+	ContinuousVector cvValues;
+	boolean bAreValuesSorted;
+
+	// Effectifs par valeur categorielle
+	NumericKeyDictionary nkdSymbolFrequencies;
+
+	// Indicateur de collecte en cours, pour detecter les appels reentrants
+	boolean bIsCollecting;
+
+	// Regle calculee en flux, et indicateur de memorisation des valeurs numeriques
+	const KWDRTableStats* streamedRule;
+	boolean bKeepValues;
+};
+
 ////////////////////////////////////////////////////////////////////////////
 // Classe KWDRTableCount
 // Nombre d'elements d'un attribut tableau d'objets
@@ -758,6 +884,8 @@ protected:
 	// Redefinition de la methode de calcul des stats
 	Continuous ComputeContinuousStats(const ObjectArray* oaObjects) const override;
 	Continuous GetDefaultContinuousStats() const override;
+	boolean IsStatsFromSharedValuesImplemented() const override;
+	Continuous ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const override;
 };
 
 ////////////////////////////////////////////////////////////////////////////
@@ -783,6 +911,8 @@ protected:
 	Continuous ComputeContinuousStats(const ObjectArray* oaObjects) const override;
 	Continuous ComputeContinuousStatsFromSymbolVector(int nRecordNumber, Symbol sDefaultValue,
 							  const SymbolVector* svValues) const override;
+	boolean IsStatsFromSharedValuesImplemented() const override;
+	Continuous ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const override;
 	Continuous GetDefaultContinuousStats() const override;
 };
 
@@ -809,6 +939,8 @@ protected:
 	Continuous ComputeContinuousStats(const ObjectArray* oaObjects) const override;
 	Continuous ComputeContinuousStatsFromSymbolVector(int nRecordNumber, Symbol sDefaultValue,
 							  const SymbolVector* svValues) const override;
+	boolean IsStatsFromSharedValuesImplemented() const override;
+	Continuous ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const override;
 	Continuous GetDefaultContinuousStats() const override;
 };
 
@@ -835,6 +967,8 @@ protected:
 	Symbol ComputeSymbolStats(const ObjectArray* oaObjects) const override;
 	Symbol ComputeSymbolStatsFromSymbolVector(int nRecordNumber, Symbol sDefaultValue,
 						  const SymbolVector* svValues) const override;
+	boolean IsStatsFromSharedValuesImplemented() const override;
+	Symbol ComputeSymbolStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const override;
 };
 
 ////////////////////////////////////////////////////////////////////////////
@@ -883,6 +1017,8 @@ protected:
 	Continuous ComputeContinuousStats(const ObjectArray* oaObjects) const override;
 	Continuous ComputeContinuousStatsFromContinuousVector(int nRecordNumber, Continuous cDefaultValue,
 							      const ContinuousVector* cvValues) const override;
+	boolean IsStatsFromSharedValuesImplemented() const override;
+	Continuous ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const override;
 };
 
 ////////////////////////////////////////////////////////////////////////////
@@ -907,6 +1043,8 @@ protected:
 	Continuous ComputeContinuousStats(const ObjectArray* oaObjects) const override;
 	Continuous ComputeContinuousStatsFromContinuousVector(int nRecordNumber, Continuous cDefaultValue,
 							      const ContinuousVector* cvValues) const override;
+	boolean IsStatsFromSharedValuesImplemented() const override;
+	Continuous ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const override;
 };
 
 ////////////////////////////////////////////////////////////////////////////
@@ -931,6 +1069,9 @@ protected:
 	Continuous ComputeContinuousStats(const ObjectArray* oaObjects) const override;
 	Continuous ComputeContinuousStatsFromContinuousVector(int nRecordNumber, Continuous cDefaultValue,
 							      const ContinuousVector* cvValues) const override;
+	boolean IsStatsFromSharedValuesImplemented() const override;
+	boolean IsStatsFromSortedValues() const override;
+	Continuous ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const override;
 };
 
 ////////////////////////////////////////////////////////////////////////////
@@ -955,6 +1096,8 @@ protected:
 	Continuous ComputeContinuousStats(const ObjectArray* oaObjects) const override;
 	Continuous ComputeContinuousStatsFromContinuousVector(int nRecordNumber, Continuous cDefaultValue,
 							      const ContinuousVector* cvValues) const override;
+	boolean IsStatsFromSharedValuesImplemented() const override;
+	Continuous ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const override;
 };
 
 ////////////////////////////////////////////////////////////////////////////
@@ -979,6 +1122,8 @@ protected:
 	Continuous ComputeContinuousStats(const ObjectArray* oaObjects) const override;
 	Continuous ComputeContinuousStatsFromContinuousVector(int nRecordNumber, Continuous cDefaultValue,
 							      const ContinuousVector* cvValues) const override;
+	boolean IsStatsFromSharedValuesImplemented() const override;
+	Continuous ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const override;
 };
 
 ////////////////////////////////////////////////////////////////////////////
@@ -1003,6 +1148,8 @@ protected:
 	Continuous ComputeContinuousStats(const ObjectArray* oaObjects) const override;
 	Continuous ComputeContinuousStatsFromContinuousVector(int nRecordNumber, Continuous cDefaultValue,
 							      const ContinuousVector* cvValues) const override;
+	boolean IsStatsFromSharedValuesImplemented() const override;
+	Continuous ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const override;
 };
 
 ////////////////////////////////////////////////////////////////////////////
@@ -1027,6 +1174,8 @@ protected:
 	Continuous ComputeContinuousStats(const ObjectArray* oaObjects) const override;
 	Continuous ComputeContinuousStatsFromContinuousVector(int nRecordNumber, Continuous cDefaultValue,
 							      const ContinuousVector* cvValues) const override;
+	boolean IsStatsFromSharedValuesImplemented() const override;
+	Continuous ComputeContinuousStatsFromSharedValues(KWDRTableStatsSharedValues* tableSharedValues) const override;
 	Continuous GetDefaultContinuousStats() const override;
 };
 
@@ -2742,6 +2742,9 @@ yyreduce:
 		}
 
 		// Import des operandes de la regle
+		// Les regles utilisees dans les operandes ayant deja ete verifiees lors de leur propre analyse,
+		// on evite de reverifier leur definition jusqu'a la verification de la regle courante
+		KWDerivationRule::SetOperandRulesDefinitionChecked(true);
 		if (bOk)
 			bOk = ImportParserRuleOperands(ruleBody, rule);
 
@@ -2789,6 +2792,7 @@ yyreduce:
 			yyerror(sTmp + "Derivation rule " + rule->GetName() + " incorrectly specified");
 			bOk = false;
 		}
+		KWDerivationRule::SetOperandRulesDefinitionChecked(false);
 
 		// Test si erreur dans le transfert des operandes
 		if (not bOk)
@@ -38,6 +38,9 @@ KWClass::~KWClass()
 
 	// Destruction des attributs
 	olAttributes.DeleteAll();
+
+	// Destruction des calculs partages entre les regles
+	oaSharedRuleComputations.DeleteAll();
 }
 
 void KWClass::SetKeyAttributeNumber(int nValue)
@@ -1110,6 +1113,9 @@ void KWClass::Compile()
 
 	// Parametrage specifique de toutes les regles Random utilisees dans la classe
 	InitializeAllRandomRuleParameters();
+
+	// Partage des calculs entre les regles de la classe
+	BuildAllSharedRuleComputations();
 }
 
 void KWClass::CompleteTypeInfo()
@@ -3138,6 +3144,81 @@ void KWClass::InitializeRandomRuleParameters(KWDerivationRule* rule, const ALStr
 	}
 }
 
+void KWClass::BuildAllSharedRuleComputations()
+{
+	KWAttribute* attribute;
+	KWDerivationRule* rule;
+	ALString sKey;
+	ObjectDictionary odSharingRules;
+	ObjectArray oaSharingRuleArrays;
+	ObjectArray* oaSharingRules;
+	KWDRSharedComputation* sharedComputation;
+	int nGroup;
+	int nRule;
+
+	require(IsCompiled());
+
+	// Destruction des calculs partages precedents, qui ne sont plus references par les regles recompilees
+	oaSharedRuleComputations.DeleteAll();
+
+	// Regroupement des regles des attributs par cle de partage
+	attribute = GetHeadAttribute();
+	while (attribute != NULL)
+	{
+		rule = attribute->GetDerivationRule();
+		if (rule != NULL)
+		{
+			sKey = rule->GetSharedComputationKey();
+			if (sKey != "")
+			{
+				oaSharingRules = cast(ObjectArray*, odSharingRules.Lookup(sKey));
+				if (oaSharingRules == NULL)
+				{
+					oaSharingRules = new ObjectArray;
+					odSharingRules.SetAt(sKey, oaSharingRules);
+					oaSharingRuleArrays.Add(oaSharingRules);
+				}
+				oaSharingRules->Add(rule);
+			}
+		}
+		GetNextAttribute(attribute);
+	}
+
+	// Creation d'un calcul partage par groupe d'au moins deux regles
+	for (nGroup = 0; nGroup < oaSharingRuleArrays.GetSize(); nGroup++)
+	{
+		oaSharingRules = cast(ObjectArray*, oaSharingRuleArrays.GetAt(nGroup));
+		if (oaSharingRules->GetSize() >= 2)
+		{
+			rule = cast(KWDerivationRule*, oaSharingRules->GetAt(0));
+			sharedComputation = rule->CreateSharedComputation();
+			oaSharedRuleComputations.Add(sharedComputation);
+			for (nRule = 0; nRule < oaSharingRules->GetSize(); nRule++)
+			{
+				rule = cast(KWDerivationRule*, oaSharingRules->GetAt(nRule));
+				rule->SetSharedComputation(sharedComputation);
+			}
+		}
+	}
+	oaSharingRuleArrays.DeleteAll();
+}
+
+void KWClass::InternalResetSharedRuleComputations(const KWObject* kwoObject) const
+{
+	KWDRSharedComputation* sharedComputation;
+	int i;
+
+	require(kwoObject != NULL);
+
+	// Reinitialisation des calculs bufferises pour l'objet
+	for (i = 0; i < oaSharedRuleComputations.GetSize(); i++)
+	{
+		sharedComputation = cast(KWDRSharedComputation*, oaSharedRuleComputations.GetAt(i));
+		if (sharedComputation->GetComputedObject() == kwoObject)
+			sharedComputation->Reset();
+	}
+}
+
 boolean KWClass::InternalCheckKeyBasedStorability(boolean bVerbose, KWAttribute* parentAttribute,
 						  NumericKeyDictionary* nkdComponentClasses) const
 {
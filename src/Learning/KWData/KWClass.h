@@ -656,6 +656,15 @@ protected:
 	void InitializeRandomRuleParameters(KWDerivationRule* rule, const ALString& sAttributeName,
 					    int& nRuleRankInAttribute);
 
+	// Construction des calculs partages entre les regles des attributs de la classe, apres compilation
+	// Les regles de meme cle de partage se voient attribuer un meme calcul partage (cf. KWDerivationRule)
+	void BuildAllSharedRuleComputations();
+
+	// Reinitialisation des calculs partages bufferises pour un objet, appele quand l'objet est detruit
+	// ou change de classe (cf. KWDRSharedComputation)
+	void ResetSharedRuleComputations(const KWObject* kwoObject) const;
+	void InternalResetSharedRuleComputations(const KWObject* kwoObject) const;
+
 	// Verification de l'integrite de la classe en ce qui concerne sa composition native,
 	// c'est a dire de sa hierarchie induite par l'ensemble des attributs relations non calcules,
 	// et si demande la coherence de son utilisation des cles dans la hierarchie et de l'acyclicite,
@@ -807,6 +816,9 @@ protected:
 	ObjectArray oaDatabaseDataItemsToCompute;
 	ObjectArray oaDatabaseTemporayDataItemsToComputeAndClean;
 
+	// Calculs partages entre les regles des attributs de la classe (KWDRSharedComputation)
+	ObjectArray oaSharedRuleComputations;
+
 	// Capacite a etre stocke sur un systeme de fichiers multi-tables a l'aide de cles
 	boolean bIsKeyBasedStorable;
 
@@ -1220,3 +1232,9 @@ inline KWClassDomain* KWClass::GetDomain() const
 {
 	return domain;
 }
+
+inline void KWClass::ResetSharedRuleComputations(const KWObject* kwoObject) const
+{
+	if (oaSharedRuleComputations.GetSize() > 0)
+		InternalResetSharedRuleComputations(kwoObject);
+}
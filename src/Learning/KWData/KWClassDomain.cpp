@@ -578,6 +578,13 @@ boolean KWClassDomain::Compile()
 		kwcElement->InitializeAllRandomRuleParameters();
 	}
 
+	// Partage des calculs entre les regles de chaque classe du domaine
+	for (nClass = 0; nClass < GetClassNumber(); nClass++)
+	{
+		kwcElement = GetClassAt(nClass);
+		kwcElement->BuildAllSharedRuleComputations();
+	}
+
 	/////////////////////////////////////////////////////////////////////////////////////////////
 	// Apres la compilation, test de l'existence de cycles de derivation
 	// Algorithme de detection de cycle base sur la coloration des noeuds en White, Grey, Black:
@@ -744,6 +744,17 @@ boolean KWDatabase::Close()
 }
 
 boolean KWDatabase::ReadAll()
+{
+	return InternalReadAll(NULL);
+}
+
+boolean KWDatabase::ReadAllAndProcess(KWDatabaseObjectProcessor* objectProcessor)
+{
+	require(objectProcessor != NULL);
+	return InternalReadAll(objectProcessor);
+}
+
+boolean KWDatabase::InternalReadAll(KWDatabaseObjectProcessor* objectProcessor)
 {
 	boolean bOk = true;
 	KWObject* kwoObject;
@@ -924,18 +935,28 @@ boolean KWDatabase::ReadAll()
 			{
 				lObjectNumber++;
 
-				// Ajout de l'objet au tableau
-				oaAllObjects.Add(kwoObject);
-
-				// Test de depassement de capacite du tableau
-				if (oaAllObjects.GetSize() == INT_MAX)
+				// Transmission de l'objet au processeur d'objets, qui en devient proprietaire
+				if (objectProcessor != NULL)
 				{
-					bOk = false;
-					Object::AddError(
-					    sTmp +
-					    "Read database interrupted because maximum number of instances reached (" +
-					    IntToString(INT_MAX) + ")");
-					break;
+					bOk = objectProcessor->ProcessObject(kwoObject);
+					if (not bOk)
+						break;
+				}
+				// Sinon, ajout de l'objet au tableau
+				else
+				{
+					oaAllObjects.Add(kwoObject);
+
+					// Test de depassement de capacite du tableau
+					if (oaAllObjects.GetSize() == INT_MAX)
+					{
+						bOk = false;
+						Object::AddError(sTmp +
+								 "Read database interrupted because maximum number of "
+								 "instances reached (" +
+								 IntToString(INT_MAX) + ")");
+						break;
+					}
 				}
 			}
 
@@ -5,6 +5,7 @@
 #pragma once
 
 class KWDatabase;
+class KWDatabaseObjectProcessor;
 
 #include "KWObjectDataPath.h"
 #include "KWClass.h"
@@ -187,6 +188,11 @@ public:
 	// en emettant une erreur et on detruit les objets ayant deja ete lus
 	boolean ReadAll();
 
+	// Lecture de tous les objets en flux, chaque objet lu etant transmis a un processeur d'objets
+	// au lieu d'etre garde en memoire, ce qui permet d'exploiter des bases de taille arbitraire
+	// Memes suivi de tache, controles memoire et messages que pour ReadAll, le tableau des objets restant vide
+	boolean ReadAllAndProcess(KWDatabaseObjectProcessor* objectProcessor);
+
 	// Acces aux objets
 	// Ce tableau a pour role principal d'accueillir le resultat d'un ReadAll.
 	// Il peut aussi etre modifie explicitement.
@@ -545,6 +551,10 @@ protected:
 	// Index d'enregistrement physique, pour localiser les erreurs
 	virtual longint GetPhysicalRecordIndex() const;
 
+	// Implementation commune de ReadAll et ReadAllAndProcess
+	// Les objets sont gardes en memoire si le processeur d'objets est NULL
+	boolean InternalReadAll(KWDatabaseObjectProcessor* objectProcessor);
+
 	// Collecte de messages de stats sur les enregistrements (lus ou ecrits) au niveau physique
 	// Remis a zero uniquement lors des ouvertures de fichiers, donc disponible a tout moment
 	// entre l'ouverture et la fermeture des fichiers
@@ -646,6 +656,17 @@ protected:
 	static ObjectDictionary* odDatabaseTechnologies;
 };
 
+//////////////////////////////////////////////////////////////////////
+// Classe KWDatabaseObjectProcessor
+// Traitement des objets d'une base lus en flux par KWDatabase::ReadAllAndProcess
+class KWDatabaseObjectProcessor : public Object
+{
+public:
+	// Traitement d'un objet lu, dont la memoire est transferee au processeur
+	// Renvoie false en cas d'erreur, apres avoir emis un message, ce qui interrompt la lecture
+	virtual boolean ProcessObject(KWObject* kwoObject) = 0;
+};
+
 //////////////////////////////////////////////////////////////////////
 // Methodes en inline
 
@@ -3,6 +3,9 @@
 // at https://spdx.org/licenses/BSD-3-Clause-Clear.html or see the "LICENSE" file for more details.
 
 #include "KWDatabaseMemoryGuard.h"
+#include "KWClass.h"
+#include "KWObject.h"
+#include "KWDerivationRule.h"
 
 longint KWDatabaseMemoryGuard::lCrashTestMaxSecondaryRecordNumber = 0;
 longint KWDatabaseMemoryGuard::lCrashTestMaxCreatedRecordNumber = 0;
@@ -13,7 +16,10 @@ KWDatabaseMemoryGuard::KWDatabaseMemoryGuard()
 	Reset();
 }
 
-KWDatabaseMemoryGuard::~KWDatabaseMemoryGuard() {}
+KWDatabaseMemoryGuard::~KWDatabaseMemoryGuard()
+{
+	oaStreamedComputations.DeleteAll();
+}
 
 void KWDatabaseMemoryGuard::Reset()
 {
@@ -113,6 +119,7 @@ void KWDatabaseMemoryGuard::Init()
 	nComputedAttributeNumberBeforeLimit = 0;
 	nTotalComputedAttributeNumber = 0;
 	nMemoryCleaningNumber = 0;
+	kwoStreamedMainObject = NULL;
 
 	// Prise en compte de la taille de la heap initiale
 	lInitialHeapMemory = MemGetHeapMemory();
@@ -379,10 +386,205 @@ const ALString KWDatabaseMemoryGuard::GetSingleInstanceMemoryLimitLabel() const
 
 	// Ajout d'une information sur la gestion de l'enregistrement en cas de probleme
 	sLabel += sLabelSuffixSingleInstanceRecovery;
+
+	// Cas des attributs calcules en flux sur tous les enregistrements secondaires
+	if (AreStreamedAttributesComputed())
+	{
+		sLabel += ", except ";
+		sLabel += IntToString(GetStreamedAttributeNumber());
+		if (GetStreamedAttributeNumber() == 1)
+			sLabel += " table statistics variable";
+		else
+			sLabel += " table statistics variables";
+		sLabel += " computed by streaming all the secondary records";
+	}
 	ensure(sLabel.Find(sLabelPrefixSingleInstance) == 0 and sLabel.Find(sLabelSuffixSingleInstanceRecovery) > 0);
 	return sLabel;
 }
 
+void KWDatabaseMemoryGuard::InitializeStreamedAttributes(const KWClass* kwcMainClass)
+{
+	int nAttribute;
+	KWAttribute* attribute;
+	KWDerivationRule* rule;
+	ALString sTableAttributeName;
+	KWAttribute* tableAttribute;
+	int nTableIndex;
+
+	require(kwcMainClass != NULL);
+	require(kwcMainClass->IsCompiled());
+
+	// Nettoyage prealable
+	CleanStreamedAttributes();
+
+	// Recherche des attributs derives charges calculables en flux
+	for (nAttribute = 0; nAttribute < kwcMainClass->GetLoadedAttributeNumber(); nAttribute++)
+	{
+		attribute = kwcMainClass->GetLoadedAttributeAt(nAttribute);
+		rule = attribute->GetDerivationRule();
+		if (rule == NULL or attribute->IsInBlock() or
+		    (attribute->GetType() != KWType::Continuous and attribute->GetType() != KWType::Symbol))
+			continue;
+
+		// Recherche de l'attribut table natif dont les enregistrements sont a accumuler
+		sTableAttributeName = rule->GetStreamedTableAttributeName();
+		if (sTableAttributeName == "")
+			continue;
+		tableAttribute = kwcMainClass->LookupAttribute(sTableAttributeName);
+		if (tableAttribute == NULL or tableAttribute->GetType() != KWType::ObjectArray or
+		    tableAttribute->GetAnyDerivationRule() != NULL or not tableAttribute->GetLoaded())
+			continue;
+
+		// Recherche de l'index de la table, en la memorisant si necessaire
+		for (nTableIndex = 0; nTableIndex < oaStreamedTableAttributes.GetSize(); nTableIndex++)
+		{
+			if (oaStreamedTableAttributes.GetAt(nTableIndex) == tableAttribute)
+				break;
+		}
+		if (nTableIndex == oaStreamedTableAttributes.GetSize())
+			oaStreamedTableAttributes.Add(tableAttribute);
+
+		// Memorisation de l'attribut et de son objet de calcul
+		oaStreamedAttributes.Add(attribute);
+		oaStreamedComputations.Add(rule->CreateStreamedComputation());
+		ivStreamedAttributeTableIndexes.Add(nTableIndex);
+	}
+	ivStreamedTableStarted.SetSize(oaStreamedTableAttributes.GetSize());
+	ensure(oaStreamedComputations.GetSize() == oaStreamedAttributes.GetSize());
+}
+
+void KWDatabaseMemoryGuard::CleanStreamedAttributes()
+{
+	oaStreamedAttributes.SetSize(0);
+	oaStreamedComputations.DeleteAll();
+	ivStreamedAttributeTableIndexes.SetSize(0);
+	oaStreamedTableAttributes.SetSize(0);
+	ivStreamedTableStarted.SetSize(0);
+	kwoStreamedMainObject = NULL;
+}
+
+void KWDatabaseMemoryGuard::AddStreamedSecondaryRecord(const KWObject* kwoMainObject, KWLoadIndex liTableLoadIndex,
+							const KWObject* kwoSubObject)
+{
+	int nTableIndex;
+	int nAttribute;
+
+	require(kwoMainObject != NULL);
+	require(kwoSubObject != NULL);
+	require(IsMemoryLimitReached());
+
+	// Arret immediat si pas d'attribut calculable en flux
+	if (oaStreamedAttributes.GetSize() == 0)
+		return;
+
+	// Demarrage de l'accumulation si necessaire
+	if (kwoStreamedMainObject != kwoMainObject)
+		StartStreamedSecondaryRecords(kwoMainObject);
+
+	// Recherche de la table concernee, en s'arretant si ses enregistrements ne sont pas a accumuler
+	for (nTableIndex = 0; nTableIndex < oaStreamedTableAttributes.GetSize(); nTableIndex++)
+	{
+		if (cast(KWAttribute*, oaStreamedTableAttributes.GetAt(nTableIndex))->GetLoadIndex() ==
+		    liTableLoadIndex)
+			break;
+	}
+	if (nTableIndex == oaStreamedTableAttributes.GetSize())
+		return;
+
+	// Accumulation prealable des enregistrements deja ranges dans la table, pour respecter l'ordre de lecture
+	if (ivStreamedTableStarted.GetAt(nTableIndex) == 0)
+		AddStoredSecondaryRecords(kwoMainObject, nTableIndex);
+
+	// Accumulation de l'enregistrement pour chaque attribut portant sur la table
+	for (nAttribute = 0; nAttribute < oaStreamedAttributes.GetSize(); nAttribute++)
+	{
+		if (ivStreamedAttributeTableIndexes.GetAt(nAttribute) == nTableIndex)
+			cast(KWDRSharedComputation*, oaStreamedComputations.GetAt(nAttribute))
+			    ->AddStreamedObject(kwoSubObject);
+	}
+}
+
+void KWDatabaseMemoryGuard::FinalizeStreamedSecondaryRecords(const KWObject* kwoMainObject)
+{
+	int nTableIndex;
+
+	require(kwoMainObject != NULL);
+	require(IsMemoryLimitReached());
+
+	// Arret immediat si pas d'attribut calculable en flux
+	if (oaStreamedAttributes.GetSize() == 0)
+		return;
+
+	// Demarrage de l'accumulation si necessaire, si la limite memoire a ete atteinte sans destruction
+	// d'enregistrement secondaire des tables natives de l'instance principale
+	if (kwoStreamedMainObject != kwoMainObject)
+		StartStreamedSecondaryRecords(kwoMainObject);
+
+	// Accumulation des tables entierement rangees dans l'instance principale
+	for (nTableIndex = 0; nTableIndex < oaStreamedTableAttributes.GetSize(); nTableIndex++)
+	{
+		if (ivStreamedTableStarted.GetAt(nTableIndex) == 0)
+			AddStoredSecondaryRecords(kwoMainObject, nTableIndex);
+	}
+}
+
+KWAttribute* KWDatabaseMemoryGuard::GetStreamedAttributeAt(int nIndex) const
+{
+	return cast(KWAttribute*, oaStreamedAttributes.GetAt(nIndex));
+}
+
+KWDRSharedComputation* KWDatabaseMemoryGuard::GetStreamedComputationAt(int nIndex) const
+{
+	return cast(KWDRSharedComputation*, oaStreamedComputations.GetAt(nIndex));
+}
+
+void KWDatabaseMemoryGuard::StartStreamedSecondaryRecords(const KWObject* kwoMainObject)
+{
+	int nAttribute;
+	KWDRSharedComputation* streamedComputation;
+
+	require(kwoMainObject != NULL);
+
+	// Reinitialisation des objets de calcul, associes a l'instance principale
+	for (nAttribute = 0; nAttribute < oaStreamedComputations.GetSize(); nAttribute++)
+	{
+		streamedComputation = cast(KWDRSharedComputation*, oaStreamedComputations.GetAt(nAttribute));
+		streamedComputation->Reset();
+		streamedComputation->SetComputedObject(kwoMainObject);
+	}
+	ivStreamedTableStarted.Initialize();
+	kwoStreamedMainObject = kwoMainObject;
+}
+
+void KWDatabaseMemoryGuard::AddStoredSecondaryRecords(const KWObject* kwoMainObject, int nTableIndex)
+{
+	ObjectArray* oaSubObjects;
+	int nObject;
+	const KWObject* kwoSubObject;
+	int nAttribute;
+
+	require(kwoMainObject == kwoStreamedMainObject);
+	require(ivStreamedTableStarted.GetAt(nTableIndex) == 0);
+
+	// Accumulation des enregistrements ranges dans la table
+	oaSubObjects = kwoMainObject->GetObjectArrayValueAt(
+	    cast(KWAttribute*, oaStreamedTableAttributes.GetAt(nTableIndex))->GetLoadIndex());
+	if (oaSubObjects != NULL)
+	{
+		for (nObject = 0; nObject < oaSubObjects->GetSize(); nObject++)
+		{
+			kwoSubObject = cast(const KWObject*, oaSubObjects->GetAt(nObject));
+			for (nAttribute = 0; nAttribute < oaStreamedAttributes.GetSize(); nAttribute++)
+			{
+				if (ivStreamedAttributeTableIndexes.GetAt(nAttribute) == nTableIndex)
+					cast(KWDRSharedComputation*, oaStreamedComputations.GetAt(nAttribute))
+					    ->AddStreamedObject(kwoSubObject);
+			}
+		}
+	}
+	ivStreamedTableStarted.SetAt(nTableIndex, 1);
+}
+
 const ALString KWDatabaseMemoryGuard::GetExternalTableMemoryLimitLabel() const
 {
 	ALString sLabel;
@@ -5,10 +5,16 @@
 #pragma once
 
 class KWDatabaseMemoryGuard;
+class KWClass;
+class KWAttribute;
+class KWObject;
+class KWDRSharedComputation;
 
 #include "Object.h"
 #include "MemoryManager.h"
 #include "Ermgt.h"
+#include "Vector.h"
+#include "KWLoadIndex.h"
 
 //////////////////////////////////////////////////////////////////////////////////////////////
 // Classe KWDatabaseMemoryGuard
@@ -171,6 +177,49 @@ public:
 	static void InstallMemoryGuardErrorFlowIgnoreFunction();
 	static void UninstallMemoryGuardErrorFlowIgnoreFunction();
 
+	//////////////////////////////////////////////////////////////////////////////////////
+	// Calcul en flux des attributs de l'instance principale en cas de depassement memoire
+	//
+	// Certains attributs derives de la classe principale, portant sur une table secondaire native
+	// (ex: TableCount, TableSum, TableMean...) peuvent etre calcules en flux, en accumulant les
+	// enregistrements secondaires un a un (cf. KWDerivationRule::GetStreamedTableAttributeName)
+	// En cas de depassement de la limite memoire lors de la lecture d'une instance principale, les enregistrements
+	// secondaires de ces tables sont accumules avant leur destruction, ce qui permet de calculer exactement
+	// la valeur de ces attributs, les autres attributs derives etant mis a valeur manquante
+	// Ce parametrage n'est concerne ni par Reset, ni par CopyFrom
+
+	// Initialisation des attributs calculables en flux a partir de la classe physique principale compilee,
+	// a l'ouverture de la base
+	void InitializeStreamedAttributes(const KWClass* kwcMainClass);
+
+	// Nettoyage des attributs calculables en flux, a la fermeture de la base
+	void CleanStreamedAttributes();
+
+	// Nombre d'attributs calculables en flux
+	int GetStreamedAttributeNumber() const;
+
+	// Accumulation d'un enregistrement secondaire d'une table native de l'instance principale, lu apres
+	// depassement de la limite memoire et juste avant sa destruction
+	// Lors du premier appel pour une table, les enregistrements deja ranges dans la table sont prealablement
+	// accumules
+	void AddStreamedSecondaryRecord(const KWObject* kwoMainObject, KWLoadIndex liTableLoadIndex,
+					const KWObject* kwoSubObject);
+
+	// Finalisation de l'accumulation en fin de lecture de l'instance principale, juste avant la destruction
+	// de ses enregistrements secondaires, en accumulant les tables non encore prises en compte
+	void FinalizeStreamedSecondaryRecords(const KWObject* kwoMainObject);
+
+	// Indique si des enregistrements secondaires ont ete accumules pour l'instance principale en cours
+	boolean AreStreamedAttributesComputed() const;
+
+	// Indique si un objet est l'instance principale dont les enregistrements secondaires ont ete accumules
+	boolean IsStreamedMainObject(const KWObject* kwoObject) const;
+
+	// Acces aux attributs calculables en flux et a leur objet de calcul, pour calculer leur valeur
+	// dans l'instance principale une fois les accumulations terminees (cf. KWObject::ComputeAllValues)
+	KWAttribute* GetStreamedAttributeAt(int nIndex) const;
+	KWDRSharedComputation* GetStreamedComputationAt(int nIndex) const;
+
 	//////////////////////////////////////////////////////////////////////////////////////
 	// Statistiques sur les operations effectuees
 
@@ -363,6 +412,25 @@ protected:
 	// Nombre max de passes de nettoyage de la memoire utilisees pour continuer le calcul des attributs
 	static const int nMaxMemoryCleaningNumber = 100;
 
+	// Demarrage de l'accumulation en flux pour une nouvelle instance principale
+	void StartStreamedSecondaryRecords(const KWObject* kwoMainObject);
+
+	// Accumulation des enregistrements secondaires deja ranges dans une table de l'instance principale
+	void AddStoredSecondaryRecords(const KWObject* kwoMainObject, int nTableIndex);
+
+	// Attributs calculables en flux, leur objet de calcul et l'index de leur attribut table
+	ObjectArray oaStreamedAttributes;
+	ObjectArray oaStreamedComputations;
+	IntVector ivStreamedAttributeTableIndexes;
+
+	// Attributs tables natifs dont les enregistrements sont accumules, avec un indicateur par table
+	// pour savoir si ses enregistrements deja ranges ont ete accumules pour l'instance principale
+	ObjectArray oaStreamedTableAttributes;
+	IntVector ivStreamedTableStarted;
+
+	// Instance principale dont les enregistrements secondaires sont accumules (NULL si aucune)
+	const KWObject* kwoStreamedMainObject;
+
 	///////////////////////////////////////////////////////////////////////////////////////////
 	// Gestion de la methode specifique pour ignorer le controle de flow des erreurs
 
@@ -402,6 +470,21 @@ inline boolean KWDatabaseMemoryGuard::IsMaxCreatedRecordNumberReached() const
 	return lActualMaxCreatedRecordNumber > 0 and GetTotalCreatedRecordNumber() > lActualMaxCreatedRecordNumber;
 }
 
+inline int KWDatabaseMemoryGuard::GetStreamedAttributeNumber() const
+{
+	return oaStreamedAttributes.GetSize();
+}
+
+inline boolean KWDatabaseMemoryGuard::AreStreamedAttributesComputed() const
+{
+	return kwoStreamedMainObject != NULL;
+}
+
+inline boolean KWDatabaseMemoryGuard::IsStreamedMainObject(const KWObject* kwoObject) const
+{
+	return kwoStreamedMainObject != NULL and kwoStreamedMainObject == kwoObject;
+}
+
 inline const longint KWDatabaseMemoryGuard::GetDefautMinSecondaryRecordNumberLowerBound()
 {
 	return lDefautMinSecondaryRecordNumberLowerBound;
@@ -20,21 +20,9 @@ boolean Date::Init(int nYear, int nMonth, int nDay)
 	// Le mois doit etre compris entre 1 et 12
 	else if (nMonth < 1 or nMonth > 12)
 		bOk = false;
-	// Le jour doit etre compris entre 1 et 31
-	else if (nDay < 1 or nDay > 31)
+	// Le jour doit etre compris entre 1 et le nombre de jours du mois, selon la table du calendrier
+	else if (nDay < 1 or nDay > DateTime::GetMonthDayNumber(nYear, nMonth))
 		bOk = false;
-	// Mois de 30 jours
-	else if (nMonth == 4 or nMonth == 6 or nMonth == 9 or nMonth == 11)
-		bOk = (nDay <= 30);
-	// Cas particulier du mois de fevrier
-	else if (nMonth == 2)
-	{
-		// Calcul des annees bissextiles
-		if (nYear % 4 == 0 and (nYear % 100 != 0 or nYear % 400 == 0))
-			bOk = (nDay <= 29);
-		else
-			bOk = (nDay <= 28);
-	}
 
 	// Initialisation si Ok
 	if (bOk)
@@ -53,7 +41,7 @@ boolean Date::IsBissextileYear() const
 	require(Check());
 
 	nYear = GetYear();
-	return (nYear % 4 == 0 and (nYear % 100 != 0 or nYear % 400 == 0));
+	return DateTime::IsBissextileYear(nYear);
 }
 
 int Date::GetYearDay() const
@@ -70,53 +58,9 @@ int Date::GetYearDay() const
 	nMonth = GetMonth();
 	nDay = GetDay();
 
-	// Calcul du jour dans l'annee (offset pour debut de mois)
-	switch (nMonth)
-	{
-	case 1:
-		nYearDay = 0;
-		break;
-	case 2:
-		nYearDay = 31;
-		break;
-	case 3:
-		nYearDay = 59;
-		break;
-	case 4:
-		nYearDay = 90;
-		break;
-	case 5:
-		nYearDay = 120;
-		break;
-	case 6:
-		nYearDay = 151;
-		break;
-	case 7:
-		nYearDay = 181;
-		break;
-	case 8:
-		nYearDay = 212;
-		break;
-	case 9:
-		nYearDay = 243;
-		break;
-	case 10:
-		nYearDay = 273;
-		break;
-	case 11:
-		nYearDay = 304;
-		break;
-	default:
-		nYearDay = 334;
-		break;
-	}
-
-	// Ajout des jours du mois
-	nYearDay += nDay;
-
-	// Prise en compte des annees bissextiles
-	if (nMonth > 2 and nYear % 4 == 0 and (nYear % 100 != 0 or nYear % 400 == 0))
-		nYearDay += 1;
+	// Calcul du jour dans l'annee, a partir de la table des jours cumules en debut de mois,
+	// en tenant compte des annees bissextiles
+	nYearDay = DateTime::GetYearDayOffset(nYear, nMonth) + nDay;
 	return nYearDay;
 }
 
@@ -143,7 +87,7 @@ double Date::GetDecimalYear() const
 
 	nYear = GetYear();
 	nDayNumber = 365;
-	if (nYear % 4 == 0 and (nYear % 100 != 0 or nYear % 400 == 0))
+	if (DateTime::IsBissextileYear(nYear))
 		nDayNumber += 1;
 	dDecimalYear = nYear + (GetYearDay() - 1.0) / nDayNumber;
 	return dDecimalYear;
@@ -524,83 +468,41 @@ boolean KWDateFormat::IsConsistentWith(const KWDateFormat* otherFormat) const
 
 Date KWDateFormat::StringToDate(const char* const sValue) const
 {
-	boolean bCheck = true;
+	require(sValue != NULL);
+	return StringToDate(sValue, (int)strlen(sValue));
+}
+
+Date KWDateFormat::StringToDate(const char* const sValue, int nLength) const
+{
 	Date dtConvertedString;
-	int nLength;
 	int nYear;
 	int nMonth;
 	int nDay;
-	char cChar0;
-	char cChar1;
-	char cChar2;
-	char cChar3;
 
 	require(Check());
 	require(sValue != NULL);
+	require(nLength >= 0);
 
 	// Initialisation
 	dtConvertedString.Reset();
-	nYear = 0;
-	nMonth = 0;
-	nDay = 0;
-
-	// Acces a la longueur de la valeur a convertir
-	nLength = (int)strlen(sValue);
 
 	// Test si longueur compatible
-	if (bCheck)
-		bCheck = (nLength == nTotalCharNumber);
+	if (nLength != nTotalCharNumber)
+		return dtConvertedString;
 
 	// Test des caracteres separateurs
-	if (bCheck)
-	{
-		if (cSeparatorChar != '\0')
-			bCheck =
-			    sValue[nSeparatorOffset1] == cSeparatorChar and sValue[nSeparatorOffset2] == cSeparatorChar;
-	}
-
-	// Recherche de l'annee
-	if (bCheck)
-	{
-		cChar0 = sValue[nYearOffset];
-		cChar1 = sValue[nYearOffset + 1];
-		cChar2 = sValue[nYearOffset + 2];
-		cChar3 = sValue[nYearOffset + 3];
-
-		// Test de validite
-		bCheck = isdigit(cChar0) and isdigit(cChar1) and isdigit(cChar2) and isdigit(cChar3);
-		if (bCheck)
-			nYear = 1000 * (cChar0 - '0') + 100 * (cChar1 - '0') + 10 * (cChar2 - '0') + (cChar3 - '0');
-	}
-
-	// Recherche du mois
-	if (bCheck)
-	{
-		cChar0 = sValue[nMonthOffset];
-		cChar1 = sValue[nMonthOffset + 1];
-
-		// Test de validite
-		bCheck = isdigit(cChar0) and isdigit(cChar1);
-		if (bCheck)
-			nMonth = 10 * (cChar0 - '0') + (cChar1 - '0');
-	}
-
-	// Recherche du jour
-	if (bCheck)
-	{
-		cChar0 = sValue[nDayOffset];
-		cChar1 = sValue[nDayOffset + 1];
-
-		// Test de validite
-		bCheck = isdigit(cChar0) and isdigit(cChar1);
-		if (bCheck)
-			nDay = 10 * (cChar0 - '0') + (cChar1 - '0');
-	}
-
-	// Conversion vers la date
-	if (bCheck)
-		dtConvertedString.Init(nYear, nMonth, nDay);
-
+	if (cSeparatorChar != '\0' and
+	    (sValue[nSeparatorOffset1] != cSeparatorChar or sValue[nSeparatorOffset2] != cSeparatorChar))
+		return dtConvertedString;
+
+	// Extraction des champs a leur position fixe dans le format, chaque champ valant -1 en cas
+	// de caractere non numerique
+	nYear = DateTime::ParseFourDigits(&sValue[nYearOffset]);
+	nMonth = DateTime::ParseTwoDigits(&sValue[nMonthOffset]);
+	nDay = DateTime::ParseTwoDigits(&sValue[nDayOffset]);
+
+	// Conversion vers la date, qui est invalide si l'un des champs est invalide
+	dtConvertedString.Init(nYear, nMonth, nDay);
 	return dtConvertedString;
 }
 
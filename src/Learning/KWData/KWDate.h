@@ -224,6 +224,11 @@ public:
 	// La date est invalide en cas de probleme de conversion
 	Date StringToDate(const char* const sValue) const;
 
+	// Variante ne convertissant que les nLength premiers caracteres de la chaine, sans avoir besoin
+	// que celle-ci se termine a cette longueur
+	// Permet d'eviter le recalcul de la longueur ou la copie d'une sous-chaine
+	Date StringToDate(const char* const sValue, int nLength) const;
+
 	// Renvoie une chaine a partir d'une date
 	// Renvoie la chaine vide si la date est invalide
 	const char* const DateToString(Date dtValue) const;
@@ -4,6 +4,10 @@
 
 #include "KWDateTime.h"
 
+const int DateTime::nMonthDayNumbers[13] = {0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+const int DateTime::nCumulatedMonthDayNumbers[13] = {0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+
 void DateTime::Test()
 {
 	DateTime dtDateTimeValue;
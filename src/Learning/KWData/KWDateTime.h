@@ -25,7 +25,9 @@ protected:
 	friend class Time;
 	friend class Timestamp;
 	friend class TimestampTZ;
+	friend class KWDateFormat;
 	friend class KWTimeFormat;
+	friend class KWTimestampTZFormat;
 
 	// Affichage detaille de tous les champs
 	void WriteInternalFields(ostream& ost) const;
@@ -103,6 +105,32 @@ protected:
 
 	// Constante utilisee pour gerer la valeur interdite de tous les types date time
 	static const longint lForbiddenValue = 0xFFFFFFFFFFFFFFFF;
+
+	//////////////////////////////////////////////////////////////////////////
+	// Services partages de calendrier et de conversion de chiffres, utilises
+	// par les classes de date et par leurs formats de conversion
+
+	// Test si une annee est bissextile
+	static boolean IsBissextileYear(int nYear);
+
+	// Nombre de jours d'un mois (entre 1 et 12) pour une annee donnee
+	static int GetMonthDayNumber(int nYear, int nMonth);
+
+	// Nombre de jours de l'annee precedant le premier jour d'un mois (entre 1 et 12)
+	static int GetYearDayOffset(int nYear, int nMonth);
+
+	// Conversion de deux ou quatre chiffres consecutifs en entier
+	// Renvoie -1 si l'un des caracteres n'est pas un chiffre
+	// Le test des chiffres se fait sans branchement, par comparaison non signee, ce qui est plus rapide
+	// que des appels successifs a isdigit
+	static int ParseTwoDigits(const char* sValue);
+	static int ParseFourDigits(const char* sValue);
+
+	// Table des nombres de jours par mois, pour une annee non bissextile (index 0 inutilise)
+	static const int nMonthDayNumbers[13];
+
+	// Table des nombres de jours cumules precedant chaque mois, pour une annee non bissextile
+	static const int nCumulatedMonthDayNumbers[13];
 };
 
 ////////////////////////////////////////////////
@@ -130,3 +158,60 @@ inline int DateTime::GetTimeZoneMinute() const
 {
 	return 4 * fields.nTimeZoneMinute1 + fields.nTimeZoneMinute2;
 }
+
+inline boolean DateTime::IsBissextileYear(int nYear)
+{
+	return (nYear % 4 == 0 and (nYear % 100 != 0 or nYear % 400 == 0));
+}
+
+inline int DateTime::GetMonthDayNumber(int nYear, int nMonth)
+{
+	require(1 <= nMonth and nMonth <= 12);
+	if (nMonth == 2 and IsBissextileYear(nYear))
+		return 29;
+	else
+		return nMonthDayNumbers[nMonth];
+}
+
+inline int DateTime::GetYearDayOffset(int nYear, int nMonth)
+{
+	require(1 <= nMonth and nMonth <= 12);
+	if (nMonth > 2 and IsBissextileYear(nYear))
+		return nCumulatedMonthDayNumbers[nMonth] + 1;
+	else
+		return nCumulatedMonthDayNumbers[nMonth];
+}
+
+inline int DateTime::ParseTwoDigits(const char* sValue)
+{
+	unsigned int nDigit0;
+	unsigned int nDigit1;
+
+	require(sValue != NULL);
+
+	// Les caracteres non chiffres donnent une valeur non signee superieure a 9
+	nDigit0 = (unsigned int)((unsigned char)sValue[0] - '0');
+	nDigit1 = (unsigned int)((unsigned char)sValue[1] - '0');
+	if ((nDigit0 > 9) | (nDigit1 > 9))
+		return -1;
+	return (int)(10 * nDigit0 + nDigit1);
+}
+
+inline int DateTime::ParseFourDigits(const char* sValue)
+{
+	unsigned int nDigit0;
+	unsigned int nDigit1;
+	unsigned int nDigit2;
+	unsigned int nDigit3;
+
+	require(sValue != NULL);
+
+	// Les caracteres non chiffres donnent une valeur non signee superieure a 9
+	nDigit0 = (unsigned int)((unsigned char)sValue[0] - '0');
+	nDigit1 = (unsigned int)((unsigned char)sValue[1] - '0');
+	nDigit2 = (unsigned int)((unsigned char)sValue[2] - '0');
+	nDigit3 = (unsigned int)((unsigned char)sValue[3] - '0');
+	if ((nDigit0 > 9) | (nDigit1 > 9) | (nDigit2 > 9) | (nDigit3 > 9))
+		return -1;
+	return (int)(1000 * nDigit0 + 100 * nDigit1 + 10 * nDigit2 + nDigit3);
+}
@@ -488,8 +488,21 @@ boolean KWDerivationRule::CheckOperandsDefinition() const
 
 boolean KWDerivationRule::CheckFamily(const KWDerivationRule* ruleFamily) const
 {
+	boolean bResult;
+
 	// On teste d'abord les operandes, qui peuvent etre a l'origine d'erreurs sur la regle elle-meme
-	return CheckOperandsFamily(ruleFamily) and CheckRuleFamily(ruleFamily);
+	// Si la definition de la regle est valide, celle de toutes ses sous-regles l'est egalement, et on evite
+	// de la reverifier a chaque niveau d'imbrication lors de la verification des operandes
+	if (not bOperandRulesDefinitionChecked and SilentCheckDefinition())
+	{
+		bOperandRulesDefinitionChecked = true;
+		bResult = CheckOperandsFamily(ruleFamily);
+		bOperandRulesDefinitionChecked = false;
+		bResult = bResult and CheckRuleFamily(ruleFamily);
+	}
+	else
+		bResult = CheckOperandsFamily(ruleFamily) and CheckRuleFamily(ruleFamily);
+	return bResult;
 }
 
 boolean KWDerivationRule::CheckRuleFamily(const KWDerivationRule* ruleFamily) const
@@ -501,7 +514,7 @@ boolean KWDerivationRule::CheckRuleFamily(const KWDerivationRule* ruleFamily) co
 	require(ruleFamily->CheckDefinition());
 
 	// Test de definition de la regle: arret si incorrect
-	if (not CheckDefinition())
+	if (not bOperandRulesDefinitionChecked and not CheckDefinition())
 		return false;
 
 	// Nom de la regle
@@ -608,8 +621,20 @@ boolean KWDerivationRule::CheckOperandsFamily(const KWDerivationRule* ruleFamily
 
 boolean KWDerivationRule::CheckCompleteness(const KWClass* kwcOwnerClass) const
 {
+	boolean bResult;
+
 	// On teste d'abord les operandes, qui peuvent etre a l'origine d'erreurs sur la regle elle-meme
-	return CheckOperandsCompleteness(kwcOwnerClass) and CheckRuleCompletness(kwcOwnerClass);
+	// On evite comme dans CheckFamily de reverifier la definition des sous-regles si elle est valide
+	if (not bOperandRulesDefinitionChecked and SilentCheckDefinition())
+	{
+		bOperandRulesDefinitionChecked = true;
+		bResult = CheckOperandsCompleteness(kwcOwnerClass);
+		bOperandRulesDefinitionChecked = false;
+		bResult = bResult and CheckRuleCompletness(kwcOwnerClass);
+	}
+	else
+		bResult = CheckOperandsCompleteness(kwcOwnerClass) and CheckRuleCompletness(kwcOwnerClass);
+	return bResult;
 }
 
 boolean KWDerivationRule::CheckRuleCompletness(const KWClass* kwcOwnerClass) const
@@ -621,7 +646,7 @@ boolean KWDerivationRule::CheckRuleCompletness(const KWClass* kwcOwnerClass) con
 	require(kwcOwnerClass->GetDomain() != NULL);
 
 	// Test de definition de la regle: arret si incorrect
-	if (not CheckDefinition())
+	if (not bOperandRulesDefinitionChecked and not CheckDefinition())
 		return false;
 
 	// Nom de la classe pour un type Object
@@ -1162,6 +1187,28 @@ boolean KWDerivationRule::GetCheckTolerance() const
 	return bCheckTolerance;
 }
 
+void KWDerivationRule::SetOperandRulesDefinitionChecked(boolean bValue)
+{
+	bOperandRulesDefinitionChecked = bValue;
+}
+
+boolean KWDerivationRule::GetOperandRulesDefinitionChecked()
+{
+	return bOperandRulesDefinitionChecked;
+}
+
+boolean KWDerivationRule::SilentCheckDefinition() const
+{
+	boolean bOk;
+	boolean bSilentMode;
+
+	bSilentMode = Global::GetSilentMode();
+	Global::SetSilentMode(true);
+	bOk = CheckDefinition();
+	Global::SetSilentMode(bSilentMode);
+	return bOk;
+}
+
 void KWDerivationRule::Compile(KWClass* kwcOwnerClass)
 {
 	KWDerivationRuleOperand* operand;
@@ -1249,6 +1296,53 @@ void KWDerivationRule::Compile(KWClass* kwcOwnerClass)
 	ensure(IsCompiled());
 }
 
+const ALString KWDerivationRule::GetSharedComputationKey() const
+{
+	return "";
+}
+
+KWDRSharedComputation* KWDerivationRule::CreateSharedComputation() const
+{
+	// Doit etre reimplemente si la cle de partage est non vide
+	assert(false);
+	return NULL;
+}
+
+void KWDerivationRule::SetSharedComputation(KWDRSharedComputation* sharedComputation)
+{
+	// Doit etre reimplemente si la cle de partage est non vide
+	(void)sharedComputation; // Pour eviter le warning
+	assert(false);
+}
+
+const ALString KWDerivationRule::GetStreamedTableAttributeName() const
+{
+	return "";
+}
+
+KWDRSharedComputation* KWDerivationRule::CreateStreamedComputation() const
+{
+	// Doit etre reimplemente si le calcul en flux est possible
+	assert(false);
+	return NULL;
+}
+
+Continuous KWDerivationRule::ComputeContinuousStreamedResult(KWDRSharedComputation* streamedComputation) const
+{
+	// Doit etre reimplemente si le calcul en flux est possible et si le type est Continuous
+	(void)streamedComputation; // Pour eviter le warning
+	assert(false);
+	return KWContinuous::GetMissingValue();
+}
+
+Symbol KWDerivationRule::ComputeSymbolStreamedResult(KWDRSharedComputation* streamedComputation) const
+{
+	// Doit etre reimplemente si le calcul en flux est possible et si le type est Symbol
+	(void)streamedComputation; // Pour eviter le warning
+	assert(false);
+	return Symbol();
+}
+
 Continuous KWDerivationRule::ComputeContinuousResult(const KWObject* kwoObject) const
 {
 	// Doit etre reimplemente si le type est Continuous
@@ -2183,6 +2277,8 @@ void KWDerivationRule::DeleteAllDerivationRules()
 
 ObjectDictionary* KWDerivationRule::odDerivationRules = NULL;
 
+boolean KWDerivationRule::bOperandRulesDefinitionChecked = false;
+
 boolean KWDerivationRule::IsStructureRule() const
 {
 	return false;
@@ -2207,3 +2303,30 @@ int KWDerivationRuleFullCompare(const void* elem1, const void* elem2)
 	nDiff = rule1->FullCompare(rule2);
 	return nDiff;
 }
+
+//////////////////////////////////////////////////////////////////////////////
+// Classe KWDRSharedComputation
+
+KWDRSharedComputation::KWDRSharedComputation()
+{
+	kwoComputedObject = NULL;
+}
+
+KWDRSharedComputation::~KWDRSharedComputation() {}
+
+void KWDRSharedComputation::Reset()
+{
+	kwoComputedObject = NULL;
+}
+
+void KWDRSharedComputation::AddStreamedObject(const KWObject* kwoSubObject)
+{
+	// Doit etre reimplemente pour les calculs en flux
+	(void)kwoSubObject; // Pour eviter le warning
+	assert(false);
+}
+
+const ALString KWDRSharedComputation::GetClassLabel() const
+{
+	return "Shared computation";
+}
@@ -11,6 +11,7 @@ class KWObject;
 class KWObjectKey;
 class KWDerivationRule;
 class KWDerivationRuleOperand;
+class KWDRSharedComputation;
 class KWDatabase;
 
 #include "Object.h"
@@ -360,6 +361,38 @@ public:
 	// Methode avancee
 	const KWClass* GetOwnerClass() const;
 
+	// Partage de calculs entre les regles des attributs d'une meme classe
+	// Apres la compilation de ses attributs, une classe regroupe les regles de ses attributs ayant la meme
+	// cle de partage non vide, et attribue a chaque groupe d'au moins deux regles un objet de calcul partage,
+	// cree par la premiere regle du groupe (cf. KWClass::Compile)
+	// Cela permet par exemple a des regles de stats portant sur une meme table et un meme attribut secondaire
+	// de ne parcourir la table qu'une seule fois par objet
+	// Methodes avancees, a redefinir ensemble:
+	//  . GetSharedComputationKey: cle de partage, uniquement apres compilation (par defaut: vide, pas de partage)
+	//  . CreateSharedComputation: creation d'un objet de calcul partage
+	//  . SetSharedComputation: parametrage de l'objet de calcul partage, a remettre a NULL lors de la compilation
+	// Memoire: l'objet de calcul partage appartient a la classe
+	virtual const ALString GetSharedComputationKey() const;
+	virtual KWDRSharedComputation* CreateSharedComputation() const;
+	virtual void SetSharedComputation(KWDRSharedComputation* sharedComputation);
+
+	// Calcul en flux d'une regle portant sur une table secondaire native de sa classe
+	// Cela permet de calculer exactement la valeur de la regle pour une instance dont les enregistrements
+	// secondaires ne tiennent pas en memoire (cf. KWDatabaseMemoryGuard), en accumulant les sous-objets au fur
+	// et a mesure de leur lecture, avant leur destruction
+	// Methodes avancees, a redefinir ensemble:
+	//  . GetStreamedTableAttributeName: nom de l'attribut table natif dont les sous-objets sont a accumuler,
+	//    uniquement apres compilation (par defaut: vide, pas de calcul en flux)
+	//  . CreateStreamedComputation: creation d'un objet de calcul accumulant les sous-objets
+	//    (cf. KWDRSharedComputation::AddStreamedObject)
+	//  . ComputeContinuousStreamedResult, ComputeSymbolStreamedResult: calcul de la valeur resultat a partir
+	//    de l'objet de calcul, seule la variante compatible avec le type de la regle etant a reimplementer
+	// Memoire: l'objet de calcul en flux appartient a l'appelant
+	virtual const ALString GetStreamedTableAttributeName() const;
+	virtual KWDRSharedComputation* CreateStreamedComputation() const;
+	virtual Continuous ComputeContinuousStreamedResult(KWDRSharedComputation* streamedComputation) const;
+	virtual Symbol ComputeSymbolStreamedResult(KWDRSharedComputation* streamedComputation) const;
+
 	// Calcul de la valeur resultat de la regle
 	// Attention, seule la variante compatible avec le type de la regle
 	// doit etre reimplementee
@@ -528,6 +561,14 @@ public:
 	void SetCheckTolerance(boolean bValue);
 	boolean GetCheckTolerance() const;
 
+	// Indicateur de verification prealable de la definition des regles utilisees dans les operandes (defaut: false)
+	// Quand il est positionne, les verifications d'une regle ne reverifient pas la definition de ses sous-regles
+	// a chaque niveau d'imbrication, ce qui rend le cout de verification lineaire dans la taille de la regle,
+	// au lieu d'etre proportionnel au produit de sa taille par sa profondeur
+	// Ne doit etre positionne que si la definition des sous-regles a effectivement deja ete verifiee
+	static void SetOperandRulesDefinitionChecked(boolean bValue);
+	static boolean GetOperandRulesDefinitionChecked();
+
 protected:
 	///////////////////////////////////////////////////////////////////////////
 	// Service de gestion des regles a scope multiple
@@ -635,8 +676,14 @@ protected:
 	// pour la rendre plus efficace, en acceptant une certaine tolerance dans la verification de la regle
 	boolean bCheckTolerance;
 
+	// Verification de la definition de la regle, sans emission de message
+	boolean SilentCheckDefinition() const;
+
 	// Administration des objets regles
 	static ObjectDictionary* odDerivationRules;
+
+	// Indicateur de verification prealable de la definition des regles utilisees dans les operandes
+	static boolean bOperandRulesDefinitionChecked;
 };
 
 // Methode de comparaison entre deux regles (cf KWDerivationRule::FullCompare)
@@ -914,6 +961,44 @@ protected:
 	debug(int nCompileFreshness);
 };
 
+//////////////////////////////////////////////////////////////////////////////
+// Classe KWDRSharedComputation
+// Classe ancetre des calculs partages entre plusieurs regles de derivation d'une meme classe
+// (cf. KWDerivationRule::GetSharedComputationKey)
+// Les resultats d'un calcul partage sont bufferises pour le dernier objet traite. Ils sont recalcules
+// quand les regles sont appliquees a un autre objet, et reinitialises quand l'objet est detruit ou change
+// de classe (cf. KWObject), pour ne jamais etre reutilises par un nouvel objet alloue a la meme adresse
+class KWDRSharedComputation : public Object
+{
+public:
+	// Constructeur
+	KWDRSharedComputation();
+	~KWDRSharedComputation();
+
+	// Objet pour lequel le calcul est bufferise (NULL si aucun)
+	void SetComputedObject(const KWObject* kwoObject);
+	const KWObject* GetComputedObject() const;
+
+	// Reinitialisation du calcul bufferise
+	// Doit etre reimplementee dans les sous-classes pour nettoyer les resultats, en appelant la methode ancetre
+	virtual void Reset();
+
+	// Accumulation d'un sous-objet pour un calcul en flux (cf. KWDerivationRule::CreateStreamedComputation)
+	// L'objet de calcul doit avoir ete reinitialise au prealable, avec pour objet calcule l'objet
+	// dont on accumule les sous-objets
+	// Doit etre reimplementee dans les sous-classes creees pour un calcul en flux
+	virtual void AddStreamedObject(const KWObject* kwoSubObject);
+
+	// Libelles utilisateurs
+	const ALString GetClassLabel() const override;
+
+	///////////////////////////////////////////////////////////////////////////////
+	///// Implementation
+protected:
+	// Objet pour lequel le calcul est bufferise
+	const KWObject* kwoComputedObject;
+};
+
 #include "KWClass.h"
 #include "KWObject.h"
 #include "KWDatabase.h"
@@ -1512,6 +1597,16 @@ inline KWObjectArrayValueBlock* KWDerivationRuleOperand::GetObjectArrayValueBloc
 		    : kwvConstant.GetObjectArrayValueBlock());
 }
 
+inline void KWDRSharedComputation::SetComputedObject(const KWObject* kwoObject)
+{
+	kwoComputedObject = kwoObject;
+}
+
+inline const KWObject* KWDRSharedComputation::GetComputedObject() const
+{
+	return kwoComputedObject;
+}
+
 debug(inline int KWDerivationRuleOperand::GetFreshness() const { return nFreshness; })
 
     debug(inline boolean KWDerivationRuleOperand::IsCompiled() const {
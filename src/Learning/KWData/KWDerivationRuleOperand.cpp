@@ -100,7 +100,6 @@ const ALString KWDerivationRuleOperand::GetExternalStringConstant() const
 boolean KWDerivationRuleOperand::CheckDefinition() const
 {
 	boolean bResult = true;
-	ALString sOperandOrigin;
 
 	// Type
 	if (GetType() != KWType::Unknown and not KWType::Check(GetType()))
@@ -137,25 +136,24 @@ boolean KWDerivationRuleOperand::CheckDefinition() const
 	       GetOrigin() == OriginAny);
 
 	// Verification de coherence entre type d'origine et parametre de l'origine
-	sOperandOrigin = OriginToString(GetOrigin(), GetType());
 	if (GetOrigin() == OriginAny and GetDataItemName() != "")
 		AddWarning(GetDataItemLabel() + " name specified (" + GetDataItemName() +
-			   ") for an operand with origin " + sOperandOrigin);
+			   ") for an operand with origin " + OriginToString(GetOrigin(), GetType()));
 	if (GetOrigin() == OriginAny and GetDerivationRule() != NULL)
 		AddWarning("Rule specified (" + GetDerivationRule()->GetName() + ") for an operand with origin " +
-			   sOperandOrigin);
+			   OriginToString(GetOrigin(), GetType()));
 	if (GetOrigin() == OriginConstant and GetDataItemName() != "")
 		AddWarning(GetDataItemLabel() + " name specified (" + GetDataItemName() +
-			   ") for an operand with origin " + sOperandOrigin);
+			   ") for an operand with origin " + OriginToString(GetOrigin(), GetType()));
 	if (GetOrigin() == OriginConstant and GetDerivationRule() != NULL)
 		AddWarning("Rule specified (" + GetDerivationRule()->GetName() + ") for an operand with origin " +
-			   sOperandOrigin);
+			   OriginToString(GetOrigin(), GetType()));
 	if (GetOrigin() == OriginAttribute and GetDerivationRule() != NULL)
 		AddWarning("Rule specified (" + GetDerivationRule()->GetName() + ") for an operand with origin " +
-			   sOperandOrigin);
+			   OriginToString(GetOrigin(), GetType()));
 	if (GetOrigin() == OriginRule and GetDataItemName() != "")
 		AddWarning(GetDataItemLabel() + " name specified (" + GetDataItemName() +
-			   ") for an operand with origin " + sOperandOrigin);
+			   ") for an operand with origin " + OriginToString(GetOrigin(), GetType()));
 
 	// Verification eventuelle du type de constante
 	if (GetOrigin() == OriginConstant and not KWType::IsSimple(GetType()))
@@ -189,8 +187,9 @@ boolean KWDerivationRuleOperand::CheckDefinition() const
 		bResult = false;
 	}
 
-	// Verification eventuelle de la regle
-	if (GetOrigin() == OriginRule and GetDerivationRule() != NULL and not GetDerivationRule()->CheckDefinition())
+	// Verification eventuelle de la regle, sauf si sa definition a deja ete verifiee
+	if (GetOrigin() == OriginRule and GetDerivationRule() != NULL and
+	    not KWDerivationRule::GetOperandRulesDefinitionChecked() and not GetDerivationRule()->CheckDefinition())
 	{
 		AddError("Incorrect rule used in the operand");
 		bResult = false;
@@ -315,7 +314,7 @@ boolean KWDerivationRuleOperand::CheckCompleteness(const KWClass* kwcOwnerClass)
 	require(kwcOwnerClass->GetDomain() != NULL);
 
 	// Test de definition de la regle: arret si incorrect
-	if (not CheckDefinition())
+	if (not KWDerivationRule::GetOperandRulesDefinitionChecked() and not CheckDefinition())
 		return false;
 
 	// Un type valide est specifie a ce niveau, sauf dans le cas d'operandes multiples avec type Unknown
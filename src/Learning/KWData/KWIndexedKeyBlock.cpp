@@ -22,6 +22,10 @@ void KWIndexedCKeyBlock::Clean()
 {
 	nkdKeyIndexes.RemoveAll();
 	oaKeyIndexes.DeleteAll();
+	ivKeyCharsHashTable.SetSize(0);
+	ivKeyCharsHashValues.SetSize(0);
+	ivKeyReadStamps.SetSize(0);
+	nKeyReadStamp = 0;
 }
 
 boolean KWIndexedCKeyBlock::IndexKeys()
@@ -47,6 +51,35 @@ void KWIndexedCKeyBlock::AddKey(const Symbol& sKey)
 	// Ajout dans les containeurs
 	oaKeyIndexes.Add(keyIndex);
 	nkdKeyIndexes.SetAt(sKey.GetNumericKey(), keyIndex);
+
+	// Ajout dans la table de hash des caracteres des cles, en la retaillant si elle est trop remplie
+	ivKeyCharsHashValues.Add(ComputeKeyCharsHashValue(sKey.GetValue(), sKey.GetLength()));
+	if (2 * oaKeyIndexes.GetSize() > ivKeyCharsHashTable.GetSize())
+		ResizeKeyCharsHashTable(max(16, 2 * ivKeyCharsHashTable.GetSize()));
+	else
+		InsertKeyCharsHashTable(oaKeyIndexes.GetSize() - 1);
+	ensure(GetKeyIndexFromChars(sKey.GetValue(), sKey.GetLength()) == oaKeyIndexes.GetSize() - 1);
+}
+
+void KWIndexedCKeyBlock::BeginKeyReading() const
+{
+	// Dimensionnement des marques si necessaire, toutes les cles etant alors non marquees
+	if (ivKeyReadStamps.GetSize() != GetKeyNumber())
+	{
+		ivKeyReadStamps.SetSize(GetKeyNumber());
+		ivKeyReadStamps.Initialize();
+		nKeyReadStamp = 0;
+	}
+
+	// Reinitialisation complete dans le cas tres rare ou on a atteint la valeur max des marques
+	if (nKeyReadStamp == INT_MAX)
+	{
+		ivKeyReadStamps.Initialize();
+		nKeyReadStamp = 0;
+	}
+
+	// Nouvelle marque courante, qu'aucune cle ne possede
+	nKeyReadStamp++;
 }
 
 void KWIndexedCKeyBlock::Write(ostream& ost) const
@@ -73,7 +106,9 @@ void KWIndexedCKeyBlock::Write(ostream& ost) const
 longint KWIndexedCKeyBlock::GetUsedMemory() const
 {
 	return sizeof(KWIndexedCKeyBlock) + GetKeyNumber() * sizeof(KWKeyIndex) + oaKeyIndexes.GetUsedMemory() -
-	       sizeof(ObjectArray) + nkdKeyIndexes.GetUsedMemory() - sizeof(NumericKeyDictionary);
+	       sizeof(ObjectArray) + nkdKeyIndexes.GetUsedMemory() - sizeof(CompactNumericKeyDictionary) +
+	       ivKeyCharsHashTable.GetUsedMemory() - sizeof(IntVector) + ivKeyCharsHashValues.GetUsedMemory() -
+	       sizeof(IntVector) + ivKeyReadStamps.GetUsedMemory() - sizeof(IntVector);
 }
 
 const ALString KWIndexedCKeyBlock::GetClassLabel() const
@@ -81,6 +116,36 @@ const ALString KWIndexedCKeyBlock::GetClassLabel() const
 	return "Indexed key block";
 }
 
+void KWIndexedCKeyBlock::ResizeKeyCharsHashTable(int nSize)
+{
+	int nKeyIndex;
+
+	require(nSize > 0 and (nSize & (nSize - 1)) == 0);
+	require(2 * GetKeyNumber() <= nSize);
+
+	// Reinitialisation de la table, puis insertion de toutes les cles
+	ivKeyCharsHashTable.SetSize(nSize);
+	ivKeyCharsHashTable.Initialize();
+	for (nKeyIndex = 0; nKeyIndex < GetKeyNumber(); nKeyIndex++)
+		InsertKeyCharsHashTable(nKeyIndex);
+}
+
+void KWIndexedCKeyBlock::InsertKeyCharsHashTable(int nKeyIndex)
+{
+	int nMask;
+	int nSlot;
+
+	require(0 <= nKeyIndex and nKeyIndex < GetKeyNumber());
+	require(ivKeyCharsHashValues.GetSize() == GetKeyNumber());
+
+	// Recherche du premier emplacement libre a partir de l'emplacement initial
+	nMask = ivKeyCharsHashTable.GetSize() - 1;
+	nSlot = ivKeyCharsHashValues.GetAt(nKeyIndex) & nMask;
+	while (ivKeyCharsHashTable.GetAt(nSlot) != 0)
+		nSlot = (nSlot + 1) & nMask;
+	ivKeyCharsHashTable.SetAt(nSlot, nKeyIndex + 1);
+}
+
 void KWIndexedCKeyBlock::Test()
 {
 	KWIndexedCKeyBlock indexedKeyBlock;
@@ -14,6 +14,7 @@ class KWObjectArrayKeyIndex;
 #include "KWContinuous.h"
 #include "KWType.h"
 #include "Object.h"
+#include "CompactNumericKeyDictionary.h"
 #include "Vector.h"
 #include "KWSortableIndex.h"
 
@@ -83,6 +84,25 @@ public:
 	// Acces aux cles par index (entre 0 et KeyNumber)
 	Symbol& GetKeyAt(int nIndex) const;
 
+	// Acces a l'index associe a une cle donnee par ses caracteres (-1 si cle absente)
+	// Permet de rechercher une cle lue dans un champ sans la recopier ni creer de Symbol,
+	// ce qui evite notamment d'inserer les cles inconnues dans le dictionnaire des Symbol
+	int GetKeyIndexFromChars(const char* sKeyChars, int nLength) const;
+
+	///////////////////////////////////////////////////////////////////
+	// Marquage des cles lues lors de l'analyse d'un champ de valeurs sparse,
+	// pour la detection des cles utilisees plusieurs fois
+	// Le marquage est reinitialise en temps constant a chaque debut de lecture
+
+	// Debut de lecture d'un champ: toutes les cles sont non marquees
+	void BeginKeyReading() const;
+
+	// Test si une cle est marquee, par son index
+	boolean IsReadKeyIndexMarked(int nKeyIndex) const;
+
+	// Marquage d'une cle par son index
+	void MarkReadKeyIndex(int nKeyIndex) const;
+
 	////////////////////////////////////////////////////////////////
 	// Services divers
 
@@ -105,10 +125,33 @@ protected:
 	// Les cles categorielles sont gerees au moyen d'un dictionnaire
 	// a cles numerique, efficace en temps de calcul, mais avec une
 	// empreinte memoire non negligeable
+	// On utilise un dictionnaire par adressage ouvert, sollicite a chaque
+	// recherche de cle lors de la lecture des blocs sparse, et jamais parcouru
 
 	// Tableau et dictionnaire des paires (index, cles) contenant des KWKeyIndex
 	ObjectArray oaKeyIndexes;
-	NumericKeyDictionary nkdKeyIndexes;
+	CompactNumericKeyDictionary nkdKeyIndexes;
+
+	// Calcul de la valeur de hash des caracteres d'une cle
+	static int ComputeKeyCharsHashValue(const char* sKeyChars, int nLength);
+
+	// Retaillage de la table de hash des caracteres des cles, et insertion de toutes les cles
+	void ResizeKeyCharsHashTable(int nSize);
+
+	// Insertion d'une cle, par son index, dans la table de hash des caracteres des cles
+	void InsertKeyCharsHashTable(int nKeyIndex);
+
+	// Table de hash par adressage ouvert des caracteres des cles, alimentee au fur et a mesure
+	// de l'ajout des cles, de taille puissance de 2 et remplie au plus a moitie
+	// Chaque emplacement contient l'index de la cle plus 1, ou 0 si l'emplacement est libre
+	IntVector ivKeyCharsHashTable;
+
+	// Valeur de hash des caracteres de chaque cle, par index de cle
+	IntVector ivKeyCharsHashValues;
+
+	// Marques de lecture des cles, par index de cle: une cle est marquee si sa marque vaut la marque courante
+	mutable IntVector ivKeyReadStamps;
+	mutable int nKeyReadStamp;
 };
 
 //////////////////////////////////////////////////////////////////
@@ -366,7 +409,10 @@ protected:
 
 // Classe KWIndexedCKeyBlock
 
-inline KWIndexedCKeyBlock::KWIndexedCKeyBlock() {}
+inline KWIndexedCKeyBlock::KWIndexedCKeyBlock()
+{
+	nKeyReadStamp = 0;
+}
 
 inline boolean KWIndexedCKeyBlock::IsKeyPresent(const Symbol& sKey) const
 {
@@ -402,6 +448,77 @@ inline Symbol& KWIndexedCKeyBlock::GetKeyAt(int nIndex) const
 	return keyIndex->GetKey();
 }
 
+inline int KWIndexedCKeyBlock::GetKeyIndexFromChars(const char* sKeyChars, int nLength) const
+{
+	int nHashValue;
+	int nMask;
+	int nSlot;
+	int nKeyIndex;
+	const Symbol* sKey;
+
+	require(sKeyChars != NULL);
+	require(nLength >= 0);
+
+	// Cas d'un bloc sans cle
+	if (ivKeyCharsHashTable.GetSize() == 0)
+		return -1;
+
+	// Parcours des emplacements a partir de l'emplacement initial, jusqu'a un emplacement vide
+	nHashValue = ComputeKeyCharsHashValue(sKeyChars, nLength);
+	nMask = ivKeyCharsHashTable.GetSize() - 1;
+	nSlot = nHashValue & nMask;
+	while (ivKeyCharsHashTable.GetAt(nSlot) != 0)
+	{
+		nKeyIndex = ivKeyCharsHashTable.GetAt(nSlot) - 1;
+
+		// Comparaison des caracteres uniquement si les valeurs de hash sont egales
+		if (ivKeyCharsHashValues.GetAt(nKeyIndex) == nHashValue)
+		{
+			sKey = &GetKeyAt(nKeyIndex);
+			if (sKey->GetLength() == nLength and memcmp(sKey->GetValue(), sKeyChars, nLength) == 0)
+				return nKeyIndex;
+		}
+		nSlot = (nSlot + 1) & nMask;
+	}
+	return -1;
+}
+
+inline boolean KWIndexedCKeyBlock::IsReadKeyIndexMarked(int nKeyIndex) const
+{
+	require(0 <= nKeyIndex and nKeyIndex < GetKeyNumber());
+	require(ivKeyReadStamps.GetSize() == GetKeyNumber());
+	require(nKeyReadStamp > 0);
+	return ivKeyReadStamps.GetAt(nKeyIndex) == nKeyReadStamp;
+}
+
+inline void KWIndexedCKeyBlock::MarkReadKeyIndex(int nKeyIndex) const
+{
+	require(0 <= nKeyIndex and nKeyIndex < GetKeyNumber());
+	require(ivKeyReadStamps.GetSize() == GetKeyNumber());
+	require(nKeyReadStamp > 0);
+	ivKeyReadStamps.SetAt(nKeyIndex, nKeyReadStamp);
+}
+
+inline int KWIndexedCKeyBlock::ComputeKeyCharsHashValue(const char* sKeyChars, int nLength)
+{
+	unsigned int nHash;
+	int i;
+
+	// Fonction de hash Jenkins one at a time, comme pour HashValue, sur une plage de caracteres
+	// Le resultat est positif, pour pouvoir servir directement d'index
+	nHash = 0;
+	for (i = 0; i < nLength; i++)
+	{
+		nHash += sKeyChars[i];
+		nHash += (nHash << 10);
+		nHash ^= (nHash >> 6);
+	}
+	nHash += (nHash << 3);
+	nHash ^= (nHash >> 11);
+	nHash += (nHash << 15);
+	return (int)(nHash & INT_MAX);
+}
+
 // Classe KWIndexedNKeyBlock
 
 inline KWIndexedNKeyBlock::KWIndexedNKeyBlock() {}
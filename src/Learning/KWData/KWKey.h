@@ -41,6 +41,10 @@ public:
 	// Comparaison avec une autre cle
 	int Compare(const KWKey*) const;
 
+	// Valeur de hashage de la cle, ne dependant que de la valeur de ses champs
+	// (identique d'un processus ou d'un fichier a l'autre pour une meme cle)
+	longint ComputeHashValue() const;
+
 	// Memoire utilisee
 	longint GetUsedMemory() const override;
 
@@ -226,6 +230,17 @@ inline int KWKey::Compare(const KWKey* key) const
 	return 0;
 }
 
+inline longint KWKey::ComputeHashValue() const
+{
+	longint lHashValue;
+	int i;
+
+	lHashValue = 0;
+	for (i = 0; i < GetSize(); i++)
+		lHashValue = LongintUpdateHashValue(lHashValue, (unsigned int)HashValue(GetAt(i)));
+	return lHashValue;
+}
+
 inline longint KWKey::GetUsedMemory() const
 {
 	return sizeof(KWKey) + svFields.GetUsedMemory() - sizeof(StringVector);
@@ -809,6 +809,10 @@ boolean KWMTDatabase::PhysicalOpenForRead()
 			bOk = PhysicalReadAllReferenceObjects(lRemainingMemory, lExternalTableUsedMemory,
 							      lTotalExternalObjectNumber, bMemoryLimitReached);
 		}
+
+		// Initialisation des attributs calculables en flux en cas de depassement memoire
+		if (bOk)
+			memoryGuard.InitializeStreamedAttributes(kwcPhysicalClass);
 	}
 	return bOk;
 }
@@ -850,9 +854,13 @@ KWObject* KWMTDatabase::PhysicalRead()
 	// Prise en compte dans le memory guard
 	if (kwoObject != NULL)
 	{
-		// Nettoyage des objets natifs inclus si le memory guard a detecte un depassement de limite memoire
+		// Nettoyage des objets natifs inclus si le memory guard a detecte un depassement de limite memoire,
+		// apres avoir accumule ceux utiles aux attributs calculables en flux
 		if (memoryGuard.IsMemoryLimitReached())
+		{
+			memoryGuard.FinalizeStreamedSecondaryRecords(kwoObject);
 			kwoObject->CleanNativeRelationAttributes();
+		}
 	}
 
 	// Lecture apres la fin de la base pour effectuer des controles
@@ -1039,6 +1047,7 @@ boolean KWMTDatabase::PhysicalClose()
 	// Fermeture de la base et de toutes ses sous-bases
 	bOk = DMTMPhysicalClose(GetMainMapping());
 	nSkippedRecordNumber = 0;
+	memoryGuard.CleanStreamedAttributes();
 
 	// Destruction des objets references
 	PhysicalDeleteAllReferenceObjects();
@@ -2352,6 +2361,17 @@ KWObject* KWMTDatabase::DMTMPhysicalRead(KWMTDatabaseMapping* mapping)
 							// limite memoire
 							if (memoryGuard.IsMemoryLimitReached())
 							{
+								// Accumulation du sous-objet d'une table de l'objet
+								// principal pour les attributs calculables en flux
+								if (mapping == GetMainMapping() and
+								    componentMapping->GetMappedAttributeType() ==
+									KWType::ObjectArray)
+									memoryGuard.AddStreamedSecondaryRecord(
+									    kwoObject,
+									    componentMapping
+										->GetMappedAttributeLoadIndex(),
+									    kwoSubObject);
+
 								// Destruction du sous-objet non utilisable
 								delete kwoSubObject;
 							}
@@ -36,6 +36,8 @@ KWObject::KWObject(const KWClass* kwcNew, longint lIndex)
 
 KWObject::~KWObject()
 {
+	// Les calculs partages bufferises pour l'objet ne doivent pas etre reutilises par un nouvel objet
+	kwcClass->ResetSharedRuleComputations(this);
 	DeleteAttributes();
 }
 
@@ -226,6 +228,10 @@ void KWObject::ComputeAllValues(KWDatabaseMemoryGuard* memoryGuard)
 	{
 		CleanAllNonNativeAttributes();
 		CleanNativeRelationAttributes();
+
+		// Calcul des attributs calculables en flux si l'objet est l'instance principale concernee
+		if (memoryGuard->IsStreamedMainObject(this))
+			ComputeAllStreamedValues(memoryGuard);
 	}
 
 	// Trace de fin
@@ -695,6 +701,42 @@ void KWObject::CleanTemporayDataItemsToComputeAndClean()
 	}
 }
 
+void KWObject::ComputeAllStreamedValues(const KWDatabaseMemoryGuard* memoryGuard)
+{
+	int nAttribute;
+	KWAttribute* attribute;
+	KWDerivationRule* attributeRule;
+	KWDRSharedComputation* streamedComputation;
+	KWLoadIndex liLoadIndex;
+
+	require(kwcClass->IsCompiled());
+	require(memoryGuard != NULL);
+	require(memoryGuard->IsStreamedMainObject(this));
+
+	// Calcul de chaque attribut a partir de son objet de calcul en flux
+	for (nAttribute = 0; nAttribute < memoryGuard->GetStreamedAttributeNumber(); nAttribute++)
+	{
+		attribute = memoryGuard->GetStreamedAttributeAt(nAttribute);
+		streamedComputation = memoryGuard->GetStreamedComputationAt(nAttribute);
+		attributeRule = attribute->GetDerivationRule();
+		liLoadIndex = attribute->GetLoadIndex();
+		assert(attribute->GetParentClass() == kwcClass);
+		assert(attributeRule != NULL and liLoadIndex.IsDense());
+		assert(streamedComputation->GetComputedObject() == this);
+
+		// Calcul selon le type
+		if (attribute->GetType() == KWType::Continuous)
+			GetAt(liLoadIndex.GetDenseIndex())
+			    .SetContinuous(attributeRule->ComputeContinuousStreamedResult(streamedComputation));
+		else
+		{
+			assert(attribute->GetType() == KWType::Symbol);
+			GetAt(liLoadIndex.GetDenseIndex())
+			    .SetSymbol(attributeRule->ComputeSymbolStreamedResult(streamedComputation));
+		}
+	}
+}
+
 void KWObject::CleanAllNonNativeAttributes()
 {
 	int nAttribute;
@@ -1871,7 +1913,8 @@ void KWObject::Mutate(const KWClass* kwcNewClass, const NumericKeyDictionary* nk
 		previousValues = values;
 		bPreviousSmallSize = (previousClass->GetTotalInternallyLoadedDataItemNumber() <= nBlockSize);
 
-		// Initialisation
+		// Initialisation, en invalidant les calculs partages bufferises pour l'objet dans son ancienne classe
+		kwcClass->ResetSharedRuleComputations(this);
 		kwcClass = kwcNewClass;
 		values.attributeValues = NULL;
 		debug(nObjectLoadedDataItemNumber = 0);
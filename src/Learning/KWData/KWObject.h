@@ -274,6 +274,10 @@ protected:
 	// Seuls les attributs natifs sont gardes
 	void CleanAllNonNativeAttributes();
 
+	// Calcul des attributs derives calculables en flux, a partir des enregistrements secondaires accumules
+	// par le memory guard lors de la lecture de l'objet, apres nettoyage des attributs non natifs
+	void ComputeAllStreamedValues(const KWDatabaseMemoryGuard* memoryGuard);
+
 	// Nettoyage des attributs natifs de type Relation charges en memoire (nettoyage recursif)
 	// L'objet reste utilisable: seuls ses attributs de type Relation sont detruits et mis a NULL
 	friend class KWMTDatabase;
@@ -385,16 +385,20 @@ const ALString& KWTimeFormat::GetFormatString() const
 }
 
 Time KWTimeFormat::StringToTime(const char* const sValue) const
+{
+	require(sValue != NULL);
+	return StringToTime(sValue, (int)strlen(sValue));
+}
+
+Time KWTimeFormat::StringToTime(const char* const sValue, int nLength) const
 {
 	boolean bCheck = true;
 	Time tmConvertedString;
-	int nLength;
 	int nHour;
 	int nMinute;
 	int nSecond;
 	int nSecondFrac;
 	char cChar0;
-	char cChar1;
 	int i;
 	int nUnit;
 	int nOffset;
@@ -402,6 +406,7 @@ Time KWTimeFormat::StringToTime(const char* const sValue) const
 
 	require(Check());
 	require(sValue != NULL);
+	require(nLength >= 0);
 
 	// Initialisation
 	tmConvertedString.Reset();
@@ -410,9 +415,6 @@ Time KWTimeFormat::StringToTime(const char* const sValue) const
 	nSecond = 0;
 	nSecondFrac = 0;
 
-	// Acces a la longueur de la valeur a convertir
-	nLength = (int)strlen(sValue);
-
 	//////////////////////////////////////////////
 	// Cas avec premier chiffre facultatif
 	if (not bMandatoryFirstDigit)
@@ -473,8 +475,8 @@ Time KWTimeFormat::StringToTime(const char* const sValue) const
 					{
 						nMinute = nMinute * 10 + cChar - '0';
 
-						// Lecture du caractere suivant (potentiellement '\0')
-						cChar = sValue[nOffset];
+						// Lecture du caractere suivant ('\0' en fin de valeur)
+						cChar = (nOffset < nLength) ? sValue[nOffset] : '\0';
 						nOffset++;
 					}
 					if (nSecondOffset == -1)
@@ -507,8 +509,8 @@ Time KWTimeFormat::StringToTime(const char* const sValue) const
 					{
 						nSecond = nSecond * 10 + cChar - '0';
 
-						// Lecture du caractere suivant (potentiellement '\0')
-						cChar = sValue[nOffset];
+						// Lecture du caractere suivant ('\0' en fin de valeur)
+						cChar = (nOffset < nLength) ? sValue[nOffset] : '\0';
 						nOffset++;
 					}
 					if (nDecimalPointOffset == -1)
@@ -554,7 +556,7 @@ Time KWTimeFormat::StringToTime(const char* const sValue) const
 		}
 
 		// Test du separateur decimal, optionnel en fin de chaine de format
-		if (Check())
+		if (bCheck)
 		{
 			if (nDecimalPointOffset != -1 and nLength > nMinCharNumber)
 				bCheck = sValue[nDecimalPointOffset] == '.';
@@ -574,37 +576,23 @@ Time KWTimeFormat::StringToTime(const char* const sValue) const
 		// Recherche de l'heure
 		if (bCheck)
 		{
-			cChar0 = sValue[nHourOffset];
-			cChar1 = sValue[nHourOffset + 1];
-
-			// Test de validite
-			bCheck = isdigit(cChar0) and isdigit(cChar1);
-			if (bCheck)
-				nHour = 10 * (cChar0 - '0') + (cChar1 - '0');
+			// Extraction du champ a sa position fixe, -1 en cas de caractere non numerique
+			nHour = DateTime::ParseTwoDigits(&sValue[nHourOffset]);
+			bCheck = nHour >= 0;
 		}
 
 		// Recherche de la minute
 		if (bCheck)
 		{
-			cChar0 = sValue[nMinuteOffset];
-			cChar1 = sValue[nMinuteOffset + 1];
-
-			// Test de validite
-			bCheck = isdigit(cChar0) and isdigit(cChar1);
-			if (bCheck)
-				nMinute = 10 * (cChar0 - '0') + (cChar1 - '0');
+			nMinute = DateTime::ParseTwoDigits(&sValue[nMinuteOffset]);
+			bCheck = nMinute >= 0;
 		}
 
 		// Recherche de la seconde
 		if (bCheck and nSecondOffset != -1)
 		{
-			cChar0 = sValue[nSecondOffset];
-			cChar1 = sValue[nSecondOffset + 1];
-
-			// Test de validite
-			bCheck = isdigit(cChar0) and isdigit(cChar1);
-			if (bCheck)
-				nSecond = 10 * (cChar0 - '0') + (cChar1 - '0');
+			nSecond = DateTime::ParseTwoDigits(&sValue[nSecondOffset]);
+			bCheck = nSecond >= 0;
 
 			// Recherche de la fraction de seconde
 			if (bCheck and nDecimalPointOffset != -1)
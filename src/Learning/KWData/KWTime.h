@@ -187,6 +187,10 @@ public:
 	// La Time est invalide en cas de probleme de conversion
 	Time StringToTime(const char* const sValue) const;
 
+	// Variante ne convertissant que les nLength premiers caracteres de la chaine, sans avoir besoin
+	// que celle-ci se termine a cette longueur
+	Time StringToTime(const char* const sValue, int nLength) const;
+
 	// Renvoie une chaine a partir d'une Time
 	// Renvoie la chaine vide si la Time est invalide
 	const char* const TimeToString(Time tmValue) const;
@@ -432,25 +432,27 @@ boolean KWTimestampFormat::IsConsistentWith(const KWTimestampFormat* otherFormat
 }
 
 Timestamp KWTimestampFormat::StringToTimestamp(const char* const sValue) const
+{
+	require(sValue != NULL);
+	return StringToTimestamp(sValue, (int)strlen(sValue));
+}
+
+Timestamp KWTimestampFormat::StringToTimestamp(const char* const sValue, int nLength) const
 {
 	boolean bCheck = true;
-	char sDateValue[12];
 	Timestamp tsConvertedString;
 	Date dtValue;
 	Time tmValue;
-	int nLength;
 
 	require(Check());
 	require(sValue != NULL);
+	require(nLength >= 0);
 
 	// Initialisations
 	dtValue.Reset();
 	tmValue.Reset();
 	tsConvertedString.Reset();
 
-	// Acces a la longueur de la valeur a convertir
-	nLength = (int)strlen(sValue);
-
 	// Test si longueur compatible
 	if (bCheck)
 	{
@@ -467,16 +469,14 @@ Timestamp KWTimestampFormat::StringToTimestamp(const char* const sValue) const
 	// Recherche de la Date et la Time
 	if (bCheck)
 	{
-		// Recherche de la Time d'abord
-		tmValue = timeFormat.StringToTime(&sValue[nTimeOffset]);
+		// Recherche de la Time d'abord, en fin de chaine
+		tmValue = timeFormat.StringToTime(&sValue[nTimeOffset], nLength - nTimeOffset);
 		bCheck = tmValue.Check();
 
-		// Recherche de la Date, en copiant la sous-chaine correspondante
+		// Recherche de la Date, en debut de chaine
 		if (bCheck)
 		{
-			strncpy(sDateValue, sValue, dateFormat.GetTotalCharNumber());
-			sDateValue[dateFormat.GetTotalCharNumber()] = '\0';
-			dtValue = dateFormat.StringToDate(sDateValue);
+			dtValue = dateFormat.StringToDate(sValue, dateFormat.GetTotalCharNumber());
 			bCheck = dtValue.Check();
 		}
 	}
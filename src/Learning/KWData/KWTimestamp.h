@@ -180,6 +180,11 @@ public:
 	// La Timestamp est invalide en cas de probleme de conversion
 	Timestamp StringToTimestamp(const char* const sValue) const;
 
+	// Variante ne convertissant que les nLength premiers caracteres de la chaine, sans avoir besoin
+	// que celle-ci se termine a cette longueur
+	// Les parties Date et Time sont converties directement dans la chaine, sans copie de sous-chaine
+	Timestamp StringToTimestamp(const char* const sValue, int nLength) const;
+
 	// Renvoie une chaine a partir d'une Timestamp
 	// Renvoie la chaine vide si la Timestamp est invalide
 	const char* const TimestampToString(Timestamp tsValue) const;
@@ -165,32 +165,30 @@ boolean KWTimestampTZFormat::IsConsistentWith(const KWTimestampTZFormat* otherFo
 }
 
 TimestampTZ KWTimestampTZFormat::StringToTimestampTZ(const char* const sValue) const
+{
+	require(sValue != NULL);
+	return StringToTimestampTZ(sValue, (int)strlen(sValue));
+}
+
+TimestampTZ KWTimestampTZFormat::StringToTimestampTZ(const char* const sValue, int nLength) const
 {
 	boolean bCheck = true;
-	char sTimestampValue[100];
 	TimestampTZ tstzConvertedString;
 	Timestamp tsValue;
-	int nLength;
 	int nTimeZoneLength;
 	int nTimeZoneHour;
 	int nTimeZoneMinute;
 	int nTimeZoneTotalMinutes;
 	char cTimeZoneSign;
-	char cTimeZoneH1;
-	char cTimeZoneH2;
-	char cTimeZoneM1;
-	char cTimeZoneM2;
 
 	require(Check());
 	require(sValue != NULL);
+	require(nLength >= 0);
 
 	// Initialisations
 	tsValue.Reset();
 	tstzConvertedString.Reset();
 
-	// Acces a la longueur de la valeur a convertir
-	nLength = (int)strlen(sValue);
-
 	// Recherche de la partie time zone
 	assert(nTimeZoneFormat != NoTimeZone);
 	nTimeZoneLength = 0;
@@ -215,34 +213,21 @@ TimestampTZ KWTimestampTZFormat::StringToTimestampTZ(const char* const sValue) c
 			// Verification du separateur
 			else if (nTimeZoneFormat == ExtendedTimeZone and sValue[nLength - 3] != ':')
 				bCheck = false;
-			// Verification des heures et minutes
+			// Verification et calcul de la partie heure et minute de la time zone, que l'on ne mettra
+			// a jour qu'apres la date
+			else
 			{
-				cTimeZoneH1 = sValue[nLength - nTimeZoneLength + 1];
-				cTimeZoneH2 = sValue[nLength - nTimeZoneLength + 2];
-				cTimeZoneM1 = sValue[nLength - 2];
-				cTimeZoneM2 = sValue[nLength - 1];
-
-				// Test de validite
-				bCheck = isdigit(cTimeZoneH1) and isdigit(cTimeZoneH2) and isdigit(cTimeZoneM1) and
-					 isdigit(cTimeZoneM2);
-
-				// Calcul de la partie heure et minute de la time zone, que l'on ne mettra a jour
-				// qu'apres la date
-				if (bCheck)
-				{
-					nTimeZoneHour = 10 * (cTimeZoneH1 - '0') + (cTimeZoneH2 - '0');
-					nTimeZoneMinute = 10 * (cTimeZoneM1 - '0') + (cTimeZoneM2 - '0');
-				}
+				nTimeZoneHour = DateTime::ParseTwoDigits(&sValue[nLength - nTimeZoneLength + 1]);
+				nTimeZoneMinute = DateTime::ParseTwoDigits(&sValue[nLength - 2]);
+				bCheck = nTimeZoneHour >= 0 and nTimeZoneMinute >= 0;
 			}
 		}
 	}
 
-	// Recherche de la partie Timestamp, en copiant la sous-chaine correspondante
+	// Recherche de la partie Timestamp, directement en tete de chaine
 	if (bCheck)
 	{
-		strncpy(sTimestampValue, sValue, nLength - nTimeZoneLength);
-		sTimestampValue[nLength - nTimeZoneLength] = '\0';
-		tsValue = timestampFormat.StringToTimestamp(sTimestampValue);
+		tsValue = timestampFormat.StringToTimestamp(sValue, nLength - nTimeZoneLength);
 		bCheck = tsValue.Check();
 	}
 
@@ -207,6 +207,10 @@ public:
 	// La TimestampTZ est invalide en cas de probleme de conversion
 	TimestampTZ StringToTimestampTZ(const char* const sValue) const;
 
+	// Variante ne convertissant que les nLength premiers caracteres de la chaine, sans avoir besoin
+	// que celle-ci se termine a cette longueur
+	TimestampTZ StringToTimestampTZ(const char* const sValue, int nLength) const;
+
 	// Renvoie une chaine a partir d'une TimestampTZ
 	// Renvoie la chaine vide si la TimestampTZ est invalide
 	const char* const TimestampTZToString(TimestampTZ tstzValue) const;
@@ -215,7 +215,7 @@ void KWTypeAutomaticRecognition::AddFirstStringValue(const char* const sValue, i
 							// On memorise le format de date s'il est compatible
 							if (cDateSeparator == dateFormat->GetSeparatorChar())
 							{
-								dtDate = dateFormat->StringToDate(sValue);
+								dtDate = dateFormat->StringToDate(sValue, nValueLength);
 								if (dtDate.Check())
 									oaMatchingDateFormats.Add(
 									    cast(Object*, dateFormat));
@@ -284,7 +284,8 @@ void KWTypeAutomaticRecognition::AddFirstStringValue(const char* const sValue, i
 								// On memorise le format de time s'il est compatible
 								if (cTimeSeparator == timeFormat->GetSeparatorChar())
 								{
-									tmTime = timeFormat->StringToTime(sValue);
+									tmTime = timeFormat->StringToTime(
+									    sValue, nValueLength);
 									if (tmTime.Check())
 										oaMatchingTimeFormats.Add(
 										    cast(Object*, timeFormat));
@@ -437,7 +438,7 @@ void KWTypeAutomaticRecognition::AddFirstStringValue(const char* const sValue, i
 									{
 										tsTimestamp =
 										    timestampFormat->StringToTimestamp(
-											sValue);
+											sValue, nValueLength);
 										if (tsTimestamp.Check())
 											oaMatchingTimestampFormats.Add(
 											    cast(Object*,
@@ -475,7 +476,8 @@ void KWTypeAutomaticRecognition::AddFirstStringValue(const char* const sValue, i
 									{
 										tstzTimestamp =
 										    timestampTZFormat
-											->StringToTimestampTZ(sValue);
+											->StringToTimestampTZ(
+											    sValue, nValueLength);
 										if (tstzTimestamp.Check())
 											oaMatchingTimestampTZFormats
 											    .Add(cast(
@@ -609,7 +611,7 @@ void KWTypeAutomaticRecognition::AddNewStringValue(const char* const sValue, int
 					dateFormat = cast(const KWDateFormat*, oaMatchingDateFormats.GetAt(i));
 
 					// On garde les formats de date compatibles
-					dtDate = dateFormat->StringToDate(sValue);
+					dtDate = dateFormat->StringToDate(sValue, nValueLength);
 					if (dtDate.Check())
 					{
 						oaMatchingDateFormats.SetAt(nNewI, cast(Object*, dateFormat));
@@ -632,7 +634,7 @@ void KWTypeAutomaticRecognition::AddNewStringValue(const char* const sValue, int
 					timeFormat = cast(const KWTimeFormat*, oaMatchingTimeFormats.GetAt(i));
 
 					// On garde les formats de time compatibles
-					tmTime = timeFormat->StringToTime(sValue);
+					tmTime = timeFormat->StringToTime(sValue, nValueLength);
 					if (tmTime.Check())
 					{
 						oaMatchingTimeFormats.SetAt(nNewI, cast(Object*, timeFormat));
@@ -656,7 +658,7 @@ void KWTypeAutomaticRecognition::AddNewStringValue(const char* const sValue, int
 					    cast(const KWTimestampFormat*, oaMatchingTimestampFormats.GetAt(i));
 
 					// On garde les formats de timestamp compatibles
-					tsTimestamp = timestampFormat->StringToTimestamp(sValue);
+					tsTimestamp = timestampFormat->StringToTimestamp(sValue, nValueLength);
 					if (tsTimestamp.Check())
 					{
 						oaMatchingTimestampFormats.SetAt(nNewI, cast(Object*, timestampFormat));
@@ -685,7 +687,7 @@ void KWTypeAutomaticRecognition::AddNewStringValue(const char* const sValue, int
 				    cast(const KWTimestampTZFormat*, oaMatchingTimestampTZFormats.GetAt(i));
 
 				// On garde les formats de timestampTZ compatibles
-				tstzTimestamp = timestampTZFormat->StringToTimestampTZ(sValue);
+				tstzTimestamp = timestampTZFormat->StringToTimestampTZ(sValue, nValueLength);
 				if (tstzTimestamp.Check())
 				{
 					oaMatchingTimestampTZFormats.SetAt(nNewI, cast(Object*, timestampTZFormat));
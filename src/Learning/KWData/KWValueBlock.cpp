@@ -472,6 +472,53 @@ boolean KWValueBlock::ReadCKey(const char* sInputField, int& nCurrentOffset, ALS
 	return bOk;
 }
 
+boolean KWValueBlock::ReadCKeyChars(const char* sInputField, int& nCurrentOffset, ALString& sKeyBuffer,
+				   const char*& sKeyChars, int& nKeyLength, int& nFieldError)
+{
+	boolean bOk;
+	int nStartOffset;
+	char c;
+
+	require(sInputField != NULL);
+	require(nCurrentOffset >= 0);
+
+	// Cas d'une cle avec quotes, lue dans la chaine de travail en gerant les caracteres d'echappement
+	if (sInputField[nCurrentOffset] == '\'')
+	{
+		bOk = ReadCKey(sInputField, nCurrentOffset, sKeyBuffer, nFieldError);
+		sKeyChars = sKeyBuffer;
+		nKeyLength = sKeyBuffer.GetLength();
+	}
+	// Cas standard, ou la cle est directement referencee dans le champ
+	else
+	{
+		nFieldError = FieldNoError;
+		nStartOffset = nCurrentOffset;
+		c = sInputField[nCurrentOffset];
+		while (c != '\0' and c != ' ' and c != ':')
+		{
+			// Erreur si le caractere n'est pas alpha-numerique
+			if (c < -1 or not isalnum(c)) // selon la plage de caractere exige par isalnum
+			{
+				nFieldError = FieldWrongChar;
+				break;
+			}
+
+			// Lecture du caractere suivant
+			nCurrentOffset++;
+			c = sInputField[nCurrentOffset];
+		}
+		sKeyChars = &sInputField[nStartOffset];
+		nKeyLength = nCurrentOffset - nStartOffset;
+
+		// Erreur si cle vide
+		if (nFieldError == FieldNoError and nKeyLength == 0)
+			nFieldError = FieldKeyEmpty;
+		bOk = (nFieldError == FieldNoError);
+	}
+	return bOk;
+}
+
 boolean KWValueBlock::ReadNKey(const char* sInputField, int& nCurrentOffset, ALString& sKey, int& nKey,
 			       int& nFieldError)
 {
@@ -1276,10 +1323,12 @@ KWContinuousValueBlock* KWContinuousValueBlock::BuildCKeyBlockFromField(const KW
 									ALString& sMessage)
 {
 	KWContinuousValueBlock* resultValueBlock;
-	KWContinuousValueDictionary valueDictionary;
+	KWContinuousValueSparseVector valueSparseVector;
 	int nOffset;
-	Symbol sKeySymbol;
-	ALString sKey;
+	ALString sKeyBuffer;
+	const char* sKeyChars;
+	int nKeyLength;
+	int nSparseIndex;
 	boolean bExistingValue;
 	ALString sValue;
 	Continuous cValue;
@@ -1292,7 +1341,14 @@ KWContinuousValueBlock* KWContinuousValueBlock::BuildCKeyBlockFromField(const KW
 	// Reinitialisation de la taille du message sans le desallouer
 	sMessage.GetBufferSetLength(0);
 
+	// Debut de lecture des cles, pour la detection des cles utilisees plusieurs fois
+	indexedKeyBlock->BeginKeyReading();
+
 	// Boucle de lecture des paires (cle, valeur)
+	// Les cles sont recherchees directement a partir de leurs caracteres, sans creation de Symbol,
+	// et les cles inconnues sont ignorees
+	sKeyChars = "";
+	nKeyLength = 0;
 	nOffset = 0;
 	bOk = true;
 	while (bOk and sInputField[nOffset] != '\0')
@@ -1300,15 +1356,16 @@ KWContinuousValueBlock* KWContinuousValueBlock::BuildCKeyBlockFromField(const KW
 		// Lecture d'un caractere blanc
 		bOk = ReadBlankSeparator(sInputField, nOffset, nFieldError);
 		if (not bOk)
-			sMessage = BuildErrorMessage(GetFieldErrorLabel(nFieldError), sKey, sInputField, nOffset);
+			sMessage = BuildErrorMessage(GetFieldErrorLabel(nFieldError), ALString(sKeyChars, nKeyLength),
+						     sInputField, nOffset);
 
 		// Lecture de la cle
 		if (bOk and sInputField[nOffset] != '\0')
 		{
-			bOk = ReadCKey(sInputField, nOffset, sKey, nFieldError);
+			bOk = ReadCKeyChars(sInputField, nOffset, sKeyBuffer, sKeyChars, nKeyLength, nFieldError);
 			if (not bOk)
-				sMessage =
-				    BuildErrorMessage(GetFieldErrorLabel(nFieldError), sKey, sInputField, nOffset);
+				sMessage = BuildErrorMessage(GetFieldErrorLabel(nFieldError),
+							     ALString(sKeyChars, nKeyLength), sInputField, nOffset);
 		}
 
 		// Lecture de la valeur si elle existe
@@ -1325,34 +1382,36 @@ KWContinuousValueBlock* KWContinuousValueBlock::BuildCKeyBlockFromField(const KW
 
 				// Erreur de valeur
 				if (not bOk)
-					sMessage = BuildErrorMessage(GetFieldErrorLabel(nFieldError), sKey, sInputField,
+					sMessage = BuildErrorMessage(GetFieldErrorLabel(nFieldError),
+								     ALString(sKeyChars, nKeyLength), sInputField,
 								     nOffset);
 				else
 					bExistingValue = true;
 			}
 		}
 
-		// Traitement de la paire cle valeur
+		// Traitement de la paire cle valeur, uniquement si la cle est a conserver
 		if (bOk)
 		{
-			sKeySymbol = Symbol(sKey);
-
-			// Test si la cle est deja presente
-			if (valueDictionary.IsKeyPresent(sKeySymbol))
-			{
-				bOk = false;
-				sMessage = BuildErrorMessage("Var key used more than once", sKey, sInputField, nOffset);
-			}
-			// Si ok et cle a conserver, memorisation de la valeur dans le dictionnaire
-			else if (indexedKeyBlock->IsKeyPresent(sKeySymbol))
+			nSparseIndex = indexedKeyBlock->GetKeyIndexFromChars(sKeyChars, nKeyLength);
+			if (nSparseIndex != -1)
 			{
-				// Conversion de la valeur si presente
-				if (bExistingValue)
+				// Test si la cle est deja presente
+				if (indexedKeyBlock->IsReadKeyIndexMarked(nSparseIndex))
+				{
+					bOk = false;
+					sMessage = BuildErrorMessage("Var key used more than once",
+								     ALString(sKeyChars, nKeyLength), sInputField,
+								     nOffset);
+				}
+				// Sinon, conversion de la valeur si presente
+				else if (bExistingValue)
 				{
 					nError = KWContinuous::StringToContinuousError(sValue, cValue);
 					bOk = (nError == KWContinuous::NoError);
 					if (not bOk)
-						sMessage = BuildErrorMessage(KWContinuous::ErrorLabel(nError), sKey,
+						sMessage = BuildErrorMessage(KWContinuous::ErrorLabel(nError),
+									     ALString(sKeyChars, nKeyLength),
 									     sInputField, nOffset);
 				}
 				//  Sinon, on prend 1, comme dans SVMLight
@@ -1361,15 +1420,21 @@ KWContinuousValueBlock* KWContinuousValueBlock::BuildCKeyBlockFromField(const KW
 
 				// Memorisation si ok et valeur utile
 				if (bOk and cValue != cDefaultValue)
-					valueDictionary.SetAt(sKeySymbol, cValue);
+				{
+					indexedKeyBlock->MarkReadKeyIndex(nSparseIndex);
+					valueSparseVector.AddValueAt(nSparseIndex, cValue);
+				}
 			}
 		}
 	}
 
-	// Si Ok, on extrait la representation dense
+	// Si Ok, on extrait la representation dense, apres tri des valeurs par index de cle
 	resultValueBlock = NULL;
 	if (bOk)
-		resultValueBlock = BuildBlockFromValueDictionary(indexedKeyBlock, &valueDictionary);
+	{
+		valueSparseVector.SortBySparseIndex();
+		resultValueBlock = BuildBlockFromSparseValueVector(&valueSparseVector);
+	}
 
 	// Sinon, on renvoie un bloc vide
 	if (not bOk)
@@ -1932,10 +1997,12 @@ KWSymbolValueBlock* KWSymbolValueBlock::BuildCKeyBlockFromField(const KWIndexedC
 								boolean& bOk, ALString& sMessage)
 {
 	KWSymbolValueBlock* resultValueBlock;
-	KWSymbolValueDictionary valueDictionary;
+	KWSymbolValueSparseVector valueSparseVector;
 	int nOffset;
-	Symbol sKeySymbol;
-	ALString sKey;
+	ALString sKeyBuffer;
+	const char* sKeyChars;
+	int nKeyLength;
+	int nSparseIndex;
 	boolean bExistingValue;
 	ALString sValue;
 	Symbol sValueSymbol;
@@ -1948,7 +2015,14 @@ KWSymbolValueBlock* KWSymbolValueBlock::BuildCKeyBlockFromField(const KWIndexedC
 	// Reinitialisation de la taille du message sans le desallouer
 	sMessage.GetBufferSetLength(0);
 
+	// Debut de lecture des cles, pour la detection des cles utilisees plusieurs fois
+	indexedKeyBlock->BeginKeyReading();
+
 	// Boucle de lecture des paire (cle, valeur)
+	// Les cles sont recherchees directement a partir de leurs caracteres, sans creation de Symbol,
+	// et les cles inconnues sont ignorees
+	sKeyChars = "";
+	nKeyLength = 0;
 	nOffset = 0;
 	bOk = true;
 	while (bOk and sInputField[nOffset] != '\0')
@@ -1956,15 +2030,16 @@ KWSymbolValueBlock* KWSymbolValueBlock::BuildCKeyBlockFromField(const KWIndexedC
 		// Lecture d'un caractere blanc
 		bOk = ReadBlankSeparator(sInputField, nOffset, nFieldError);
 		if (not bOk)
-			sMessage = BuildErrorMessage(GetFieldErrorLabel(nFieldError), sKey, sInputField, nOffset);
+			sMessage = BuildErrorMessage(GetFieldErrorLabel(nFieldError), ALString(sKeyChars, nKeyLength),
+						     sInputField, nOffset);
 
 		// Lecture de la cle
 		if (bOk and sInputField[nOffset] != '\0')
 		{
-			bOk = ReadCKey(sInputField, nOffset, sKey, nFieldError);
+			bOk = ReadCKeyChars(sInputField, nOffset, sKeyBuffer, sKeyChars, nKeyLength, nFieldError);
 			if (not bOk)
-				sMessage =
-				    BuildErrorMessage(GetFieldErrorLabel(nFieldError), sKey, sInputField, nOffset);
+				sMessage = BuildErrorMessage(GetFieldErrorLabel(nFieldError),
+							     ALString(sKeyChars, nKeyLength), sInputField, nOffset);
 		}
 
 		// Lecture de la valeur si elle existe
@@ -1981,43 +2056,53 @@ KWSymbolValueBlock* KWSymbolValueBlock::BuildCKeyBlockFromField(const KWIndexedC
 
 				// Erreur de valeur
 				if (not bOk)
-					sMessage = BuildErrorMessage(GetFieldErrorLabel(nFieldError), sKey, sInputField,
+					sMessage = BuildErrorMessage(GetFieldErrorLabel(nFieldError),
+								     ALString(sKeyChars, nKeyLength), sInputField,
 								     nOffset);
 				else
 					bExistingValue = true;
 			}
 		}
 
-		// Traitement de la paire cle valeur
+		// Traitement de la paire cle valeur, uniquement si la cle est a conserver
 		if (bOk)
 		{
-			sKeySymbol = Symbol(sKey);
-
-			// Test si la cle est deja presente
-			if (valueDictionary.IsKeyPresent(sKeySymbol))
-			{
-				bOk = false;
-				sMessage = BuildErrorMessage("Var key used more than once", sKey, sInputField, nOffset);
-			}
-			// Si ok et cle a conserver, memorisation de la valeur dans le dictionnaire
-			else if (indexedKeyBlock->IsKeyPresent(sKeySymbol))
+			nSparseIndex = indexedKeyBlock->GetKeyIndexFromChars(sKeyChars, nKeyLength);
+			if (nSparseIndex != -1)
 			{
-				// Conversion et memorisation si valeur utile ("1" si non specifiee, comme dans
+				// Test si la cle est deja presente
+				if (indexedKeyBlock->IsReadKeyIndexMarked(nSparseIndex))
+				{
+					bOk = false;
+					sMessage = BuildErrorMessage("Var key used more than once",
+								     ALString(sKeyChars, nKeyLength), sInputField,
+								     nOffset);
+				}
+				// Sinon, conversion et memorisation si valeur utile ("1" si non specifiee, comme dans
 				// SVMLight)
-				if (bExistingValue)
-					sValueSymbol = Symbol(sValue);
 				else
-					sValueSymbol = sValueSymbol1;
-				if (sValueSymbol != sDefaultValue)
-					valueDictionary.SetAt(sKeySymbol, sValueSymbol);
+				{
+					if (bExistingValue)
+						sValueSymbol = Symbol(sValue);
+					else
+						sValueSymbol = sValueSymbol1;
+					if (sValueSymbol != sDefaultValue)
+					{
+						indexedKeyBlock->MarkReadKeyIndex(nSparseIndex);
+						valueSparseVector.AddValueAt(nSparseIndex, sValueSymbol);
+					}
+				}
 			}
 		}
 	}
 
-	// Si Ok, on extrait la representation dense
+	// Si Ok, on extrait la representation dense, apres tri des valeurs par index de cle
 	resultValueBlock = NULL;
 	if (bOk)
-		resultValueBlock = BuildBlockFromValueDictionary(indexedKeyBlock, &valueDictionary);
+	{
+		valueSparseVector.SortBySparseIndex();
+		resultValueBlock = BuildBlockFromSparseValueVector(&valueSparseVector);
+	}
 
 	// Sinon, on renvoie un bloc vide
 	if (not bOk)
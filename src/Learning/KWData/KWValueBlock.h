@@ -221,6 +221,13 @@ protected:
 
 	// Lecture d'une cle
 	static boolean ReadCKey(const char* sInputField, int& nCurrentOffset, ALString& sKey, int& nFieldError);
+
+	// Lecture d'une cle categorielle sans recopie dans le cas standard, avec les memes controles que ReadCKey
+	// En sortie, la cle est accessible par ses caracteres sKeyChars de longueur nKeyLength, qui referencent
+	// soit directement le champ en entree, soit la chaine de travail sKeyBuffer dans le cas des cles avec quotes
+	// En cas d'erreur, on obtient les caracteres lus jusqu'a l'erreur, comme pour ReadCKey
+	static boolean ReadCKeyChars(const char* sInputField, int& nCurrentOffset, ALString& sKeyBuffer,
+				     const char*& sKeyChars, int& nKeyLength, int& nFieldError);
 	static boolean ReadNKey(const char* sInputField, int& nCurrentOffset, ALString& sKey, int& nKey,
 				int& nFieldError);
 
@@ -42,6 +42,44 @@ void KWValueSparseVector::Write(ostream& ost) const
 	cout << "\n";
 }
 
+void KWValueSparseVector::SortBySparseIndex()
+{
+	boolean bSorted;
+	LongintVector lvSortKeys;
+	IntVector ivInitialIndexes;
+	int n;
+
+	// Test si les paires sont deja triees, ce qui est le cas le plus frequent
+	bSorted = true;
+	for (n = 1; n < GetValueNumber(); n++)
+	{
+		if (ivSparseIndexes.GetAt(n - 1) > ivSparseIndexes.GetAt(n))
+		{
+			bSorted = false;
+			break;
+		}
+	}
+
+	// Tri sinon, en codant chaque paire par son index sparse et son index initial dans un longint
+	// pour obtenir un tri stable sans creer d'objets
+	if (not bSorted)
+	{
+		lvSortKeys.SetSize(GetValueNumber());
+		for (n = 0; n < GetValueNumber(); n++)
+			lvSortKeys.SetAt(n, ((longint)ivSparseIndexes.GetAt(n) << 32) + n);
+		lvSortKeys.Sort();
+
+		// Rangement des index sparse dans leur nouvel ordre, et permutation des valeurs
+		ivInitialIndexes.SetSize(GetValueNumber());
+		for (n = 0; n < GetValueNumber(); n++)
+		{
+			ivSparseIndexes.SetAt(n, (int)(lvSortKeys.GetAt(n) >> 32));
+			ivInitialIndexes.SetAt(n, (int)(lvSortKeys.GetAt(n) & INT_MAX));
+		}
+		PermuteValues(&ivInitialIndexes);
+	}
+}
+
 void KWValueSparseVector::WriteValueAt(ostream& ost, int nIndex) const {}
 
 const IntVector* KWValueSparseVector::GetSparseIndexVector() const
@@ -95,6 +133,19 @@ void KWContinuousValueSparseVector::WriteValueAt(ostream& ost, int nIndex) const
 	ost << GetValueAt(nIndex);
 }
 
+void KWContinuousValueSparseVector::PermuteValues(const IntVector* ivInitialIndexes)
+{
+	ContinuousVector cvInitialValues;
+	int n;
+
+	require(ivInitialIndexes != NULL);
+	require(ivInitialIndexes->GetSize() == cvValues.GetSize());
+
+	cvInitialValues.CopyFrom(&cvValues);
+	for (n = 0; n < cvValues.GetSize(); n++)
+		cvValues.SetAt(n, cvInitialValues.GetAt(ivInitialIndexes->GetAt(n)));
+}
+
 void KWContinuousValueSparseVector::Test()
 {
 	const int nValueNumber = 1000;
@@ -145,6 +196,19 @@ void KWSymbolValueSparseVector::WriteValueAt(ostream& ost, int nIndex) const
 	ost << GetValueAt(nIndex);
 }
 
+void KWSymbolValueSparseVector::PermuteValues(const IntVector* ivInitialIndexes)
+{
+	SymbolVector svInitialValues;
+	int n;
+
+	require(ivInitialIndexes != NULL);
+	require(ivInitialIndexes->GetSize() == svValues.GetSize());
+
+	svInitialValues.CopyFrom(&svValues);
+	for (n = 0; n < svValues.GetSize(); n++)
+		svValues.SetAt(n, svInitialValues.GetAt(ivInitialIndexes->GetAt(n)));
+}
+
 void KWSymbolValueSparseVector::Test()
 {
 	const int nValueNumber = 1000;
@@ -205,6 +269,19 @@ void KWObjectArrayValueSparseVector::WriteValueAt(ostream& ost, int nIndex) cons
 		ost << "Part(" << GetValueAt(nIndex)->GetSize() << ")";
 }
 
+void KWObjectArrayValueSparseVector::PermuteValues(const IntVector* ivInitialIndexes)
+{
+	ObjectArray oaInitialValues;
+	int n;
+
+	require(ivInitialIndexes != NULL);
+	require(ivInitialIndexes->GetSize() == oaValues.GetSize());
+
+	oaInitialValues.CopyFrom(&oaValues);
+	for (n = 0; n < oaValues.GetSize(); n++)
+		oaValues.SetAt(n, oaInitialValues.GetAt(ivInitialIndexes->GetAt(n)));
+}
+
 void KWObjectArrayValueSparseVector::Test()
 {
 	const int nValueNumber = 1000;
@@ -41,6 +41,9 @@ public:
 	// Acces aux index sparse
 	int GetSparseIndexAt(int nIndex) const;
 
+	// Tri des paires par index sparse croissant, sans effet si elles sont deja triees
+	void SortBySparseIndex();
+
 	////////////////////////////////////////////////////////////////
 	// Services divers
 
@@ -63,6 +66,10 @@ public:
 	///////////////////////////////////////////////////////////////////
 	///// Implementation
 protected:
+	// Permutation des valeurs, la nouvelle valeur d'index i etant l'ancienne valeur d'index ivInitialIndexes[i]
+	// A redefinir dans chaque sous-classe
+	virtual void PermuteValues(const IntVector* ivInitialIndexes) = 0;
+
 	// Vecteur des index sparse
 	IntVector ivSparseIndexes;
 };
@@ -104,6 +111,9 @@ public:
 	///////////////////////////////////////////////////////////////////
 	///// Implementation
 protected:
+	// Reimplementation de la permutation des valeurs
+	void PermuteValues(const IntVector* ivInitialIndexes) override;
+
 	// Vecteur des valeurs associees aux cle
 	ContinuousVector cvValues;
 };
@@ -145,6 +155,9 @@ public:
 	///////////////////////////////////////////////////////////////////
 	///// Implementation
 protected:
+	// Reimplementation de la permutation des valeurs
+	void PermuteValues(const IntVector* ivInitialIndexes) override;
+
 	// Vecteur des valeurs associees aux cle
 	SymbolVector svValues;
 };
@@ -189,6 +202,9 @@ public:
 	///////////////////////////////////////////////////////////////////
 	///// Implementation
 protected:
+	// Reimplementation de la permutation des valeurs
+	void PermuteValues(const IntVector* ivInitialIndexes) override;
+
 	// Vecteur des valeurs associees aux cle
 	ObjectArray oaValues;
 };
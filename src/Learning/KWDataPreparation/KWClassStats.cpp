@@ -71,6 +71,9 @@ boolean KWClassStats::ComputeStats()
 	longint lCollectedObjectNumber;
 	KWTupleTableLoader tupleTableLoader;
 	KWTupleTable targetTupleTable;
+	int nApproximateQuantileBinNumber;
+	ObjectDictionary odContinuousBinUpperBounds;
+	ContinuousVector* cvBinUpperBounds;
 	int nUsedAttributeNumber;
 	int nMaxLoadableAttributeNumber;
 	int i;
@@ -110,6 +113,23 @@ boolean KWClassStats::ComputeStats()
 	svSymbolTargetValues = new SymbolVector;
 	cvContinuousTargetValues = new ContinuousVector;
 
+	// En mode approximatif, on calcule lors de la collecte des stats de base un sketch de quantiles par attribut
+	// numerique dense, qui servira a granulariser ses valeurs en bins avant la discretisation
+	nApproximateQuantileBinNumber = GetLearningApproximateQuantileBinNumber();
+	if (nApproximateQuantileBinNumber > 0)
+	{
+		AddSimpleMessage(sTmp + "Approximate discretization of numerical variables using " +
+				 IntToString(nApproximateQuantileBinNumber) + " quantile bins");
+		for (i = 0; i < GetClass()->GetLoadedDenseAttributeNumber(); i++)
+		{
+			attribute = GetClass()->GetLoadedDenseAttributeAt(i);
+			if (attribute->GetType() == KWType::Continuous and
+			    attribute->GetName() != GetTargetAttributeName())
+				databaseBasicClassStatsTask.GetQuantileSketchAttributeNames()->Add(
+				    attribute->GetName());
+		}
+	}
+
 	// Collecte des stats de base, avec message d'erreur en cas d'echec
 	// On se place en mode non verbeux, car les erreurs seront de toutes facon detectees lors des passes suivantes
 	if (bOk)
@@ -176,6 +196,17 @@ boolean KWClassStats::ComputeStats()
 		}
 		tupleTableLoader.SetInputExtraAttributeTupleTable(&targetTupleTable);
 
+		// Calcul des bornes de bins des attributs numeriques a partir de leur sketch de quantiles
+		for (i = 0; i < databaseBasicClassStatsTask.GetQuantileSketches()->GetSize(); i++)
+		{
+			cvBinUpperBounds = new ContinuousVector;
+			cast(KWQuantileSketch*, databaseBasicClassStatsTask.GetQuantileSketches()->GetAt(i))
+			    ->ExportBinUpperBounds(nApproximateQuantileBinNumber, cvBinUpperBounds);
+			odContinuousBinUpperBounds.SetAt(
+			    databaseBasicClassStatsTask.GetQuantileSketchAttributeNames()->GetAt(i), cvBinUpperBounds);
+		}
+		databaseBasicClassStatsTask.GetQuantileSketches()->DeleteAll();
+
 		// Calcul des valeurs cibles
 		bOk = GetLearningSpec()->ComputeTargetStats(&targetTupleTable);
 		assert(not bOk or GetInstanceNumber() == lCollectedObjectNumber);
@@ -272,9 +303,16 @@ boolean KWClassStats::ComputeStats()
 	bOk = bOk and not TaskProgression::IsInterruptionRequested();
 	if (bOk)
 	{
+		// Parametrage des bornes de bins des attributs numeriques en mode approximatif, uniquement pour
+		// la preparation univariee
+		if (odContinuousBinUpperBounds.GetCount() > 0)
+			tupleTableLoader.SetInputContinuousBinUpperBounds(&odContinuousBinUpperBounds);
+
 		// La tache gere sa propre progression
 		bOk = univariateDataPreparationTask.CollectPreparationStats(
 		    GetLearningSpec(), &tupleTableLoader, dataTableSliceSet, &odUnivariateAttributeStats);
+		tupleTableLoader.SetInputContinuousBinUpperBounds(NULL);
+		odContinuousBinUpperBounds.DeleteAll();
 
 		// On range les statistiques par attributs dans le meme ordre que dans la classe initiale
 		if (bOk)
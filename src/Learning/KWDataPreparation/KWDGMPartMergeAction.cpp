@@ -246,7 +246,7 @@ KWDGMPart* KWDGMPartMergeAction::PerformPartMerge(KWDGMPartMerge* partMerge)
 
 		// Mise a jour du groupe poubelle selon les caracteristiques enregistrees dans le partMerge
 		if (bGarbagePresence)
-			attribute->SetGarbagePart(cast(KWDGPart*, attribute->slPartValueNumbers->GetHead()));
+			attribute->SetGarbagePart(cast(KWDGPart*, attribute->ihPartValueNumbers->GetHead()));
 		else
 			attribute->SetGarbagePart(NULL);
 	}
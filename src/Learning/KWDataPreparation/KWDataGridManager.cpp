@@ -831,16 +831,13 @@ void KWDataGridManager::ExportCells(const KWDataGrid* sourceDataGrid, KWDataGrid
 	KWDGCell* targetCell;
 	int nAttribute;
 	ObjectArray oaSourceAttributes;
+	ObjectArray oaTargetPartDictionaries;
+	NumericKeyDictionary* nkdTargetParts;
 	ObjectArray oaTargetParts;
 	KWDGAttribute* sourceAttribute;
 	KWDGAttribute* targetAttribute;
 	KWDGPart* sourcePart;
 	KWDGPart* targetPart;
-	Continuous cValue;
-	Symbol sValue;
-	KWDGPart* sourceVarPart;
-	KWDGPart* targetVarPart;
-	KWDGAttribute* innerAttribute;
 
 	require(Check());
 	require(targetDataGrid != NULL and CheckTargetValues(sourceDataGrid, targetDataGrid) and
@@ -854,7 +851,11 @@ void KWDataGridManager::ExportCells(const KWDataGrid* sourceDataGrid, KWDataGrid
 
 	// Collecte une fois pour toutes des attributs sources correspondant aux attributs cibles,
 	// car il faudra y acceder rapidement autant de fois qu'il y a de cellules
+	// On associe egalement une fois pour toutes chaque partie source a sa partie cible: les parties
+	// sources etant en general bien moins nombreuses que les cellules, on evite ainsi de rechercher
+	// la partie cible (par valeur typique) pour chaque cellule
 	oaSourceAttributes.SetSize(targetDataGrid->GetAttributeNumber());
+	oaTargetPartDictionaries.SetSize(targetDataGrid->GetAttributeNumber());
 	for (nAttribute = 0; nAttribute < targetDataGrid->GetAttributeNumber(); nAttribute++)
 	{
 		targetAttribute = targetDataGrid->GetAttributeAt(nAttribute);
@@ -865,87 +866,36 @@ void KWDataGridManager::ExportCells(const KWDataGrid* sourceDataGrid, KWDataGrid
 
 		// Memorisation au meme index
 		oaSourceAttributes.SetAt(nAttribute, sourceAttribute);
+
+		// Memorisation de la partie cible de chaque partie source
+		nkdTargetParts = new NumericKeyDictionary;
+		oaTargetPartDictionaries.SetAt(nAttribute, nkdTargetParts);
+		sourcePart = sourceAttribute->GetHeadPart();
+		while (sourcePart != NULL)
+		{
+			targetPart = LookupTargetPart(sourcePart, targetAttribute);
+			check(targetPart);
+			nkdTargetParts->SetAt(sourcePart, targetPart);
+			sourceAttribute->GetNextPart(sourcePart);
+		}
 	}
 
 	// Transfert des cellules sources
 	sourceCell = sourceDataGrid->GetHeadCell();
 	while (sourceCell != NULL)
 	{
-		// Recherche des parties cible pour les valeurs de la cellule courante
+		// Recherche des parties cible pour les parties de la cellule courante
 		for (nAttribute = 0; nAttribute < targetDataGrid->GetAttributeNumber(); nAttribute++)
 		{
-			targetAttribute = targetDataGrid->GetAttributeAt(nAttribute);
-
 			// Recherche de l'attribut source correspondant dans le tableau ou ils ont ete collectes
 			sourceAttribute = cast(KWDGAttribute*, oaSourceAttributes.GetAt(nAttribute));
 
-			// Recherche de la partie associee a la cellule selon son type
+			// Recherche de la partie cible associee a la partie source de la cellule
 			sourcePart = sourceCell->GetPartAt(sourceAttribute->GetAttributeIndex());
-
-			// Cas d'une partie de type Continuous
-			if (sourcePart->GetPartType() == KWType::Continuous)
-			{
-				// Recherche d'une valeur typique: le milieu de l'intervalle (hors borne inf)
-				cValue = KWContinuous::GetUpperMeanValue(sourcePart->GetInterval()->GetLowerBound(),
-									 sourcePart->GetInterval()->GetUpperBound());
-
-				// Recherche de l'intervalle cible correspondant
-				targetPart = targetAttribute->LookupContinuousPart(cValue);
-				oaTargetParts.SetAt(nAttribute, targetPart);
-			}
-			// Cas d'une partie de type Symbol
-			else if (sourcePart->GetPartType() == KWType::Symbol)
-			{
-				// Recherche d'une valeur typique: la premiere valeur
-				assert(sourcePart->GetValueSet()->GetHeadValue() != NULL);
-				sValue = sourcePart->GetValueSet()->GetHeadValue()->GetSymbolValue();
-
-				// Recherche du groupe de valeurs cible correspondant
-				targetPart = targetAttribute->LookupSymbolPart(sValue);
-				oaTargetParts.SetAt(nAttribute, targetPart);
-			}
-			// Cas d'une partie de type partie de variable
-			else
-			{
-				// Recherche d'une partie de variable typique : la premiere partie de variable
-				assert(sourcePart->GetVarPartSet()->GetHeadValue() != NULL);
-
-				sourceVarPart = sourcePart->GetVarPartSet()->GetHeadValue()->GetVarPart();
-
-				// Recherche de la partie de variable cible qui contient cette partie de variable source
-				// (suite a la granularisation) Extraction de l'attribut de cette partie de variable
-				innerAttribute = targetAttribute->GetInnerAttributes()->LookupInnerAttribute(
-				    sourceVarPart->GetAttribute()->GetAttributeName());
-
-				// Cas d'une partie de variable continue
-				if (sourceVarPart->GetPartType() == KWType::Continuous)
-				{
-					// Recherche d'une valeur typique: le milieu de l'intervalle (hors borne inf)
-					cValue = KWContinuous::GetUpperMeanValue(
-					    sourceVarPart->GetInterval()->GetLowerBound(),
-					    sourceVarPart->GetInterval()->GetUpperBound());
-
-					// Recherche de l'intervalle cible correspondant pour l'attribut interne
-					targetVarPart = innerAttribute->LookupContinuousPart(cValue);
-
-					// Recherche de la partie de l'attribut correspondant
-					targetPart = targetAttribute->LookupVarPart(targetVarPart);
-					oaTargetParts.SetAt(nAttribute, targetPart);
-				}
-				else if (sourceVarPart->GetPartType() == KWType::Symbol)
-				{
-					// Recherche d'une valeur typique: la premiere valeur
-					assert(sourceVarPart->GetValueSet()->GetHeadValue() != NULL);
-					sValue = sourceVarPart->GetValueSet()->GetHeadValue()->GetSymbolValue();
-
-					// Recherche du groupe de valeurs cible correspondant
-					targetVarPart = innerAttribute->LookupSymbolPart(sValue);
-
-					// Recherche de la partie de l'attribut correspondant
-					targetPart = targetAttribute->LookupVarPart(targetVarPart);
-					oaTargetParts.SetAt(nAttribute, targetPart);
-				}
-			}
+			nkdTargetParts = cast(NumericKeyDictionary*, oaTargetPartDictionaries.GetAt(nAttribute));
+			targetPart = cast(KWDGPart*, nkdTargetParts->Lookup(sourcePart));
+			assert(targetPart == LookupTargetPart(sourcePart, targetDataGrid->GetAttributeAt(nAttribute)));
+			oaTargetParts.SetAt(nAttribute, targetPart);
 		}
 
 		// Creation de la cellule cible si necessaire
@@ -961,6 +911,9 @@ void KWDataGridManager::ExportCells(const KWDataGrid* sourceDataGrid, KWDataGrid
 		sourceDataGrid->GetNextCell(sourceCell);
 	}
 
+	// Nettoyage
+	oaTargetPartDictionaries.DeleteAll();
+
 	// Fin du mode update
 	targetDataGrid->SetCellUpdateMode(false);
 	targetDataGrid->DeleteIndexingStructure();
@@ -4187,6 +4140,82 @@ int KWDataGridManager::InitializeQuantileGroupBuilder(const KWDGAttribute* attri
 	return nMaxPartNumber;
 }
 
+KWDGPart* KWDataGridManager::LookupTargetPart(const KWDGPart* sourcePart,
+					       const KWDGAttribute* targetAttribute) const
+{
+	KWDGPart* targetPart;
+	KWDGPart* sourceVarPart;
+	KWDGPart* targetVarPart;
+	KWDGAttribute* innerAttribute;
+	Continuous cValue;
+	Symbol sValue;
+
+	require(sourcePart != NULL);
+	require(targetAttribute != NULL);
+	require(targetAttribute->IsIndexed());
+
+	// Cas d'une partie de type Continuous
+	targetPart = NULL;
+	if (sourcePart->GetPartType() == KWType::Continuous)
+	{
+		// Recherche d'une valeur typique: le milieu de l'intervalle (hors borne inf)
+		cValue = KWContinuous::GetUpperMeanValue(sourcePart->GetInterval()->GetLowerBound(),
+							 sourcePart->GetInterval()->GetUpperBound());
+
+		// Recherche de l'intervalle cible correspondant
+		targetPart = targetAttribute->LookupContinuousPart(cValue);
+	}
+	// Cas d'une partie de type Symbol
+	else if (sourcePart->GetPartType() == KWType::Symbol)
+	{
+		// Recherche d'une valeur typique: la premiere valeur
+		assert(sourcePart->GetValueSet()->GetHeadValue() != NULL);
+		sValue = sourcePart->GetValueSet()->GetHeadValue()->GetSymbolValue();
+
+		// Recherche du groupe de valeurs cible correspondant
+		targetPart = targetAttribute->LookupSymbolPart(sValue);
+	}
+	// Cas d'une partie de type partie de variable
+	else
+	{
+		// Recherche d'une partie de variable typique : la premiere partie de variable
+		assert(sourcePart->GetVarPartSet()->GetHeadValue() != NULL);
+		sourceVarPart = sourcePart->GetVarPartSet()->GetHeadValue()->GetVarPart();
+
+		// Recherche de la partie de variable cible qui contient cette partie de variable source
+		// (suite a la granularisation) Extraction de l'attribut de cette partie de variable
+		innerAttribute = targetAttribute->GetInnerAttributes()->LookupInnerAttribute(
+		    sourceVarPart->GetAttribute()->GetAttributeName());
+
+		// Cas d'une partie de variable continue
+		if (sourceVarPart->GetPartType() == KWType::Continuous)
+		{
+			// Recherche d'une valeur typique: le milieu de l'intervalle (hors borne inf)
+			cValue = KWContinuous::GetUpperMeanValue(sourceVarPart->GetInterval()->GetLowerBound(),
+								 sourceVarPart->GetInterval()->GetUpperBound());
+
+			// Recherche de l'intervalle cible correspondant pour l'attribut interne
+			targetVarPart = innerAttribute->LookupContinuousPart(cValue);
+
+			// Recherche de la partie de l'attribut correspondant
+			targetPart = targetAttribute->LookupVarPart(targetVarPart);
+		}
+		else if (sourceVarPart->GetPartType() == KWType::Symbol)
+		{
+			// Recherche d'une valeur typique: la premiere valeur
+			assert(sourceVarPart->GetValueSet()->GetHeadValue() != NULL);
+			sValue = sourceVarPart->GetValueSet()->GetHeadValue()->GetSymbolValue();
+
+			// Recherche du groupe de valeurs cible correspondant
+			targetVarPart = innerAttribute->LookupSymbolPart(sValue);
+
+			// Recherche de la partie de l'attribut correspondant
+			targetPart = targetAttribute->LookupVarPart(targetVarPart);
+		}
+	}
+	return targetPart;
+}
+
 void KWDataGridManager::ExportAttributeSymbolValueFrequencies(const KWDGAttribute* sourceAttribute,
 							      KWDGAttribute* targetAttribute) const
 {
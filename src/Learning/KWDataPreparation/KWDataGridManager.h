@@ -421,6 +421,10 @@ protected:
 	int InitializeQuantileGroupBuilder(const KWDGAttribute* attribute,
 					   KWQuantileGroupBuilder* quantileGroupBuilder) const;
 
+	// Recherche de la partie d'un attribut cible (indexe) contenant une partie source, a partir
+	// d'une valeur typique de la partie source
+	KWDGPart* LookupTargetPart(const KWDGPart* sourcePart, const KWDGAttribute* targetAttribute) const;
+
 	// Export des effectifs des valeurs de la grille initiale vers un attribut categoriel entierement specifie
 	// La valeur speciale recoit pour effectif l'ensemble des effectifs manquants
 	void ExportAttributeSymbolValueFrequencies(const KWDGAttribute* sourceAttribute,
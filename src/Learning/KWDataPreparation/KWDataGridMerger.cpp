@@ -439,7 +439,7 @@ void KWDataGridMerger::InitializeAllPartLists()
 			{
 				cout << " KWDataGridMerger::InitializeAllPartLists() " << endl;
 				cout << " Attribute\t " << attributeM->GetAttributeName() << endl;
-				cout << *(attributeM->slPartValueNumbers) << endl;
+				cout << *(attributeM->ihPartValueNumbers) << endl;
 			}
 		}
 	}
@@ -599,7 +599,8 @@ void KWDataGridMerger::WriteAllPartMerges(ostream& ost) const
 	KWDGAttribute* attribute;
 	KWDGMAttribute* attributeM;
 	KWDGMPartMerge* partMerge;
-	POSITION position;
+	ObjectArray oaPartMerges;
+	int nMerge;
 	boolean bWriteHeader;
 
 	// Parcours des attributs du DataGrid
@@ -609,11 +610,15 @@ void KWDataGridMerger::WriteAllPartMerges(ostream& ost) const
 		attribute = GetAttributeAt(nAttribute);
 		attributeM = cast(KWDGMAttribute*, attribute);
 
+		// Tri des fusions de l'attribut, le tas ne permettant pas un parcours ordonne
+		attributeM->ihPartMerges->ExportObjectArray(&oaPartMerges);
+		oaPartMerges.SetCompareFunction(KWDGMPartMergeCompare);
+		oaPartMerges.Sort();
+
 		// Affichage des fusions de parties pour l'attribut
-		position = attributeM->slPartMerges->GetHeadPosition();
-		while (position != NULL)
+		for (nMerge = 0; nMerge < oaPartMerges.GetSize(); nMerge++)
 		{
-			partMerge = cast(KWDGMPartMerge*, attributeM->slPartMerges->GetNext(position));
+			partMerge = cast(KWDGMPartMerge*, oaPartMerges.GetAt(nMerge));
 			if (bWriteHeader)
 			{
 				partMerge->WriteHeaderLine(ost);
@@ -631,7 +636,8 @@ boolean KWDataGridMerger::CheckAllPartMerges() const
 	KWDGAttribute* attribute;
 	KWDGMAttribute* attributeM;
 	KWDGMPartMerge* partMerge;
-	POSITION position;
+	ObjectArray oaPartMerges;
+	int nMerge;
 	ALString sTmp;
 
 	// Verification des couts des composantes du DataGrid
@@ -655,31 +661,31 @@ boolean KWDataGridMerger::CheckAllPartMerges() const
 		// Verification du nombre de fusions de l'attribut selon son type
 		if (attribute->GetAttributeType() == KWType::Continuous)
 		{
-			if (attributeM->slPartMerges->GetCount() != attributeM->GetPartNumber() - 1)
+			if (attributeM->ihPartMerges->GetCount() != attributeM->GetPartNumber() - 1)
 			{
 				bOk = false;
 				attributeM->AddError(sTmp + "Bad number of merges: " +
-						     IntToString(attributeM->slPartMerges->GetCount()) + " for " +
+						     IntToString(attributeM->ihPartMerges->GetCount()) + " for " +
 						     IntToString(attributeM->GetPartNumber()) + " parts");
 			}
 		}
 		else
 		{
-			if (attributeM->slPartMerges->GetCount() !=
+			if (attributeM->ihPartMerges->GetCount() !=
 			    attributeM->GetPartNumber() * (attributeM->GetPartNumber() - 1) / 2)
 			{
 				bOk = false;
 				attributeM->AddError(sTmp + "Bad number of merges: " +
-						     IntToString(attributeM->slPartMerges->GetCount()) + " for " +
+						     IntToString(attributeM->ihPartMerges->GetCount()) + " for " +
 						     IntToString(attributeM->GetPartNumber()) + " parts");
 			}
 		}
 
 		// Verification des fusions de parties pour l'attribut
-		position = attributeM->slPartMerges->GetHeadPosition();
-		while (position != NULL)
+		attributeM->ihPartMerges->ExportObjectArray(&oaPartMerges);
+		for (nMerge = 0; nMerge < oaPartMerges.GetSize(); nMerge++)
 		{
-			partMerge = cast(KWDGMPartMerge*, attributeM->slPartMerges->GetNext(position));
+			partMerge = cast(KWDGMPartMerge*, oaPartMerges.GetAt(nMerge));
 
 			// Verification de la fusion
 			if (not partMerge->Check())
@@ -955,7 +961,7 @@ double KWDataGridMerger::SearchBestPartMergeWithGarbageSearch(KWDGMPartMerge*& b
 				// Cas ou les deux parties fusionnees deviennent le groupe poubelle
 				if (partMerge->GetPart1()->GetValueSet()->GetValueNumber() +
 					partMerge->GetPart2()->GetValueSet()->GetValueNumber() >
-				    cast(KWDGPart*, attributeM->slPartValueNumbers->GetHead())
+				    cast(KWDGPart*, attributeM->ihPartValueNumbers->GetHead())
 					->GetValueSet()
 					->GetValueNumber())
 				{
@@ -974,7 +980,7 @@ double KWDataGridMerger::SearchBestPartMergeWithGarbageSearch(KWDGMPartMerge*& b
 				// Sinon : on garde le meme groupe poubelle
 				else
 					attributeM->SetGarbagePart(
-					    cast(KWDGPart*, attributeM->slPartValueNumbers->GetHead()));
+					    cast(KWDGPart*, attributeM->ihPartValueNumbers->GetHead()));
 
 				// Variation de cout locale a l'attribut
 				dAttributeDeltaCost = GetDataGridCosts()->ComputeAttributeCost(
@@ -1041,7 +1047,7 @@ double KWDataGridMerger::SearchBestPartMergeWithGarbageSearch(KWDGMPartMerge*& b
 					attribute->SetGarbagePart(NULL);
 				else
 					attribute->SetGarbagePart(
-					    cast(KWDGPart*, attributeM->slPartValueNumbers->GetHead()));
+					    cast(KWDGPart*, attributeM->ihPartValueNumbers->GetHead()));
 			}
 		}
 	}
@@ -1822,19 +1828,19 @@ int KWDataGridMerger::ComputeProductModulo(int nFactor1, int nFactor2, int nModu
 
 KWDGMAttribute::KWDGMAttribute()
 {
-	slPartMerges = new SortedList(KWDGMPartMergeCompare);
+	ihPartMerges = new IndexedHeap(KWDGMPartMergeCompare);
 	nHash = 0;
 	nHash2 = 0;
 	dCost = 0;
-	slPartValueNumbers = new SortedList(KWDGMPartValueNumberCompare);
+	ihPartValueNumbers = new IndexedHeap(KWDGMPartValueNumberCompare);
 }
 
 KWDGMAttribute::~KWDGMAttribute()
 {
 	DeleteAllPartMerges();
-	delete slPartMerges;
+	delete ihPartMerges;
 	RemoveAllPartsFromValueNumberList();
-	delete slPartValueNumbers;
+	delete ihPartValueNumbers;
 }
 
 longint KWDGMAttribute::GetUsedMemory() const
@@ -1843,8 +1849,8 @@ longint KWDGMAttribute::GetUsedMemory() const
 
 	lUsedMemory = KWDGAttribute::GetUsedMemory();
 	lUsedMemory += sizeof(KWDGMAttribute) - sizeof(KWDGAttribute);
-	if (slPartMerges != NULL)
-		lUsedMemory += slPartMerges->GetCount() * (sizeof(AVLNode) + sizeof(ListNode) + sizeof(KWDGMPartMerge));
+	if (ihPartMerges != NULL)
+		lUsedMemory += ihPartMerges->GetUsedMemory() + ihPartMerges->GetCount() * sizeof(KWDGMPartMerge);
 	return lUsedMemory;
 }
 
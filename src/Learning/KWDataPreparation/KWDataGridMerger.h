@@ -15,6 +15,7 @@ class KWDGMPartMerge;
 #include "KWDataGridManager.h"
 #include "KWStat.h"
 #include "KWDGMPartMergeAction.h"
+#include "IndexedHeap.h"
 
 //////////////////////////////////////////////////////////////////////////////////
 // Classe KWDataGridMerger
@@ -263,8 +264,10 @@ protected:
 	// Destruction de toutes les fusions
 	void DeleteAllPartMerges();
 
-	// Liste de toutes les fusions de parties de l'attribut
-	SortedList* slPartMerges;
+	// Tas de toutes les fusions de parties de l'attribut, pour l'acces a la meilleure fusion
+	// La fonction de comparaison des fusions definit un ordre total (departage des ex-aequo selon
+	// les libelles des parties), ce qui garantit la reproductibilite des resultats
+	IndexedHeap* ihPartMerges;
 
 	// Ajout d'une partie avec son nombre de modalites
 	void AddPartToValueNumberList(KWDGMPart* partM);
@@ -275,8 +278,8 @@ protected:
 	// Supression de toutes les parties
 	void RemoveAllPartsFromValueNumberList();
 
-	// Liste des nombres de modalites pour chaque partie de l'attribut
-	SortedList* slPartValueNumbers;
+	// Tas des parties de l'attribut selon leur nombre de modalites, pour l'acces a la plus grosse partie
+	IndexedHeap* ihPartValueNumbers;
 
 	// Cles de hashage, pour gerer la table de hash des cellules
 	int nHash;
@@ -300,7 +303,7 @@ public:
 	void SetCost(double dValue);
 	double GetCost() const;
 
-	// Position dans une liste triee des nombres de modalites par partie (categoriel)
+	// Position dans le tas des nombres de modalites par partie (categoriel)
 	void SetPosition(POSITION pos);
 	POSITION GetPosition() const;
 
@@ -351,7 +354,7 @@ protected:
 	// Dictionnaire des fusions
 	NumericKeyDictionary nkdPartMerges;
 
-	// Dans le cas ou valueSet n'est pas nul, on renseigne aussi sa position dans une liste triee par nombre de
+	// Dans le cas ou valueSet n'est pas nul, on renseigne aussi sa position dans un tas trie par nombre de
 	// modalites des parties
 	POSITION position;
 
@@ -432,7 +435,7 @@ public:
 	void SetMergeCost(double dValue);
 	double GetMergeCost() const;
 
-	// Position dans une liste
+	// Position dans le tas des fusions
 	void SetPosition(POSITION pos);
 	POSITION GetPosition() const;
 
@@ -473,7 +476,7 @@ protected:
 	double dMergeCost;
 	double dTruncatedMergeCost;
 
-	// Position dans une liste
+	// Position dans le tas des fusions
 	POSITION position;
 
 	// Presence d'un groupe poubelle pour l'attribut apres ce merge
@@ -527,7 +530,7 @@ inline void KWDGMAttribute::AddPartToValueNumberList(KWDGMPart* partM)
 	require(partM->GetAttribute() == this);
 	require(partM->GetPosition() == NULL);
 
-	partM->SetPosition(slPartValueNumbers->Add(partM));
+	partM->SetPosition(ihPartValueNumbers->Add(partM));
 }
 
 inline void KWDGMAttribute::RemovePartFromValueNumberList(KWDGMPart* partM)
@@ -536,9 +539,9 @@ inline void KWDGMAttribute::RemovePartFromValueNumberList(KWDGMPart* partM)
 	require(partM->Check());
 	require(partM->GetAttribute() == this);
 	require(partM->GetPosition() != NULL);
-	require(slPartValueNumbers->GetAt(partM->GetPosition()) == partM);
+	require(ihPartValueNumbers->GetAt(partM->GetPosition()) == partM);
 
-	slPartValueNumbers->RemoveAt(partM->GetPosition());
+	ihPartValueNumbers->RemoveAt(partM->GetPosition());
 	partM->SetPosition(NULL);
 }
 
@@ -547,9 +550,9 @@ inline void KWDGMAttribute::RemoveAllPartsFromValueNumberList()
 	KWDGPart* part;
 	KWDGMPart* partM;
 
-	slPartValueNumbers->RemoveAll();
+	ihPartValueNumbers->RemoveAll();
 
-	// Dereferencement des positions dans la liste qui vient d'etre detruite
+	// Dereferencement des positions dans le tas qui vient d'etre detruite
 	part = GetHeadPart();
 	while (part != NULL)
 	{
@@ -566,22 +569,22 @@ inline void KWDGMAttribute::AddPartMerge(KWDGMPartMerge* partMerge)
 	require(partMerge->GetPart1()->GetAttribute() == this);
 	require(partMerge->GetPosition() == NULL);
 
-	partMerge->SetPosition(slPartMerges->Add(partMerge));
+	partMerge->SetPosition(ihPartMerges->Add(partMerge));
 }
 
 inline KWDGMPartMerge* KWDGMAttribute::GetBestPartMerge()
 {
 	KWDGMPartMerge* partMerge;
 
-	if (slPartMerges->IsEmpty())
+	if (ihPartMerges->IsEmpty())
 		return NULL;
 	else
 	{
-		partMerge = cast(KWDGMPartMerge*, slPartMerges->GetHead());
+		partMerge = cast(KWDGMPartMerge*, ihPartMerges->GetHead());
 		ensure(partMerge->Check());
 		ensure(partMerge->GetPart1()->GetAttribute() == this);
 		ensure(partMerge->GetPosition() != NULL);
-		ensure(slPartMerges->GetAt(partMerge->GetPosition()) == partMerge);
+		ensure(ihPartMerges->GetAt(partMerge->GetPosition()) == partMerge);
 		return partMerge;
 	}
 }
@@ -592,9 +595,9 @@ inline void KWDGMAttribute::RemovePartMerge(KWDGMPartMerge* partMerge)
 	require(partMerge->Check());
 	require(partMerge->GetPart1()->GetAttribute() == this);
 	require(partMerge->GetPosition() != NULL);
-	require(slPartMerges->GetAt(partMerge->GetPosition()) == partMerge);
+	require(ihPartMerges->GetAt(partMerge->GetPosition()) == partMerge);
 
-	slPartMerges->RemoveAt(partMerge->GetPosition());
+	ihPartMerges->RemoveAt(partMerge->GetPosition());
 	partMerge->SetPosition(NULL);
 }
 
@@ -602,18 +605,18 @@ inline ObjectArray* KWDGMAttribute::GetAllPartMerges()
 {
 	ObjectArray* oaResults;
 	oaResults = new ObjectArray;
-	slPartMerges->ExportObjectArray(oaResults);
+	ihPartMerges->ExportObjectArray(oaResults);
 	return oaResults;
 }
 
 inline void KWDGMAttribute::RemoveAllPartMerges()
 {
-	slPartMerges->RemoveAll();
+	ihPartMerges->RemoveAll();
 }
 
 inline void KWDGMAttribute::DeleteAllPartMerges()
 {
-	slPartMerges->DeleteAll();
+	ihPartMerges->DeleteAll();
 }
 
 // Classe KWDGMPart
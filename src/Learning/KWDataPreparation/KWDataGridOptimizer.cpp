@@ -318,6 +318,7 @@ double KWDataGridOptimizer::VNSOptimizeDataGrid(const KWDataGrid* initialDataGri
 	int nIndex;
 	const int nMaxTrialNumber = 2;
 	int nTrial;
+	int nImprovementNumber;
 	ALString sTmp;
 
 	require(initialDataGrid != NULL);
@@ -335,11 +336,18 @@ double KWDataGridOptimizer::VNSOptimizeDataGrid(const KWDataGrid* initialDataGri
 	// On optimise en partant de la taille max de voisinnage pour trouver une premier solution en partant d'une solution aleatoire
 	// On continue tant qu'il y a amelioration, avec un nombre d'essai max s'il n'y a pas d'amelioration
 	// Puis on itere en diminuant d'une facteur 2 la taille du voisinnage pour affiner la solution
+	// Chaque essai a partir de la solution courante est un depart independant, dont la graine aleatoire ne depend
+	// que de sa position dans la meta-heuristique: les essais sont ainsi evaluables dans n'importe quel ordre
+	// (voire de facon concurrente), en retenant le premier essai ameliorant par index d'essai, avec le meme
+	// resultat qu'en sequentiel
 	nVNSNeighbourhoodLevelNumber = nNeighbourhoodLevelNumber;
 	nIndex = nNeighbourhoodLevelNumber;
 	nTrial = 0;
+	nImprovementNumber = 0;
 	while (nIndex > 0)
 	{
+		nVNSNeighbourhoodLevelIndex = nIndex;
+
 		// Taille de voisinnage entre 0 et 1, maximale initialement, puis decroissant d'n facteur 2 a chaque fois
 		dVNSNeighbourhoodSize = 1 / pow(2, nNeighbourhoodLevelNumber - nIndex);
 
@@ -350,7 +358,9 @@ double KWDataGridOptimizer::VNSOptimizeDataGrid(const KWDataGrid* initialDataGri
 								nNeighbourhoodLevelNumber);
 		KWDataGridOptimizer::GetProfiler()->WriteKeyDouble("Neighbourhood size", dVNSNeighbourhoodSize);
 
-		// Optimisation d'une solution dans un voisinnage de la solution courante
+		// Optimisation d'une solution dans un voisinnage de la solution courante, avec sa graine propre
+		SetRandomSeed(
+		    ComputeNeighbourSolutionRandomSeed(nNeighbourhoodLevelNumber, nIndex, nImprovementNumber, nTrial));
 		dCost = OptimizeNeighbourSolution(initialDataGrid, optimizedDataGrid, dVNSNeighbourhoodSize,
 						  &neighbourDataGrid, true);
 
@@ -367,8 +377,9 @@ double KWDataGridOptimizer::VNSOptimizeDataGrid(const KWDataGrid* initialDataGri
 			// Gestion de la meilleure solution
 			HandleOptimizationStep(optimizedDataGrid, initialDataGrid);
 
-			// On reinitialise le nombre d'essais
+			// On reinitialise le nombre d'essais a partir de la nouvelle solution courante
 			nTrial = 0;
+			nImprovementNumber++;
 		}
 		// Sinon: on passe a un niveau de voisinnage suivant
 		else
@@ -630,6 +641,28 @@ int KWDataGridOptimizer::ComputeNeighbourSolutionAddedPartNumber(const KWDataGri
 	return nAddedPartNumber;
 }
 
+int KWDataGridOptimizer::ComputeNeighbourSolutionRandomSeed(int nNeighbourhoodLevelNumber, int nNeighbourhoodLevelIndex,
+							    int nImprovementIndex, int nTrialIndex) const
+{
+	longint lIndex;
+	int nSeed;
+
+	require(nNeighbourhoodLevelNumber >= 0);
+	require(0 <= nNeighbourhoodLevelIndex and nNeighbourhoodLevelIndex <= nNeighbourhoodLevelNumber);
+	require(nImprovementIndex >= 0);
+	require(nTrialIndex >= 0);
+
+	// Index de l'essai dans la meta-heuristique
+	lIndex = LongintUpdateHashValue(nNeighbourhoodLevelNumber, nNeighbourhoodLevelIndex);
+	lIndex = LongintUpdateHashValue(lIndex, nImprovementIndex);
+	lIndex = LongintUpdateHashValue(lIndex, nTrialIndex);
+
+	// Graine aleatoire strictement positive associee a cet index
+	nSeed = 1 + IthRandomInt(lIndex, INT_MAX - 2);
+	ensure(nSeed > 0);
+	return nSeed;
+}
+
 void KWDataGridOptimizer::SaveDataGrid(const KWDataGrid* sourceDataGrid, KWDataGrid* targetDataGrid) const
 {
 	KWDataGridManager dataGridManager;
@@ -185,6 +185,12 @@ protected:
 	int ComputeNeighbourSolutionAddedPartNumber(const KWDataGrid* initialDataGrid, int nNeighbourAttributeNumber,
 						    double dNeighbourhoodSize) const;
 
+	// Calcul de la graine aleatoire d'un essai de l'optimisation VNS, en fonction uniquement de sa position:
+	// nombre de niveaux de voisinnage, index du niveau courant, nombre d'ameliorations deja obtenues
+	// et index de l'essai parmi ceux partant de la meme solution courante
+	int ComputeNeighbourSolutionRandomSeed(int nNeighbourhoodLevelNumber, int nNeighbourhoodLevelIndex,
+					       int nImprovementIndex, int nTrialIndex) const;
+
 	// Sauvegarde d'une grille source dans une grille cible
 	void SaveDataGrid(const KWDataGrid* sourceDataGrid, KWDataGrid* targetDataGrid) const;
 
@@ -11,6 +11,8 @@ KWDataPreparationTask::KWDataPreparationTask()
 	DeclareSharedParameter(&shared_svTargetValues);
 	DeclareSharedParameter(&shared_cvTargetValues);
 	DeclareSharedParameter(&shared_TargetTupleTable);
+	shared_odContinuousBinUpperBounds = new PLShared_ObjectDictionary(new PLShared_ContinuousVector);
+	DeclareSharedParameter(shared_odContinuousBinUpperBounds);
 
 	// Initialisation des variables du maitre
 	masterDataTableSliceSet = NULL;
@@ -18,7 +20,10 @@ KWDataPreparationTask::KWDataPreparationTask()
 	masterDatabase = NULL;
 }
 
-KWDataPreparationTask::~KWDataPreparationTask() {}
+KWDataPreparationTask::~KWDataPreparationTask()
+{
+	delete shared_odContinuousBinUpperBounds;
+}
 
 int KWDataPreparationTask::ComputeMaxLoadableAttributeNumber(const KWLearningSpec* learningSpec,
 							     const KWTupleTable* targetTupleTable,
@@ -1135,6 +1140,8 @@ boolean KWDataPreparationTask::RunDataPreparationTask(KWLearningSpec* learningSp
 	    cast(ContinuousVector*, tupleTableLoader->GetInputExtraAttributeContinuousValues()));
 	shared_TargetTupleTable.SetTupleTable(
 	    cast(KWTupleTable*, tupleTableLoader->GetInputExtraAttributeTupleTable()));
+	shared_odContinuousBinUpperBounds->SetObjectDictionary(
+	    cast(ObjectDictionary*, tupleTableLoader->GetInputContinuousBinUpperBounds()));
 
 	// Parametrage des variables du maitre
 	masterDataTableSliceSet = dataTableSliceSet;
@@ -1160,6 +1167,7 @@ boolean KWDataPreparationTask::RunDataPreparationTask(KWLearningSpec* learningSp
 	shared_svTargetValues.RemoveObject();
 	shared_cvTargetValues.RemoveObject();
 	shared_TargetTupleTable.RemoveObject();
+	shared_odContinuousBinUpperBounds->RemoveObject();
 
 	// Nettoyage des variables du maitre
 	masterDataTableSliceSet = NULL;
@@ -1219,6 +1227,10 @@ boolean KWDataPreparationTask::SlaveInitialize()
 		       slaveTupleTableLoader.GetInputExtraAttributeTupleTable()->GetTotalFrequency());
 		slaveTupleTableLoader.SetInputExtraAttributeSymbolValues(shared_svTargetValues.GetConstSymbolVector());
 	}
+
+	// Initialisation des bornes de bins eventuelles des attributs numeriques
+	slaveTupleTableLoader.SetInputContinuousBinUpperBounds(
+	    shared_odContinuousBinUpperBounds->GetObjectDictionary());
 	return bOk;
 }
 
@@ -201,6 +201,10 @@ protected:
 	PLShared_ContinuousVector shared_cvTargetValues;
 	PLShared_TupleTable shared_TargetTupleTable;
 
+	// Bornes de bins des attributs numeriques a alimenter de facon approximative (NULL si aucune), pour le
+	// parametrage du tupleTableLoader local a l'esclave (cf. KWTupleTableLoader::SetInputContinuousBinUpperBounds)
+	PLShared_ObjectDictionary* shared_odContinuousBinUpperBounds;
+
 	//////////////////////////////////////////////////////
 	// Variables de l'esclave
 
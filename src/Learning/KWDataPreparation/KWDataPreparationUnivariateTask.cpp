@@ -314,6 +314,7 @@ boolean KWDataPreparationUnivariateTask::ComputeResourceRequirements()
 	longint lMeanSliceDatabaseAllValuesMemory;
 	longint lNecessaryWorkingMemory;
 	longint lNecessaryTargetAttributMemory;
+	longint lNecessaryBinUpperBoundsMemory;
 	longint lNecessaryUnivariateStatsMemory;
 
 	require(CheckInputParameters(shared_learningSpec.GetLearningSpec(), shared_TargetTupleTable.GetTupleTable()));
@@ -419,8 +420,13 @@ boolean KWDataPreparationUnivariateTask::ComputeResourceRequirements()
 	    2 * (GetResourceRequirements()->GetSlaveRequirement()->GetMemory()->GetMin() +
 		 lMaxSliceMaxBlockWorkingMemory + lMaxSliceDatabaseAllValuesMemory));
 
-	// En partage: stockage des variables partagees
-	GetResourceRequirements()->GetSharedRequirement()->GetMemory()->Set(lNecessaryTargetAttributMemory);
+	// En partage: stockage des variables partagees, dont les bornes de bins eventuelles des attributs numeriques
+	lNecessaryBinUpperBoundsMemory = 0;
+	if (shared_odContinuousBinUpperBounds->GetObjectDictionary() != NULL)
+		lNecessaryBinUpperBoundsMemory =
+		    shared_odContinuousBinUpperBounds->GetObjectDictionary()->GetOverallUsedMemory();
+	GetResourceRequirements()->GetSharedRequirement()->GetMemory()->Set(lNecessaryTargetAttributMemory +
+									   lNecessaryBinUpperBoundsMemory);
 
 	// Nombre max de processus
 	GetResourceRequirements()->SetMaxSlaveProcessNumber(masterDataTableSliceSet->GetSliceNumber());
@@ -67,7 +67,7 @@ KWTupleTable::KWTupleTable()
 	nSize = 0;
 	nTotalFrequency = 0;
 	nSparseMissingValueNumber = 0;
-	slTuples = NULL;
+	bUpdateMode = false;
 	inputTuple = NULL;
 }
 
@@ -223,38 +223,23 @@ void KWTupleTable::SortByDecreasingFrequencies()
 
 void KWTupleTable::SetUpdateMode(boolean bValue)
 {
-	int nIndex;
-	KWTuple* tuple;
-	POSITION position;
-
 	require(bValue == not GetUpdateMode());
 	require(GetSortTupleTable() == NULL);
 
-	// On parametre la table de tuple a utiliser pour les fonctions de comparaison
-	SetSortTupleTable(this);
-
 	// Passage en mode edition
 	if (bValue)
 	{
-		// Creation d'une liste triable pour inserer les tuples et garantir leur unicite
-		slTuples = new SortedList(GetCompareFunction());
-		oaTuples.SetCompareFunction(slTuples->GetCompareFunction());
-
-		// On range tous les tuples existants dans la liste triee
-		for (nIndex = 0; nIndex < oaTuples.GetSize(); nIndex++)
-		{
-			tuple = cast(KWTuple*, oaTuples.GetAt(nIndex));
-			slTuples->Add(tuple);
-		}
-		assert(oaTuples.GetSize() == slTuples->GetCount());
+		// Les tuples existants restent dans le tableau, qui n'est plus trie
+		oaTuples.SetCompareFunction(NULL);
 
-		// On vide le tableau
-		oaTuples.SetSize(0);
+		// Creation de la table de hachage pour garantir l'unicite des tuples
+		ResizeHashTable(ComputeHashTableSize(oaTuples.GetSize()));
 
 		// On met a dispotion un tuple d'edition
 		assert(inputTuple == NULL);
 		inputTuple = NewTuple();
 		inputTuple->SetFrequency(1);
+		bUpdateMode = true;
 	}
 	// Passage en mode consultation
 	else
@@ -263,50 +248,33 @@ void KWTupleTable::SetUpdateMode(boolean bValue)
 		assert(inputTuple != NULL);
 		DeleteTuple(inputTuple);
 		inputTuple = NULL;
+		bUpdateMode = false;
 
-		// On extrait les tuples de la liste triee vers le tableau
-		oaTuples.SetSize(slTuples->GetCount());
-		position = slTuples->GetHeadPosition();
-		nIndex = 0;
-		while (position != NULL)
-		{
-			tuple = cast(KWTuple*, slTuples->GetNext(position));
-			oaTuples.SetAt(nIndex, tuple);
-			nIndex++;
-		}
+		// On detruit la table de hachage
+		oaHashTableTuples.SetSize(0);
 
-		// On detruit la liste triee
-		delete slTuples;
-		slTuples = NULL;
+		// Tri des tuples, une seule fois en fin d'edition
 		assert(nSize == oaTuples.GetSize());
+		Sort();
 	}
-
-	// On remet a NULL la table de tuple a utiliser pour les fonctions de comparaison
-	SetSortTupleTable(NULL);
-
 	ensure(GetUpdateMode() == bValue);
 }
 
 const KWTuple* KWTupleTable::UpdateWithInputTuple()
 {
 	KWTuple* updateTuple;
-	POSITION updatePosition;
+	int nHashTableIndex;
 	int i;
 
 	require(GetUpdateMode());
-	require(GetSortTupleTable() == NULL);
 	require(inputTuple->GetFrequency() >= 1);
 
-	// On parametre la table de tuple a utiliser pour les fonctions de comparaison
-	// Ce parametrage est local a l'utilisation de cette methode, qui peut etre
-	// appelee en sequence pour plusieurs tables differentes
-	SetSortTupleTable(this);
-
-	// Recherche dans la liste de la position d'un tuple ayant les meme valeurs que le tuple d'entree
-	updatePosition = slTuples->Find(inputTuple);
+	// Recherche dans la table de hachage d'un tuple ayant les meme valeurs que le tuple d'entree
+	nHashTableIndex = SearchHashTableIndex(inputTuple);
+	updateTuple = cast(KWTuple*, oaHashTableTuples.GetAt(nHashTableIndex));
 
 	// Creation et insertion d'un nouveau tuple si necessaire
-	if (updatePosition == NULL)
+	if (updateTuple == NULL)
 	{
 		updateTuple = NewTuple();
 		for (i = 0; i < GetAttributeNumber(); i++)
@@ -317,25 +285,23 @@ const KWTuple* KWTupleTable::UpdateWithInputTuple()
 				updateTuple->SetContinuousAt(i, inputTuple->GetContinuousAt(i));
 		}
 		updateTuple->SetFrequency(inputTuple->GetFrequency());
-		slTuples->Add(updateTuple);
+		oaTuples.Add(updateTuple);
+		oaHashTableTuples.SetAt(nHashTableIndex, updateTuple);
 
 		// Mise a jour de l'effectif
 		nSize++;
+
+		// Retaillage de la table de hachage si elle est a moitie pleine
+		if (2 * nSize > oaHashTableTuples.GetSize())
+			ResizeHashTable(2 * oaHashTableTuples.GetSize());
 	}
 	// Sinon, mise a jour de l'effectif du tuple trouve
 	else
-	{
-		updateTuple = cast(KWTuple*, slTuples->GetAt(updatePosition));
 		updateTuple->SetFrequency(updateTuple->GetFrequency() + inputTuple->GetFrequency());
-	}
-	assert(nSize == slTuples->GetCount());
+	assert(nSize == oaTuples.GetSize());
 
 	// Mise a jour de l'effectif total
 	nTotalFrequency += inputTuple->GetFrequency();
-
-	// On remet a NULL la table de tuple a utiliser pour les fonctions de comparaison
-	SetSortTupleTable(NULL);
-
 	return updateTuple;
 }
 
@@ -479,12 +445,18 @@ void KWTupleTable::ExportObjectArray(ObjectArray* oaExportedTuples) const
 {
 	require(oaExportedTuples != NULL);
 
-	// En mode edition, on extrait les tuples de la liste triee
-	if (slTuples != NULL)
-		slTuples->ExportObjectArray(oaExportedTuples);
-	// En mode consultation, on copie le tableau de tuples
-	else
-		oaExportedTuples->CopyFrom(&oaTuples);
+	// On copie le tableau de tuples
+	oaExportedTuples->CopyFrom(&oaTuples);
+
+	// En mode edition, on trie les tuples exportes, non tries dans la table
+	if (GetUpdateMode())
+	{
+		require(GetSortTupleTable() == NULL);
+		SetSortTupleTable(this);
+		oaExportedTuples->SetCompareFunction(GetCompareFunction());
+		oaExportedTuples->Sort();
+		SetSortTupleTable(NULL);
+	}
 }
 
 void KWTupleTable::Write(ostream& ost) const
@@ -568,8 +540,7 @@ longint KWTupleTable::GetUsedMemory() const
 	lUsedMemory += ivAttributeTypes.GetUsedMemory() - sizeof(IntVector);
 	lUsedMemory += oaTuples.GetUsedMemory() - sizeof(ObjectArray);
 	lUsedMemory += oaTuples.GetSize() * (sizeof(KWTuple) + (GetAttributeNumber() - 1) * sizeof(KWValue));
-	if (slTuples != NULL)
-		lUsedMemory += slTuples->GetUsedMemory();
+	lUsedMemory += oaHashTableTuples.GetUsedMemory() - sizeof(ObjectArray);
 	return lUsedMemory;
 }
 
@@ -590,12 +561,13 @@ longint KWTupleTable::ComputeNecessaryMemory(longint lTupleNumber, int nAttribut
 longint KWTupleTable::ComputeNecessaryBuildingMemory(longint lTupleNumber)
 {
 	longint lNecessaryMemory;
-	SortedList slTmp(ObjectCompare);
 
 	require(lTupleNumber >= 0);
 
-	// Memoire necessaire pour l'alimentation de la table au moyen de la liste triee
-	lNecessaryMemory = slTmp.GetUsedMemory() + lTupleNumber * slTmp.GetUsedMemoryPerElement();
+	// Memoire necessaire pour l'alimentation de la table au moyen de la table de hachage
+	// Au pire, lors d'un retaillage, l'ancienne table a moitie pleine coexiste avec la nouvelle table
+	// de taille double, soit six cases par tuple, auxquelles on ajoute la marge de croissance du tableau des tuples
+	lNecessaryMemory = sizeof(ObjectArray) + lTupleNumber * 7 * sizeof(void*);
 	return lNecessaryMemory;
 }
 
@@ -611,10 +583,7 @@ const ALString KWTupleTable::GetObjectLabel() const
 	int nAttribute;
 
 	// Nombre de tuples, en mode update ou non
-	if (slTuples != NULL)
-		nTupleCount = slTuples->GetCount();
-	else
-		nTupleCount = oaTuples.GetSize();
+	nTupleCount = oaTuples.GetSize();
 
 	// Calcul du libelle
 	sObjectLabel = "(";
@@ -785,6 +754,118 @@ void KWTupleTable::DeleteTuple(KWTuple* tuple) const
 	DeleteMemoryBlock(tuple);
 }
 
+int KWTupleTable::ComputeHashTableSize(int nTupleNumber)
+{
+	int nHashTableSize;
+
+	require(nTupleNumber >= 0);
+
+	// Plus petite puissance de 2 permettant un remplissage au plus a moitie
+	nHashTableSize = nMinHashTableSize;
+	while (nHashTableSize < 2 * nTupleNumber)
+		nHashTableSize *= 2;
+	return nHashTableSize;
+}
+
+ulongint KWTupleTable::ComputeTupleHashValue(const KWTuple* tuple) const
+{
+	ulongint ulHashValue;
+	ulongint ulValue;
+	Continuous cValue;
+	int i;
+
+	require(tuple != NULL);
+
+	// Combinaison des valeurs de hachage de chaque valeur du tuple
+	ulHashValue = 0;
+	for (i = 0; i < GetAttributeNumber(); i++)
+	{
+		// Les Symbol sont uniques, et on peut les hacher selon leur pointeur
+		if (GetAttributeTypeAt(i) == KWType::Symbol)
+			ulValue = (ulongint)tuple->tupleValues[i].GetSymbol().GetNumericKey();
+		// Les Continuous sont haches selon leur representation binaire, en confondant 0 et -0 qui sont egaux
+		else
+		{
+			cValue = tuple->tupleValues[i].GetContinuous();
+			if (cValue == 0)
+				cValue = 0;
+			ulValue = 0;
+			memcpy(&ulValue, &cValue, sizeof(Continuous));
+		}
+		ulHashValue = IthRandomUnsignedLongint(ulHashValue ^ ulValue);
+	}
+	return ulHashValue;
+}
+
+boolean KWTupleTable::AreTupleValuesEqual(const KWTuple* tuple1, const KWTuple* tuple2) const
+{
+	int i;
+
+	require(tuple1 != NULL);
+	require(tuple2 != NULL);
+
+	for (i = 0; i < GetAttributeNumber(); i++)
+	{
+		if (GetAttributeTypeAt(i) == KWType::Symbol)
+		{
+			if (tuple1->tupleValues[i].CompareSymbol(tuple2->tupleValues[i]) != 0)
+				return false;
+		}
+		else
+		{
+			if (tuple1->tupleValues[i].CompareContinuous(tuple2->tupleValues[i]) != 0)
+				return false;
+		}
+	}
+	return true;
+}
+
+int KWTupleTable::SearchHashTableIndex(const KWTuple* tuple) const
+{
+	int nHashTableMask;
+	int nIndex;
+	KWTuple* hashTableTuple;
+
+	require(tuple != NULL);
+	require(oaHashTableTuples.GetSize() > 0);
+	require((oaHashTableTuples.GetSize() & (oaHashTableTuples.GetSize() - 1)) == 0);
+
+	// Sondage lineaire a partir de la case ideale, jusqu'a trouver le tuple ou une case vide
+	// La table etant remplie au plus a moitie, on trouve toujours une case vide
+	nHashTableMask = oaHashTableTuples.GetSize() - 1;
+	nIndex = (int)(ComputeTupleHashValue(tuple) & (ulongint)nHashTableMask);
+	hashTableTuple = cast(KWTuple*, oaHashTableTuples.GetAt(nIndex));
+	while (hashTableTuple != NULL and not AreTupleValuesEqual(hashTableTuple, tuple))
+	{
+		nIndex = (nIndex + 1) & nHashTableMask;
+		hashTableTuple = cast(KWTuple*, oaHashTableTuples.GetAt(nIndex));
+	}
+	return nIndex;
+}
+
+void KWTupleTable::ResizeHashTable(int nNewHashTableSize)
+{
+	int nTuple;
+	KWTuple* tuple;
+	int nIndex;
+
+	require(nNewHashTableSize >= 2 * oaTuples.GetSize());
+	require((nNewHashTableSize & (nNewHashTableSize - 1)) == 0);
+
+	// Reinitialisation de la table de hachage
+	oaHashTableTuples.SetSize(0);
+	oaHashTableTuples.SetSize(nNewHashTableSize);
+
+	// Insertion de tous les tuples, tous distincts
+	for (nTuple = 0; nTuple < oaTuples.GetSize(); nTuple++)
+	{
+		tuple = cast(KWTuple*, oaTuples.GetAt(nTuple));
+		nIndex = SearchHashTableIndex(tuple);
+		assert(oaHashTableTuples.GetAt(nIndex) == NULL);
+		oaHashTableTuples.SetAt(nIndex, tuple);
+	}
+}
+
 /////////////////////////////////////////////
 // Implementation de la classe PLShared_TupleTable
 
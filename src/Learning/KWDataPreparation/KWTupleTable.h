@@ -211,6 +211,9 @@ public:
 	// Mise a jour de la table avec les caracteristiques du tuple d'entree
 	// On recherche dans la table un tuple de memes valeurs que le tuple en entree
 	// (on en cree un nouveau si necessaire), et on met a jour son effectif
+	// La recherche se fait par hachage des valeurs, en temps constant, sans dependre
+	// d'aucun parametrage global: on peut alimenter plusieurs tables de tuples en parallele
+	// Les tuples ne sont tries qu'une seule fois, en fin de mode edition
 	// En sortie, on renvoie le tuple de la table correspondant au tuple en entree
 	// Memoire: le tuple en sortie appartient a la table
 	const KWTuple* UpdateWithInputTuple();
@@ -240,6 +243,7 @@ public:
 
 	// Export des tuples vers un tableau
 	// Ce service est disponible en mode consultation ou edition
+	// En mode edition, les tuples exportes sont tries selon le tri standard
 	// Memoire: les tuples appartiennent a l'appele
 	void ExportObjectArray(ObjectArray* oaExportedTuples) const;
 
@@ -282,6 +286,24 @@ protected:
 	CompareFunction GetCompareValuesFunction() const;
 	CompareFunction GetCompareDecreasingFrequenciesFunction() const;
 
+	// Gestion de la table de hachage du mode edition
+	// Calcul de la valeur de hachage d'un tuple, a partir des pointeurs de ses Symbol
+	// et de la representation binaire de ses Continuous
+	ulongint ComputeTupleHashValue(const KWTuple* tuple) const;
+
+	// Test d'egalite des valeurs de deux tuples
+	boolean AreTupleValuesEqual(const KWTuple* tuple1, const KWTuple* tuple2) const;
+
+	// Recherche de l'index de la case de la table de hachage contenant un tuple de memes valeurs,
+	// ou a defaut de la case libre ou l'inserer
+	int SearchHashTableIndex(const KWTuple* tuple) const;
+
+	// Retaillage de la table de hachage et insertion de tous les tuples du tableau
+	void ResizeHashTable(int nNewHashTableSize);
+
+	// Taille de table de hachage necessaire pour un nombre de tuples
+	static int ComputeHashTableSize(int nTupleNumber);
+
 	// Parametrage de la table de tuple courante a utiliser pour les comparaisons
 	// On a en effet besoin de connaitre la table de tuple en cours pour les fonction de comparaisons
 	void SetSortTupleTable(const KWTupleTable* tupleTable) const;
@@ -292,8 +314,8 @@ protected:
 	IntVector ivAttributeTypes;
 
 	// Tableau des tuples
-	// En mode consultation, tous les tuples sont dans ce tableau
-	// En mode edition, ce tableau contient un seul tuple: le tuple d'entree permettant les editions
+	// En mode consultation, tous les tuples sont dans ce tableau, tries
+	// En mode edition, tous les tuples sont egalement dans ce tableau, dans leur ordre d'insertion
 	ObjectArray oaTuples;
 
 	// Nombre de tuples
@@ -305,9 +327,16 @@ protected:
 	// Nombre des valeurs manquantes en mode sparse
 	int nSparseMissingValueNumber;
 
-	// Liste triee pour la gestion du mode edition
-	// En mode edition, tous les tuples sont dans cette liste, qui en assure l'unicite
-	SortedList* slTuples;
+	// Table de hachage pour la gestion du mode edition, qui assure l'unicite des tuples
+	// Table par adressage ouvert avec sondage lineaire, de taille puissance de 2 et remplie au plus a moitie,
+	// dont les cases contiennent les tuples ou NULL pour les cases libres
+	ObjectArray oaHashTableTuples;
+
+	// Taille minimale de la table de hachage
+	static const int nMinHashTableSize = 16;
+
+	// Indicateur du mode edition
+	boolean bUpdateMode;
 
 	// Tuple reserve au mode edition
 	KWTuple* inputTuple;
@@ -455,8 +484,7 @@ inline int KWTupleTable::GetAttributeTypeAt(int nAttributeIndex) const
 
 inline int KWTupleTable::GetSize() const
 {
-	require((not GetUpdateMode() and nSize == oaTuples.GetSize()) or
-		(GetUpdateMode() and nSize == slTuples->GetCount()));
+	require(nSize == oaTuples.GetSize());
 	return nSize;
 }
 
@@ -483,8 +511,8 @@ inline const KWTuple* KWTupleTable::GetAt(int nIndex) const
 
 inline boolean KWTupleTable::GetUpdateMode() const
 {
-	assert(slTuples == NULL or inputTuple != NULL);
-	return (slTuples != NULL);
+	assert(not bUpdateMode or inputTuple != NULL);
+	return bUpdateMode;
 }
 
 inline KWTuple* KWTupleTable::GetInputTuple() const
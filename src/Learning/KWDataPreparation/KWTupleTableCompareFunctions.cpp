@@ -13,8 +13,10 @@
 // ne memorisent pas leur table de tuple en mode release. Pour parametrer correctement les tris,
 // la table de tuples courante est alors utilise en variable statique, pour avoir acces a la structure
 // des tuples dans les fonctions de comparaiosn generiques qui en ont besoin.
-// Cette table de tuples courante doit etre positionnee dans les methodes de tri de tableau ou
-// avant chaque utilisation d'une SortedList, pour avoir acces a la bonne structure courante.
+// Cette table de tuples courante doit etre positionnee dans les methodes de tri de tableau,
+// pour avoir acces a la bonne structure courante.
+// L'alimentation des tables de tuples en mode edition, par hachage, n'utilise pas ces fonctions de
+// comparaison, et ne depend donc pas de cette table courante.
 
 static const KWTupleTable* KWTupleTableSortTupleTable = NULL;
 
@@ -3,6 +3,7 @@
 // at https://spdx.org/licenses/BSD-3-Clause-Clear.html or see the "LICENSE" file for more details.
 
 #include "KWTupleTableLoader.h"
+#include "KWQuantileSketch.h"
 
 KWTupleTableLoader::KWTupleTableLoader()
 {
@@ -12,6 +13,7 @@ KWTupleTableLoader::KWTupleTableLoader()
 	svInputExtraAttributeSymbolValues = NULL;
 	cvInputExtraAttributeContinuousValues = NULL;
 	inputExtraAttributeTupleTable = NULL;
+	odInputContinuousBinUpperBounds = NULL;
 	bCheckDatabaseObjectsClass = true;
 }
 
@@ -133,6 +135,16 @@ boolean KWTupleTableLoader::CheckInputs() const
 	return bOk;
 }
 
+void KWTupleTableLoader::SetInputContinuousBinUpperBounds(const ObjectDictionary* odBinUpperBounds)
+{
+	odInputContinuousBinUpperBounds = odBinUpperBounds;
+}
+
+const ObjectDictionary* KWTupleTableLoader::GetInputContinuousBinUpperBounds() const
+{
+	return odInputContinuousBinUpperBounds;
+}
+
 void KWTupleTableLoader::SetCheckDatabaseObjectClass(boolean bValue)
 {
 	bCheckDatabaseObjectsClass = bValue;
@@ -147,6 +159,7 @@ void KWTupleTableLoader::RemoveAllInputs()
 {
 	kwcInputClass = NULL;
 	oaInputDatabaseObjects = NULL;
+	odInputContinuousBinUpperBounds = NULL;
 	RemoveExtraAttributeInputs();
 }
 
@@ -383,9 +396,22 @@ void KWTupleTableLoader::LoadTupleTableFromFrequency(int nInputFrequency, KWTupl
 void KWTupleTableLoader::LoadUnivariate(const ALString& sInputAttributeName, KWTupleTable* outputTupleTable) const
 {
 	StringVector svInputAttributNames;
+	const ContinuousVector* cvBinUpperBounds;
 
-	svInputAttributNames.Add(sInputAttributeName);
-	LoadMultivariate(&svInputAttributNames, outputTupleTable);
+	// Recherche des bornes de bins eventuelles de l'attribut
+	cvBinUpperBounds = NULL;
+	if (odInputContinuousBinUpperBounds != NULL)
+		cvBinUpperBounds =
+		    cast(const ContinuousVector*, odInputContinuousBinUpperBounds->Lookup(sInputAttributeName));
+
+	// Alimentation approximative si l'attribut a des bornes de bins, standard sinon
+	if (cvBinUpperBounds != NULL)
+		LoadBinnedUnivariate(sInputAttributeName, cvBinUpperBounds, outputTupleTable);
+	else
+	{
+		svInputAttributNames.Add(sInputAttributeName);
+		LoadMultivariate(&svInputAttributNames, outputTupleTable);
+	}
 }
 
 void KWTupleTableLoader::LoadBivariate(const ALString& sInputAttributeName1, const ALString& sInputAttributeName2,
@@ -532,6 +558,66 @@ void KWTupleTableLoader::LoadMultivariate(const StringVector* svInputAttributeNa
 	outputTupleTable->SetUpdateMode(false);
 }
 
+void KWTupleTableLoader::LoadBinnedUnivariate(const ALString& sInputAttributeName,
+					      const ContinuousVector* cvBinUpperBounds,
+					      KWTupleTable* outputTupleTable) const
+{
+	KWAttribute* attribute;
+	KWLoadIndex liLoadIndex;
+	KWTuple* inputTuple;
+	int nObject;
+	KWObject* kwoObject;
+	Continuous cValue;
+	int nBin;
+
+	require(CheckInputs());
+	require(cvBinUpperBounds != NULL);
+	require(cvBinUpperBounds->GetSize() > 0);
+	require(outputTupleTable != NULL);
+
+	// Nettoyage prealable de la sortie
+	outputTupleTable->CleanAll();
+
+	// Specification de la table de tuples
+	attribute = kwcInputClass->LookupAttribute(sInputAttributeName);
+	check(attribute);
+	assert(attribute->GetType() == KWType::Continuous);
+	assert(attribute->GetLoaded());
+	outputTupleTable->AddAttribute(attribute->GetName(), attribute->GetType());
+	liLoadIndex = attribute->GetLoadIndex();
+	if (GetInputExtraAttributeType() != KWType::Unknown and GetInputExtraAttributeType() != KWType::None)
+		outputTupleTable->AddAttribute(GetInputExtraAttributeName(), GetInputExtraAttributeType());
+
+	// Alimentation de la table de tuples a partir de la base d'objets
+	outputTupleTable->SetUpdateMode(true);
+	inputTuple = outputTupleTable->GetInputTuple();
+	for (nObject = 0; nObject < oaInputDatabaseObjects->GetSize(); nObject++)
+	{
+		kwoObject = cast(KWObject*, oaInputDatabaseObjects->GetAt(nObject));
+
+		// Remplacement de la valeur par sa borne de bin, la valeur manquante etant conservee, de meme que les
+		// valeurs au dela de la derniere borne
+		cValue = kwoObject->GetContinuousValueAt(liLoadIndex);
+		if (cValue != KWContinuous::GetMissingValue())
+		{
+			nBin = KWQuantileSketch::SearchBinIndex(cvBinUpperBounds, cValue);
+			if (nBin < cvBinUpperBounds->GetSize())
+				cValue = cvBinUpperBounds->GetAt(nBin);
+		}
+		inputTuple->SetContinuousAt(0, cValue);
+
+		// Prise en compte de l'attribut supplementaire
+		if (GetInputExtraAttributeType() == KWType::Symbol)
+			inputTuple->SetSymbolAt(1, svInputExtraAttributeSymbolValues->GetAt(nObject));
+		else if (GetInputExtraAttributeType() == KWType::Continuous)
+			inputTuple->SetContinuousAt(1, cvInputExtraAttributeContinuousValues->GetAt(nObject));
+
+		// Ajout du tuple d'entree
+		outputTupleTable->UpdateWithInputTuple();
+	}
+	outputTupleTable->SetUpdateMode(false);
+}
+
 void KWTupleTableLoader::BlockLoadUnivariateInitialize(const ALString& sInputAttributeBlockName,
 						       ObjectDictionary* odInputAttributes,
 						       ObjectDictionary* odOutputTupleTables) const
@@ -60,6 +60,14 @@ public:
 	void SetInputExtraAttributeTupleTable(const KWTupleTable* tupleTable);
 	const KWTupleTable* GetInputExtraAttributeTupleTable() const;
 
+	// Bornes superieures de bins par attribut numerique (ContinuousVector par nom d'attribut), optionnelles
+	// Pour un attribut ayant des bornes, l'alimentation univariee est approximative: chaque valeur non manquante
+	// est remplacee par la plus petite borne superieure ou egale, ce qui borne la taille de la table de tuples
+	// par le nombre de bins (cf. KWQuantileSketch::ExportBinUpperBounds)
+	// Memoire: le dictionnaire et son contenu appartiennent a l'appelant
+	void SetInputContinuousBinUpperBounds(const ObjectDictionary* odBinUpperBounds);
+	const ObjectDictionary* GetInputContinuousBinUpperBounds() const;
+
 	// Verification de la specification des parametres en entree
 	// Il doit y avoir la base d'objet en entree et/ou l'attribut supplementaire
 	// et ses valeurs, specifies de facon coherente
@@ -170,6 +178,10 @@ public:
 	///////////////////////////////
 	///// Implementation
 protected:
+	// Alimentation univariee approximative d'un attribut numerique, en remplacant chaque valeur par sa borne de bin
+	void LoadBinnedUnivariate(const ALString& sInputAttributeName, const ContinuousVector* cvBinUpperBounds,
+				  KWTupleTable* outputTupleTable) const;
+
 	// Parametre en entree du service
 	const KWClass* kwcInputClass;
 	const ObjectArray* oaInputDatabaseObjects;
@@ -178,6 +190,7 @@ protected:
 	const SymbolVector* svInputExtraAttributeSymbolValues;
 	const ContinuousVector* cvInputExtraAttributeContinuousValues;
 	const KWTupleTable* inputExtraAttributeTupleTable;
+	const ObjectDictionary* odInputContinuousBinUpperBounds;
 	boolean bCheckDatabaseObjectsClass;
 };
 
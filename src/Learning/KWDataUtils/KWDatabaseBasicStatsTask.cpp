@@ -12,20 +12,27 @@ KWDatabaseBasicStatsTask::KWDatabaseBasicStatsTask()
 	lMasterAllValuesGrantedMemory = 0;
 	lMasterAllValuesUsedMemory = 0;
 	lSlaveValuesUsedMemory = 0;
+	nNextMergedQuantileSketchTaskIndex = 0;
 
 	// Declaration des variables partagees
 	DeclareSharedParameter(&shared_sTargetAttributeName);
 	DeclareSharedParameter(&shared_bCollectValues);
 	DeclareSharedParameter(&shared_lSlaveValuesMaxMemory);
+	DeclareSharedParameter(&shared_svQuantileSketchAttributeNames);
 
 	// Variables en entree et sortie des esclaves
 	DeclareTaskOutput(&output_svReadValues);
 	DeclareTaskOutput(&output_cvReadValues);
+	output_oaQuantileSketches = new PLShared_ObjectArray(new PLShared_QuantileSketch);
+	DeclareTaskOutput(output_oaQuantileSketches);
 }
 
 KWDatabaseBasicStatsTask::~KWDatabaseBasicStatsTask()
 {
 	assert(oaAllSlaveResults.GetSize() == 0);
+	assert(oaPendingSlaveQuantileSketches.GetSize() == 0);
+	oaQuantileSketches.DeleteAll();
+	delete output_oaQuantileSketches;
 }
 
 boolean KWDatabaseBasicStatsTask::CollectBasicStats(const KWDatabase* sourceDatabase,
@@ -36,6 +43,8 @@ boolean KWDatabaseBasicStatsTask::CollectBasicStats(const KWDatabase* sourceData
 	boolean bOk = true;
 	KWClass* kwcClass;
 	KWAttribute* targetAttribute;
+	KWAttribute* attribute;
+	int i;
 
 	require(sourceDatabase != NULL);
 	require(svCollectedValues != NULL);
@@ -55,14 +64,24 @@ boolean KWDatabaseBasicStatsTask::CollectBasicStats(const KWDatabase* sourceData
 		assert(KWType::IsSimple(targetAttribute->GetType()));
 	}
 
-	// On passe tous les attributs en Unload, sauf l'attribut cible
+	// On passe tous les attributs en Unload, sauf l'attribut cible et les attributs dont on calcule les sketchs
 	kwcClass->SetAllAttributesLoaded(false);
 	if (targetAttribute != NULL)
 		targetAttribute->SetLoaded(true);
+	for (i = 0; i < svQuantileSketchAttributeNames.GetSize(); i++)
+	{
+		attribute = kwcClass->LookupAttribute(svQuantileSketchAttributeNames.GetAt(i));
+		check(attribute);
+		assert(attribute != targetAttribute);
+		assert(attribute->GetType() == KWType::Continuous);
+		assert(attribute->GetAttributeBlock() == NULL);
+		attribute->SetLoaded(true);
+	}
 	kwcClass->Compile();
 
 	// Lancement de la tache
 	shared_sTargetAttributeName.SetValue(sTargetAttributeName);
+	shared_svQuantileSketchAttributeNames.GetStringVector()->CopyFrom(&svQuantileSketchAttributeNames);
 	bOk = RunDatabaseTask(sourceDatabase);
 
 	// Collecte des resultats
@@ -87,7 +106,10 @@ boolean KWDatabaseBasicStatsTask::CollectBasicStats(const KWDatabase* sourceData
 	kwcClass->Compile();
 
 	// Nettoyage
+	if (not bOk)
+		oaQuantileSketches.DeleteAll();
 	shared_sTargetAttributeName.SetValue("");
+	shared_svQuantileSketchAttributeNames.GetStringVector()->SetSize(0);
 	svReadValues.SetSize(0);
 	cvReadValues.SetSize(0);
 	return bOk;
@@ -109,10 +131,22 @@ boolean KWDatabaseBasicStatsTask::ComputeResourceRequirements()
 	PLDatabaseTextFile* sourceDatabase;
 	longint lSlaveValuesMinRequiredMemory;
 	longint lSlaveValuesMaxRequiredMemory;
+	longint lQuantileSketchesMemory;
 
 	// Appel de la methode ancetre
 	bOk = KWDatabaseTask::ComputeResourceRequirements();
 
+	// Prise en compte des sketchs de quantiles, deux fois pour l'esclave (calcul et serialisation) et pour le
+	// maitre (fusion et sketchs en attente de fusion)
+	// On les rajoute aux exigences de la classe ancetre, pour ne pas les compter dans la memoire de stockage des
+	// valeurs cibles
+	lQuantileSketchesMemory = 2 * shared_svQuantileSketchAttributeNames.GetSize() *
+				  KWQuantileSketch::ComputeMaxUsedMemory(KWQuantileSketch::GetDefaultSketchSize());
+	GetResourceRequirements()->GetMasterRequirement()->GetMemory()->UpgradeMin(lQuantileSketchesMemory);
+	GetResourceRequirements()->GetMasterRequirement()->GetMemory()->UpgradeMax(lQuantileSketchesMemory);
+	GetResourceRequirements()->GetSlaveRequirement()->GetMemory()->UpgradeMin(lQuantileSketchesMemory);
+	GetResourceRequirements()->GetSlaveRequirement()->GetMemory()->UpgradeMax(lQuantileSketchesMemory);
+
 	// Memorisation des ressources initiales demandee pour le maitre et l'esclave
 	databaseTaskMasterMemoryRequirement.CopyFrom(GetResourceRequirements()->GetMasterRequirement()->GetMemory());
 	databaseTaskSlaveMemoryRequirement.CopyFrom(GetResourceRequirements()->GetSlaveRequirement()->GetMemory());
@@ -167,10 +201,12 @@ boolean KWDatabaseBasicStatsTask::MasterInitialize()
 	KWClass* kwcClass;
 	longint lMasterGrantedMemory;
 	longint lSlaveGrantedMemory;
+	int i;
 	ALString sTmp;
 
 	require(masterTargetAttribute == NULL);
 	require(oaAllSlaveResults.GetSize() == 0);
+	require(oaPendingSlaveQuantileSketches.GetSize() == 0);
 
 	// Appel de la methode ancetre
 	if (bOk)
@@ -198,6 +234,12 @@ boolean KWDatabaseBasicStatsTask::MasterInitialize()
 	lMasterAllValuesGrantedMemory = 0;
 	lMasterAllValuesUsedMemory = 0;
 
+	// Initialisation des sketchs de quantiles fusionnes
+	oaQuantileSketches.DeleteAll();
+	for (i = 0; i < shared_svQuantileSketchAttributeNames.GetSize(); i++)
+		oaQuantileSketches.Add(new KWQuantileSketch);
+	nNextMergedQuantileSketchTaskIndex = 0;
+
 	// Initialisation des variables partagee
 	shared_bCollectValues = false;
 	shared_lSlaveValuesMaxMemory = 0;
@@ -262,6 +304,8 @@ boolean KWDatabaseBasicStatsTask::MasterAggregateResults()
 	longint lInputFileSize;
 	LongintVector lvChunkEndPos;
 	double dOveralTaskPercent;
+	ObjectArray* oaSlaveQuantileSketches;
+	int nAttribute;
 	ALString sTmp;
 
 	require(shared_sTargetAttributeName.GetValue() == "" or masterTargetAttribute != NULL);
@@ -269,6 +313,36 @@ boolean KWDatabaseBasicStatsTask::MasterAggregateResults()
 	// Appel de la methode ancetre
 	bOk = KWDatabaseTask::MasterAggregateResults();
 
+	// Collecte des sketchs de quantiles
+	if (bOk and oaQuantileSketches.GetSize() > 0)
+	{
+		assert(output_oaQuantileSketches->GetObjectArray()->GetSize() == oaQuantileSketches.GetSize());
+
+		// Memorisation des sketchs de l'esclave selon le rang de sa tache, en les retirant de la sortie
+		oaSlaveQuantileSketches = new ObjectArray;
+		oaSlaveQuantileSketches->CopyFrom(output_oaQuantileSketches->GetObjectArray());
+		output_oaQuantileSketches->GetObjectArray()->RemoveAll();
+		if (oaPendingSlaveQuantileSketches.GetSize() <= GetTaskIndex())
+			oaPendingSlaveQuantileSketches.SetSize(GetTaskIndex() + 1);
+		assert(oaPendingSlaveQuantileSketches.GetAt(GetTaskIndex()) == NULL);
+		oaPendingSlaveQuantileSketches.SetAt(GetTaskIndex(), oaSlaveQuantileSketches);
+
+		// Fusion des sketchs des taches disponibles, dans l'ordre des taches
+		while (nNextMergedQuantileSketchTaskIndex < oaPendingSlaveQuantileSketches.GetSize() and
+		       oaPendingSlaveQuantileSketches.GetAt(nNextMergedQuantileSketchTaskIndex) != NULL)
+		{
+			oaSlaveQuantileSketches = cast(
+			    ObjectArray*, oaPendingSlaveQuantileSketches.GetAt(nNextMergedQuantileSketchTaskIndex));
+			for (nAttribute = 0; nAttribute < oaQuantileSketches.GetSize(); nAttribute++)
+				cast(KWQuantileSketch*, oaQuantileSketches.GetAt(nAttribute))
+				    ->Merge(cast(KWQuantileSketch*, oaSlaveQuantileSketches->GetAt(nAttribute)));
+			oaSlaveQuantileSketches->DeleteAll();
+			delete oaSlaveQuantileSketches;
+			oaPendingSlaveQuantileSketches.SetAt(nNextMergedQuantileSketchTaskIndex, NULL);
+			nNextMergedQuantileSketchTaskIndex++;
+		}
+	}
+
 	// Erreur si trop d'enregistrements
 	if (bOk and lReadObjects > INT_MAX)
 	{
@@ -428,6 +502,8 @@ boolean KWDatabaseBasicStatsTask::MasterFinalize(boolean bProcessEndedCorrectly)
 	ContinuousVector* cvSlaveValues;
 	int nObject;
 	int nValue;
+	int nTask;
+	ObjectArray* oaSlaveQuantileSketches;
 
 	require(svReadValues.GetSize() == 0);
 	require(cvReadValues.GetSize() == 0);
@@ -435,6 +511,21 @@ boolean KWDatabaseBasicStatsTask::MasterFinalize(boolean bProcessEndedCorrectly)
 	// Appel de la methode ancetre
 	bOk = KWDatabaseTask::MasterFinalize(bProcessEndedCorrectly);
 
+	// Les sketchs de quantiles de toutes les taches doivent avoir ete fusionnes en cas de succes
+	assert(not bOk or nNextMergedQuantileSketchTaskIndex == oaPendingSlaveQuantileSketches.GetSize());
+	for (nTask = 0; nTask < oaPendingSlaveQuantileSketches.GetSize(); nTask++)
+	{
+		oaSlaveQuantileSketches = cast(ObjectArray*, oaPendingSlaveQuantileSketches.GetAt(nTask));
+		if (oaSlaveQuantileSketches != NULL)
+		{
+			oaSlaveQuantileSketches->DeleteAll();
+			delete oaSlaveQuantileSketches;
+		}
+	}
+	oaPendingSlaveQuantileSketches.SetSize(0);
+	if (not bOk)
+		oaQuantileSketches.DeleteAll();
+
 	// Collecte des valeurs de l'ensemble de tous les esclaves
 	if (bOk and masterTargetAttribute != NULL)
 	{
@@ -493,6 +584,8 @@ boolean KWDatabaseBasicStatsTask::SlaveInitialize()
 {
 	boolean bOk;
 	KWClass* kwcClass;
+	KWAttribute* attribute;
+	int i;
 
 	require(slaveTargetAttribute == NULL);
 
@@ -512,16 +605,32 @@ boolean KWDatabaseBasicStatsTask::SlaveInitialize()
 		check(slaveTargetAttribute);
 		assert(KWType::IsSimple(slaveTargetAttribute->GetType()));
 	}
+
+	// Recherche des index de chargement des attributs dont on calcule les sketchs de quantiles
+	livSlaveQuantileSketchLoadIndexes.SetSize(shared_svQuantileSketchAttributeNames.GetSize());
+	for (i = 0; i < shared_svQuantileSketchAttributeNames.GetSize(); i++)
+	{
+		attribute = kwcClass->LookupAttribute(shared_svQuantileSketchAttributeNames.GetAt(i));
+		check(attribute);
+		assert(attribute->GetType() == KWType::Continuous);
+		livSlaveQuantileSketchLoadIndexes.SetAt(i, attribute->GetLoadIndex());
+	}
 	return bOk;
 }
 
 boolean KWDatabaseBasicStatsTask::SlaveProcess()
 {
 	boolean bOk;
+	int i;
 
 	// Initialisation de la memoire dediee a la collecte des valeurs
 	lSlaveValuesUsedMemory = 0;
 
+	// Initialisation des sketchs de quantiles de la tache
+	assert(output_oaQuantileSketches->GetObjectArray()->GetSize() == 0);
+	for (i = 0; i < livSlaveQuantileSketchLoadIndexes.GetSize(); i++)
+		output_oaQuantileSketches->GetObjectArray()->Add(new KWQuantileSketch);
+
 	// Appel de la methode ancetre
 	bOk = KWDatabaseTask::SlaveProcess();
 	return bOk;
@@ -533,6 +642,17 @@ boolean KWDatabaseBasicStatsTask::SlaveProcessExploitDatabaseObject(const KWObje
 	Symbol sValue;
 	longint lValueMemory;
 	longint lValueNumber;
+	ObjectArray* oaSlaveQuantileSketches;
+	int i;
+
+	// Alimentation des sketchs de quantiles
+	if (livSlaveQuantileSketchLoadIndexes.GetSize() > 0)
+	{
+		oaSlaveQuantileSketches = output_oaQuantileSketches->GetObjectArray();
+		for (i = 0; i < livSlaveQuantileSketchLoadIndexes.GetSize(); i++)
+			cast(KWQuantileSketch*, oaSlaveQuantileSketches->GetAt(i))
+			    ->AddValue(kwoObject->GetContinuousValueAt(livSlaveQuantileSketchLoadIndexes.GetAt(i)));
+	}
 
 	// Appel de la methode ancetre
 	if (slaveTargetAttribute != NULL and shared_bCollectValues == true)
@@ -587,6 +707,7 @@ boolean KWDatabaseBasicStatsTask::SlaveFinalize(boolean bProcessEndedCorrectly)
 
 	// Nettoyage
 	slaveTargetAttribute = NULL;
+	livSlaveQuantileSketchLoadIndexes.SetSize(0);
 	return bOk;
 }
 
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "KWDatabaseTask.h"
+#include "KWQuantileSketch.h"
 
 /////////////////////////////////////////////////////////////////////////////////
 // Classe KWDatabaseBasicStatsTask
@@ -29,6 +30,17 @@ public:
 				  longint& lRecordNumber, longint& lCollectedObjectNumber,
 				  SymbolVector* svCollectedValues, ContinuousVector* cvCollectedValues);
 
+	// Parametrage optionnel des attributs numeriques pour lesquels on calcule un sketch de quantiles lors de la
+	// collecte des statistiques de base (defaut: aucun)
+	// Ces attributs, distincts de l'attribut cible et hors blocs, sont charges en plus de l'attribut cible
+	StringVector* GetQuantileSketchAttributeNames();
+
+	// Sketchs de quantiles calcules lors du dernier appel a CollectBasicStats, dans l'ordre des attributs
+	// specifies (vide si erreur)
+	// Les sketchs des esclaves sont fusionnes dans l'ordre des taches, ce qui rend le resultat reproductible
+	// Memoire: le tableau et son contenu appartiennent a l'appele
+	ObjectArray* GetQuantileSketches();
+
 	///////////////////////////////////////////////////////////////////////////////
 	///// Implementation
 protected:
@@ -64,6 +76,9 @@ protected:
 	// Memoire disponible dans l'esclave pour collecter les valeurs
 	PLShared_Longint shared_lSlaveValuesMaxMemory;
 
+	// Noms des attributs pour lesquels on calcule un sketch de quantiles
+	PLShared_StringVector shared_svQuantileSketchAttributeNames;
+
 	//////////////////////////////////////////////////////
 	// Parametre en entree et sortie des esclaves
 
@@ -73,6 +88,9 @@ protected:
 	PLShared_StringVector output_svReadValues;
 	PLShared_ContinuousVector output_cvReadValues;
 
+	// Sketchs de quantiles par attribut, calcules sur la partie de la base traitee par l'esclave
+	PLShared_ObjectArray* output_oaQuantileSketches;
+
 	//////////////////////////////////////////////////////
 	// Variables de l'esclave
 
@@ -82,6 +100,9 @@ protected:
 	// Memoire utilisee dans l'esclave pour collecter les valeurs
 	longint lSlaveValuesUsedMemory;
 
+	// Index de chargement des attributs pour lesquels on calcule un sketch de quantiles
+	KWLoadIndexVector livSlaveQuantileSketchLoadIndexes;
+
 	//////////////////////////////////////////////////////
 	// Variables du Master
 
@@ -108,6 +129,19 @@ protected:
 	// Memoire allouee au stockage des valeurs par le maitre
 	longint lMasterAllValuesGrantedMemory;
 
+	// Specification des attributs pour lesquels on calcule un sketch de quantiles
+	StringVector svQuantileSketchAttributeNames;
+
+	// Sketchs de quantiles fusionnes
+	ObjectArray oaQuantileSketches;
+
+	// Sketchs des esclaves en attente de fusion, indexes par rang de tache (tableau de sketchs par tache)
+	// Ils sont fusionnes dans l'ordre des taches des que possible, pour garantir la reproductibilite
+	ObjectArray oaPendingSlaveQuantileSketches;
+
+	// Index de la prochaine tache dont les sketchs sont a fusionner
+	int nNextMergedQuantileSketchTaskIndex;
+
 	// Exigences de memoire de classe ancetre (PLDatabaseTask)
 	RMPhysicalResource databaseTaskMasterMemoryRequirement;
 	RMPhysicalResource databaseTaskSlaveMemoryRequirement;
@@ -115,3 +149,16 @@ protected:
 	// Nombre max de valeurs distinctes dans le cas categoriel
 	static const int nMaxSymbolValueNumber = 1000000;
 };
+
+////////////////////////////////////////////////////////////////////
+// Methodes en inline
+
+inline StringVector* KWDatabaseBasicStatsTask::GetQuantileSketchAttributeNames()
+{
+	return &svQuantileSketchAttributeNames;
+}
+
+inline ObjectArray* KWDatabaseBasicStatsTask::GetQuantileSketches()
+{
+	return &oaQuantileSketches;
+}
@@ -339,8 +339,9 @@ void KWDatabaseChunkBuilder::ComputeAllChunksInformations(int nSlaveNumber, long
 		// Taille totale des fichiers a traiter
 		lTotalUsedFileSize = databaseIndexer->GetPLDatabase()->GetTotalUsedFileSize();
 
-		// Taille minimum a traiter par process
-		lMinFileSizePerProcess = max(lMaxFileSizePerProcess / 8, (longint)SystemFile::nMinPreferredBufferSize);
+		// Taille minimum a traiter par process, pour les derniers chunks
+		lMinFileSizePerProcess = max(lMaxFileSizePerProcess / KWDatabaseIndexer::GetMinChunkSizeRatio(),
+					     (longint)SystemFile::nMinPreferredBufferSize);
 		lMinFileSizePerProcess = min(lMinFileSizePerProcess, lMaxFileSizePerProcess);
 
 		// Taille de fin de fichier a partir de laquelle on diminue la taille des chunks
@@ -366,12 +367,15 @@ void KWDatabaseChunkBuilder::ComputeAllChunksInformations(int nSlaveNumber, long
 					dRemainingEndFilePercentage =
 					    (lTotalUsedFileSize - lCurrentTotalFileSize) * 1.0 / lEndFileSize;
 
-					// On diminue la portion du fichier a traiter a mesure que l'on s'approche de la
-					// fin
+					// Chaque chunk prend une part fixe de ce qui reste a traiter (guided scheduling):
+					// la taille des chunks, egale a la taille max au debut de la fin du fichier,
+					// decroit geometriquement jusqu'a la taille min. Les derniers chunks, tres
+					// petits, sont pris par les esclaves qui se liberent, ce qui limite l'attente
+					// des esclaves ayant fini sur ceux qui traitent les derniers gros chunks
 					lCurrentMaxFileSizePerProcess =
-					    lMinFileSizePerProcess +
-					    longint(dRemainingEndFilePercentage *
-						    (lMaxFileSizePerProcess - lMinFileSizePerProcess));
+					    longint(dRemainingEndFilePercentage * lMaxFileSizePerProcess);
+					lCurrentMaxFileSizePerProcess =
+					    max(lCurrentMaxFileSizePerProcess, lMinFileSizePerProcess);
 				}
 				// On echelonne la taille des chunks au debut, pour eviter les acces disques simultanens
 				else if (GetChunkNumber() < nSlaveNumber)
@@ -166,6 +166,11 @@ longint KWDatabaseIndexer::GetMaxTotalFileSizePerProcess() const
 	return lMaxTotalFileSizePerProcess;
 }
 
+int KWDatabaseIndexer::GetMinChunkSizeRatio()
+{
+	return 32;
+}
+
 boolean KWDatabaseIndexer::ComputeIndexation()
 {
 	boolean bOk = true;
@@ -728,8 +733,10 @@ boolean KWDatabaseIndexer::ComputeSingleTableIndexation()
 			nFileIndexerBufferSize = SystemFile::nMaxPreferredBufferSize;
 
 		// Calcul du nombre moyen de positions d'indexation par buffer: chaque buffer indexe doit produit
-		// assez de points de coupure pour copier le fichier en morceaux de taille lTotalFileSizePerProcess
-		nPositionNumberPerBuffer = (int)ceil(nFileIndexerBufferSize * 1.0 / lTotalFileSizePerProcess);
+		// assez de points de coupure pour copier le fichier en morceaux de taille lTotalFileSizePerProcess,
+		// et jusqu'a GetMinChunkSizeRatio() fois plus petits pour les chunks de fin de tache
+		nPositionNumberPerBuffer = (int)ceil(nFileIndexerBufferSize * 1.0 * GetMinChunkSizeRatio() /
+						     lTotalFileSizePerProcess);
 		assert(nPositionNumberPerBuffer >= 1);
 
 		// Limitation du nombre de positions en cas de depassement memoire
@@ -862,9 +869,11 @@ boolean KWDatabaseIndexer::ComputeMainTableIndexation()
 				lMaxKeyNumber = 0;
 
 			// On limite ce nombre de cle en fonction de la taille des fichiers a analyser
-			// On utilise (lMaxFileSizePerProcess/8) pour la gestion de la fin des taches
+			// On utilise (lMaxFileSizePerProcess/GetMinChunkSizeRatio()) pour la gestion de la fin des
+			// taches, avec des chunks de plus en plus petits
 			lMaxSlaveProcessNumber =
-			    1 + GetMTDatabase()->GetTotalFileSize() / (lTotalFileSizePerProcess / 8);
+			    1 + GetMTDatabase()->GetTotalFileSize() /
+				    max((longint)1, lTotalFileSizePerProcess / GetMinChunkSizeRatio());
 			if (lMaxKeyNumber > lMaxSlaveProcessNumber)
 				lMaxKeyNumber = lMaxSlaveProcessNumber;
 
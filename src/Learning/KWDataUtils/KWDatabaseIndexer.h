@@ -77,6 +77,12 @@ public:
 	void SetMaxTotalFileSizePerProcess(longint lValue);
 	longint GetMaxTotalFileSizePerProcess() const;
 
+	// Ratio entre la taille cumulee des fichiers a traiter par process et la taille des plus petits chunks
+	// (defaut: 32)
+	// L'indexation est suffisamment fine pour que les chunks de fin de tache puissent descendre jusqu'a
+	// cette taille, ce qui permet aux esclaves de terminer presque simultanement
+	static int GetMinChunkSizeRatio();
+
 	///////////////////////////////////////////////////////////////////////////////////////////////
 	// Indexation de la base de donnes multi-tables selon les parametres specifies
 
@@ -23,6 +23,9 @@ KWDatabaseSlicerTask::KWDatabaseSlicerTask()
 	DeclareTaskOutput(&output_lvSliceFileSizes);
 	DeclareTaskOutput(&output_lvAllAttributeBlockValueNumbers);
 	DeclareTaskOutput(&output_lvAllDenseSymbolAttributeDiskSizes);
+
+	// Taches a grain fin, independantes les unes des autres : on pre-envoie une tache aux esclaves occupes
+	SetPipelineDepth(2);
 }
 
 KWDatabaseSlicerTask::~KWDatabaseSlicerTask()
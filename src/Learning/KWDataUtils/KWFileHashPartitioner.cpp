@@ -0,0 +1,228 @@
+// Copyright (c) 2023-2026 Orange. All rights reserved.
+// This software is distributed under the BSD 3-Clause-clear License, the text of which is available
+// at https://spdx.org/licenses/BSD-3-Clause-Clear.html or see the "LICENSE" file for more details.
+
+#include "KWFileHashPartitioner.h"
+
+#include "KWSortedChunkBuilderTask.h"
+
+KWFileHashPartitioner::KWFileHashPartitioner()
+{
+	bInputHeaderLineUsed = true;
+	cInputFieldSeparator = '\t';
+	bOutputHeaderLineUsed = true;
+}
+
+KWFileHashPartitioner::~KWFileHashPartitioner() {}
+
+StringVector* KWFileHashPartitioner::GetKeyAttributeNames()
+{
+	return keyFieldsIndexer.GetKeyAttributeNames();
+}
+
+StringVector* KWFileHashPartitioner::GetNativeFieldNames()
+{
+	return keyFieldsIndexer.GetNativeFieldNames();
+}
+
+void KWFileHashPartitioner::SetInputFileName(const ALString& sValue)
+{
+	sInputFileName = sValue;
+}
+
+const ALString& KWFileHashPartitioner::GetInputFileName() const
+{
+	return sInputFileName;
+}
+
+void KWFileHashPartitioner::SetInputHeaderLineUsed(boolean bValue)
+{
+	bInputHeaderLineUsed = bValue;
+}
+
+boolean KWFileHashPartitioner::GetInputHeaderLineUsed() const
+{
+	return bInputHeaderLineUsed;
+}
+
+void KWFileHashPartitioner::SetInputFieldSeparator(char cValue)
+{
+	cInputFieldSeparator = cValue;
+}
+
+char KWFileHashPartitioner::GetInputFieldSeparator() const
+{
+	return cInputFieldSeparator;
+}
+
+StringVector* KWFileHashPartitioner::GetOutputFileNames()
+{
+	return &svOutputFileNames;
+}
+
+void KWFileHashPartitioner::SetOutputHeaderLineUsed(boolean bValue)
+{
+	bOutputHeaderLineUsed = bValue;
+}
+
+boolean KWFileHashPartitioner::GetOutputHeaderLineUsed() const
+{
+	return bOutputHeaderLineUsed;
+}
+
+boolean KWFileHashPartitioner::Partition()
+{
+	boolean bOk = true;
+	KWSortBuckets partitionBuckets;
+	KWSortBucket* bucket;
+	KWSortedChunkBuilderTask chunkBuilder;
+	PLFileConcatenater concatenater;
+	StringVector svFirstLine;
+	ALString sInputFileURI;
+	int i;
+
+	require(sInputFileName != "");
+	require(svOutputFileNames.GetSize() > 0);
+
+	// Initialisation des resultats
+	lvPartitionLineNumbers.SetSize(0);
+
+	// Test d'existence du fichier d'entree
+	if (not PLRemoteFileService::FileExists(sInputFileName))
+	{
+		AddError("Input file is missing");
+		return false;
+	}
+
+	// Cas d'un fichier vide
+	if (PLRemoteFileService::GetFileSize(sInputFileName) == 0)
+	{
+		AddWarning("Empty input file");
+		return false;
+	}
+
+	// Calcul des index des champs de la cle a partir de la premiere ligne du fichier d'entree
+	bOk = InputBufferedFile::GetFirstLineFields(sInputFileName, cInputFieldSeparator, false, false, &svFirstLine);
+	if (bOk)
+		bOk = keyFieldsIndexer.ComputeKeyFieldIndexes(bInputHeaderLineUsed, &svFirstLine);
+
+	// Si il n'y a pas de header dans le fichier d'entree, on le construit a partir des champs natifs
+	if (not bInputHeaderLineUsed)
+		svFirstLine.CopyFrom(GetNativeFieldNames());
+
+	// Repartition des lignes dans les chunks des partitions, en une seule passe parallele
+	if (bOk)
+	{
+		partitionBuckets.BuildHashPartitions(svOutputFileNames.GetSize());
+
+		// Le chunk builder prend en entree une URI
+		if (FileService::GetURIScheme(sInputFileName) == "")
+			sInputFileURI = FileService::BuildLocalURI(sInputFileName);
+		else
+			sInputFileURI = sInputFileName;
+		chunkBuilder.SetTaskUserLabel("Hash partitioning");
+		chunkBuilder.SetFileURI(sInputFileURI);
+		chunkBuilder.SetHeaderLineUsed(bInputHeaderLineUsed);
+		chunkBuilder.SetInputFieldSeparator(cInputFieldSeparator);
+		chunkBuilder.GetKeyFieldIndexes()->CopyFrom(keyFieldsIndexer.GetConstKeyFieldIndexes());
+		bOk = chunkBuilder.BuildSortedChunks(&partitionBuckets);
+	}
+
+	// Concatenation des chunks de chaque partition dans son fichier de sortie
+	// En cas d'echec, les chunks restants sont supprimes
+	if (partitionBuckets.GetBucketNumber() > 0)
+	{
+		concatenater.SetFieldSeparator(cInputFieldSeparator);
+		concatenater.SetHeaderLineUsed(bOutputHeaderLineUsed);
+		if (bOutputHeaderLineUsed)
+			concatenater.GetHeaderLine()->CopyFrom(&svFirstLine);
+		for (i = 0; i < partitionBuckets.GetBucketNumber(); i++)
+		{
+			bucket = partitionBuckets.GetBucketAt(i);
+			if (bOk)
+			{
+				concatenater.SetFileName(svOutputFileNames.GetAt(i));
+				bOk = concatenater.Concatenate(bucket->GetChunkFileNames(), this);
+				lvPartitionLineNumbers.Add(bucket->GetLineNumber());
+			}
+			else
+				concatenater.RemoveChunks(bucket->GetChunkFileNames());
+		}
+	}
+
+	// Nettoyage des fichiers de sortie en cas d'echec
+	if (not bOk)
+	{
+		for (i = 0; i < svOutputFileNames.GetSize(); i++)
+		{
+			if (PLRemoteFileService::FileExists(svOutputFileNames.GetAt(i)))
+				PLRemoteFileService::RemoveFile(svOutputFileNames.GetAt(i));
+		}
+		lvPartitionLineNumbers.SetSize(0);
+	}
+	return bOk;
+}
+
+const LongintVector* KWFileHashPartitioner::GetPartitionLineNumbers() const
+{
+	return &lvPartitionLineNumbers;
+}
+
+const ALString KWFileHashPartitioner::GetClassLabel() const
+{
+	return "Hash partitioner";
+}
+
+const ALString KWFileHashPartitioner::GetObjectLabel() const
+{
+	return sInputFileName;
+}
+
+void KWFileHashPartitioner::Test()
+{
+	const int nPartitionNumber = 4;
+	KWArtificialDataset artificialDataset;
+	KWFileHashPartitioner filePartitioner;
+	longint lTotalLineNumber;
+	int i;
+
+	// Gestion des taches
+	TaskProgression::SetTitle("Test " + filePartitioner.GetClassLabel());
+	TaskProgression::SetDisplayedLevelNumber(2);
+	TaskProgression::Start();
+
+	// Creation d'un fichier avec des champs cle
+	artificialDataset.SpecifySortDataset();
+	artificialDataset.CreateDataset();
+	artificialDataset.DisplayFirstLines(15);
+
+	// Parametrage du partitionnement
+	filePartitioner.SetInputFileName(artificialDataset.GetFileName());
+	filePartitioner.SetInputHeaderLineUsed(artificialDataset.GetHeaderLineUsed());
+	filePartitioner.SetInputFieldSeparator(artificialDataset.GetFieldSeparator());
+	artificialDataset.ExportKeyAttributeNames(filePartitioner.GetKeyAttributeNames());
+	artificialDataset.ExportNativeFieldNames(filePartitioner.GetNativeFieldNames());
+	for (i = 0; i < nPartitionNumber; i++)
+		filePartitioner.GetOutputFileNames()->Add(artificialDataset.GetFileName() + ".part" + IntToString(i));
+
+	// Partitionnement et affichage des partitions
+	if (filePartitioner.Partition())
+	{
+		lTotalLineNumber = 0;
+		for (i = 0; i < nPartitionNumber; i++)
+		{
+			cout << "Partition " << i << ": " << filePartitioner.GetPartitionLineNumbers()->GetAt(i)
+			     << " lines" << endl;
+			KWArtificialDataset::DisplayFileFirstLines(filePartitioner.GetOutputFileNames()->GetAt(i), 5);
+			lTotalLineNumber += filePartitioner.GetPartitionLineNumbers()->GetAt(i);
+			FileService::RemoveFile(filePartitioner.GetOutputFileNames()->GetAt(i));
+		}
+		cout << "Total: " << lTotalLineNumber << " lines" << endl;
+	}
+
+	// Destruction du fichier
+	artificialDataset.DeleteDataset();
+
+	// Gestion des taches
+	TaskProgression::Stop();
+}
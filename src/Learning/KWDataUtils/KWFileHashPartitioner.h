@@ -0,0 +1,100 @@
+// Copyright (c) 2023-2026 Orange. All rights reserved.
+// This software is distributed under the BSD 3-Clause-clear License, the text of which is available
+// at https://spdx.org/licenses/BSD-3-Clause-Clear.html or see the "LICENSE" file for more details.
+
+#pragma once
+
+class KWFileHashPartitioner;
+
+#include "KWSortBuckets.h"
+#include "KWKeyExtractor.h"
+#include "PLFileConcatenater.h"
+#include "KWArtificialDataset.h"
+
+//////////////////////////////////////////////////////////////////////
+// Partitionnement d'une base fichier par hashage de sa cle
+// Le fichier en entree est reparti en un nombre donne de fichiers partitions, en une seule passe parallele,
+// sans tri ni echantillonnage prealable des cles. Chaque ligne est envoyee dans la partition d'index
+// (hash de la cle) modulo (nombre de partitions).
+// Les partitions ne sont pas triees, mais toutes les lignes d'une meme cle sont dans la meme partition.
+// En partitionnant une table principale et ses tables secondaires avec le meme nombre de partitions,
+// les partitions de meme index forment ainsi des bases multi-tables independantes, de petite taille,
+// que l'on peut traiter (par exemple trier en memoire) separement.
+class KWFileHashPartitioner : public Object
+{
+public:
+	// Constructeur
+	KWFileHashPartitioner();
+	~KWFileHashPartitioner();
+
+	///////////////////////////////////////////////////////////////
+	// Specification de la cle et des attributs natifs
+
+	// Parametrage des noms des attributs de la cle
+	StringVector* GetKeyAttributeNames();
+
+	// Parametrage des noms de tous les champs natifs
+	StringVector* GetNativeFieldNames();
+
+	/////////////////////////////////////////////////////////////////////
+	// Parametrage de la table d'entree a partitionner
+
+	// Nom du fichier en entree
+	void SetInputFileName(const ALString& sValue);
+	const ALString& GetInputFileName() const;
+
+	// Utilisation d'une ligne d'entete en entree: par defaut true
+	void SetInputHeaderLineUsed(boolean bValue);
+	boolean GetInputHeaderLineUsed() const;
+
+	// Separateur de champs utilise en entree, et conserve en sortie (par defaut: '\t')
+	void SetInputFieldSeparator(char cValue);
+	char GetInputFieldSeparator() const;
+
+	////////////////////////////////////////////////////////////////////
+	// Specification des fichiers en sortie, resultats du partitionnement
+
+	// Noms des fichiers partitions en sortie, un par partition
+	// Le nombre de partitions est la taille du vecteur
+	StringVector* GetOutputFileNames();
+
+	// Utilisation d'une ligne d'entete en sortie: par defaut true
+	void SetOutputHeaderLineUsed(boolean bValue);
+	boolean GetOutputHeaderLineUsed() const;
+
+	/////////////////////////////////////////////////////////////////////
+	// Services
+
+	// Partitionnement de la table d'entree vers les fichiers de sortie
+	// Methode interruptible, retourne false si erreur ou interruption, true sinon
+	// En cas d'echec, les fichiers de sortie sont detruits
+	boolean Partition();
+
+	// Nombre de lignes de chaque partition, disponible apres un partitionnement reussi
+	const LongintVector* GetPartitionLineNumbers() const;
+
+	// Libelles utilisateurs
+	const ALString GetClassLabel() const override;
+	const ALString GetObjectLabel() const override;
+
+	// Methode de test
+	static void Test();
+
+	/////////////////////////////////////////////////
+	///// Implementation
+protected:
+	// Fichier en entree
+	ALString sInputFileName;
+	boolean bInputHeaderLineUsed;
+	char cInputFieldSeparator;
+
+	// Fichiers en sortie
+	StringVector svOutputFileNames;
+	boolean bOutputHeaderLineUsed;
+
+	// Nombre de lignes par partition
+	LongintVector lvPartitionLineNumbers;
+
+	// Nom des champs de cle et natifs, memorises au moyen KWKeyFieldsIndexer
+	KWKeyFieldsIndexer keyFieldsIndexer;
+};
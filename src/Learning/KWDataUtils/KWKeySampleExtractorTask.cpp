@@ -40,6 +40,11 @@ KWKeySampleExtractorTask::KWKeySampleExtractorTask()
 	DeclareTaskOutput(&output_dBufferSize);
 	DeclareTaskOutput(output_oaSampledKeys);
 	DeclareTaskOutput(&output_lSampledKeysUsedMemory);
+
+	// Taches a grain fin : on pre-envoie une tache aux esclaves occupes
+	// Le taux d'echantillonnage d'une tache pre-envoyee peut etre obsolete, ce qui est deja gere
+	// lors de l'aggregation par re-echantillonnage des cles recues
+	SetPipelineDepth(2);
 }
 
 KWKeySampleExtractorTask::~KWKeySampleExtractorTask()
@@ -0,0 +1,613 @@
+// Copyright (c) 2023-2026 Orange. All rights reserved.
+// This software is distributed under the BSD 3-Clause-clear License, the text of which is available
+// at https://spdx.org/licenses/BSD-3-Clause-Clear.html or see the "LICENSE" file for more details.
+
+#include "KWQuantileSketch.h"
+
+KWQuantileSketch::KWQuantileSketch()
+{
+	nSketchSize = nDefaultSketchSize;
+	nStoredValueNumber = 0;
+	nStoredValueCapacity = 0;
+	lValueNumber = 0;
+	lMissingValueNumber = 0;
+	cMinValue = KWContinuous::GetMissingValue();
+	cMaxValue = KWContinuous::GetMissingValue();
+	AddLevel();
+}
+
+KWQuantileSketch::~KWQuantileSketch()
+{
+	oaCompactors.DeleteAll();
+}
+
+void KWQuantileSketch::SetSketchSize(int nValue)
+{
+	require(nValue >= nMinLevelCapacity);
+	require(lValueNumber == 0);
+	require(GetLevelNumber() == 1);
+
+	nSketchSize = nValue;
+	UpdateCapacities();
+}
+
+void KWQuantileSketch::Merge(const KWQuantileSketch* otherSketch)
+{
+	ContinuousVector* cvCompactor;
+	const ContinuousVector* cvOtherCompactor;
+	int nLevel;
+	int i;
+
+	require(otherSketch != NULL);
+	require(otherSketch != this);
+	require(otherSketch->GetSketchSize() == GetSketchSize());
+
+	// Ajout si necessaire de niveaux
+	while (GetLevelNumber() < otherSketch->GetLevelNumber())
+		AddLevel();
+
+	// Concatenation des compacteurs, niveau par niveau
+	for (nLevel = 0; nLevel < otherSketch->GetLevelNumber(); nLevel++)
+	{
+		cvCompactor = cast(ContinuousVector*, oaCompactors.GetAt(nLevel));
+		cvOtherCompactor = cast(const ContinuousVector*, otherSketch->oaCompactors.GetAt(nLevel));
+		for (i = 0; i < cvOtherCompactor->GetSize(); i++)
+			cvCompactor->Add(cvOtherCompactor->GetAt(i));
+	}
+	nStoredValueNumber += otherSketch->nStoredValueNumber;
+
+	// Mise a jour des statistiques exactes
+	if (otherSketch->lValueNumber > 0)
+	{
+		if (lValueNumber == 0)
+		{
+			cMinValue = otherSketch->cMinValue;
+			cMaxValue = otherSketch->cMaxValue;
+		}
+		else
+		{
+			cMinValue = min(cMinValue, otherSketch->cMinValue);
+			cMaxValue = max(cMaxValue, otherSketch->cMaxValue);
+		}
+	}
+	lValueNumber += otherSketch->lValueNumber;
+	lMissingValueNumber += otherSketch->lMissingValueNumber;
+
+	// Compression jusqu'a revenir sous la capacite totale
+	while (nStoredValueNumber >= nStoredValueCapacity)
+		Compress();
+	ensure(nStoredValueNumber < nStoredValueCapacity);
+}
+
+void KWQuantileSketch::Initialize()
+{
+	oaCompactors.DeleteAll();
+	ivCompactionNumbers.SetSize(0);
+	ivLevelCapacities.SetSize(0);
+	nStoredValueNumber = 0;
+	nStoredValueCapacity = 0;
+	lValueNumber = 0;
+	lMissingValueNumber = 0;
+	cMinValue = KWContinuous::GetMissingValue();
+	cMaxValue = KWContinuous::GetMissingValue();
+	AddLevel();
+}
+
+longint KWQuantileSketch::ComputeRank(Continuous cValue) const
+{
+	longint lRank;
+	const ContinuousVector* cvCompactor;
+	int nLevel;
+	int i;
+
+	// Les compacteurs n'etant pas tries, on les parcourt integralement
+	lRank = 0;
+	for (nLevel = 0; nLevel < GetLevelNumber(); nLevel++)
+	{
+		cvCompactor = cast(const ContinuousVector*, oaCompactors.GetAt(nLevel));
+		for (i = 0; i < cvCompactor->GetSize(); i++)
+		{
+			if (cvCompactor->GetAt(i) <= cValue)
+				lRank += (longint)1 << nLevel;
+		}
+	}
+	return lRank;
+}
+
+Continuous KWQuantileSketch::ComputeQuantile(double dProb) const
+{
+	ContinuousVector cvSortedValues;
+	LongintVector lvCumulatedWeights;
+	double dTargetRank;
+	int i;
+
+	require(0 <= dProb and dProb <= 1);
+
+	// Cas particuliers
+	if (lValueNumber == 0)
+		return KWContinuous::GetMissingValue();
+	if (dProb == 0)
+		return cMinValue;
+	if (dProb == 1)
+		return cMaxValue;
+
+	// Recherche de la premiere valeur dont le poids cumule atteint le rang cible
+	ExportSortedValues(&cvSortedValues, &lvCumulatedWeights);
+	dTargetRank = dProb * lValueNumber;
+	for (i = 0; i < cvSortedValues.GetSize(); i++)
+	{
+		if (lvCumulatedWeights.GetAt(i) >= dTargetRank)
+			return cvSortedValues.GetAt(i);
+	}
+	return cMaxValue;
+}
+
+void KWQuantileSketch::ExportBinUpperBounds(int nBinNumber, ContinuousVector* cvBinUpperBounds) const
+{
+	ContinuousVector cvSortedValues;
+	LongintVector lvCumulatedWeights;
+	int nBin;
+	int i;
+	double dTargetRank;
+	Continuous cBound;
+
+	require(nBinNumber > 0);
+	require(cvBinUpperBounds != NULL);
+
+	cvBinUpperBounds->SetSize(0);
+	if (lValueNumber == 0)
+		return;
+
+	// Le min exact constitue la premiere borne
+	cvBinUpperBounds->Add(cMinValue);
+
+	// Parcours synchronise des valeurs triees et des rangs cibles des bornes intermediaires
+	ExportSortedValues(&cvSortedValues, &lvCumulatedWeights);
+	i = 0;
+	for (nBin = 1; nBin < nBinNumber; nBin++)
+	{
+		dTargetRank = (double)nBin * lValueNumber / nBinNumber;
+		while (i < cvSortedValues.GetSize() - 1 and lvCumulatedWeights.GetAt(i) < dTargetRank)
+			i++;
+		cBound = cvSortedValues.GetAt(i);
+
+		// Ajout de la borne si elle est nouvelle, en restant strictement sous le max
+		if (cBound > cvBinUpperBounds->GetAt(cvBinUpperBounds->GetSize() - 1) and cBound < cMaxValue)
+			cvBinUpperBounds->Add(cBound);
+	}
+
+	// Le max exact constitue la derniere borne
+	if (cMaxValue > cvBinUpperBounds->GetAt(cvBinUpperBounds->GetSize() - 1))
+		cvBinUpperBounds->Add(cMaxValue);
+	ensure(cvBinUpperBounds->GetSize() <= nBinNumber + 1);
+}
+
+int KWQuantileSketch::SearchBinIndex(const ContinuousVector* cvBinUpperBounds, Continuous cValue)
+{
+	int nLower;
+	int nUpper;
+	int nMiddle;
+
+	require(cvBinUpperBounds != NULL);
+
+	// Recherche dichotomique de la premiere borne superieure ou egale a la valeur
+	nLower = 0;
+	nUpper = cvBinUpperBounds->GetSize();
+	while (nLower < nUpper)
+	{
+		nMiddle = (nLower + nUpper) / 2;
+		if (cvBinUpperBounds->GetAt(nMiddle) < cValue)
+			nLower = nMiddle + 1;
+		else
+			nUpper = nMiddle;
+	}
+	ensure(nLower == cvBinUpperBounds->GetSize() or cValue <= cvBinUpperBounds->GetAt(nLower));
+	ensure(nLower == 0 or cvBinUpperBounds->GetAt(nLower - 1) < cValue);
+	return nLower;
+}
+
+longint KWQuantileSketch::ComputeMaxUsedMemory(int nSketchSize)
+{
+	longint lMaxUsedMemory;
+
+	require(nSketchSize >= nMinLevelCapacity);
+
+	// La capacite totale des compacteurs est inferieure a 3 fois la taille du sketch, et on prend une marge
+	// pour le retaillage des vecteurs
+	lMaxUsedMemory = sizeof(KWQuantileSketch);
+	lMaxUsedMemory += 2 * 3 * (longint)nSketchSize * sizeof(Continuous);
+	lMaxUsedMemory += nMaxLevelNumber * (sizeof(ContinuousVector) + sizeof(Object*) + 2 * sizeof(int));
+	return lMaxUsedMemory;
+}
+
+KWQuantileSketch* KWQuantileSketch::Clone() const
+{
+	KWQuantileSketch* cloneSketch;
+
+	cloneSketch = new KWQuantileSketch;
+	cloneSketch->CopyFrom(this);
+	return cloneSketch;
+}
+
+void KWQuantileSketch::CopyFrom(const KWQuantileSketch* sourceSketch)
+{
+	int nLevel;
+
+	require(sourceSketch != NULL);
+
+	// Recopie des compacteurs
+	oaCompactors.DeleteAll();
+	oaCompactors.SetSize(sourceSketch->GetLevelNumber());
+	for (nLevel = 0; nLevel < sourceSketch->GetLevelNumber(); nLevel++)
+		oaCompactors.SetAt(nLevel, cast(ContinuousVector*, sourceSketch->oaCompactors.GetAt(nLevel))->Clone());
+	ivCompactionNumbers.CopyFrom(&sourceSketch->ivCompactionNumbers);
+	ivLevelCapacities.CopyFrom(&sourceSketch->ivLevelCapacities);
+
+	// Recopie des autres caracteristiques
+	nSketchSize = sourceSketch->nSketchSize;
+	nStoredValueNumber = sourceSketch->nStoredValueNumber;
+	nStoredValueCapacity = sourceSketch->nStoredValueCapacity;
+	lValueNumber = sourceSketch->lValueNumber;
+	lMissingValueNumber = sourceSketch->lMissingValueNumber;
+	cMinValue = sourceSketch->cMinValue;
+	cMaxValue = sourceSketch->cMaxValue;
+}
+
+longint KWQuantileSketch::GetUsedMemory() const
+{
+	longint lUsedMemory;
+	int nLevel;
+
+	lUsedMemory = sizeof(KWQuantileSketch);
+	lUsedMemory += oaCompactors.GetUsedMemory() - sizeof(ObjectArray);
+	lUsedMemory += ivCompactionNumbers.GetUsedMemory() - sizeof(IntVector);
+	lUsedMemory += ivLevelCapacities.GetUsedMemory() - sizeof(IntVector);
+	for (nLevel = 0; nLevel < GetLevelNumber(); nLevel++)
+		lUsedMemory += cast(ContinuousVector*, oaCompactors.GetAt(nLevel))->GetUsedMemory();
+	return lUsedMemory;
+}
+
+void KWQuantileSketch::Write(ostream& ost) const
+{
+	ost << GetClassLabel() << "\n";
+	ost << "Sketch size\t" << GetSketchSize() << "\n";
+	ost << "Values\t" << GetValueNumber() << "\n";
+	ost << "Missing values\t" << GetMissingValueNumber() << "\n";
+	ost << "Stored values\t" << GetStoredValueNumber() << "\n";
+	ost << "Levels\t" << GetLevelNumber() << "\n";
+	ost << "Min\t" << KWContinuous::ContinuousToString(GetMinValue()) << "\n";
+	ost << "Max\t" << KWContinuous::ContinuousToString(GetMaxValue()) << "\n";
+}
+
+const ALString KWQuantileSketch::GetClassLabel() const
+{
+	return "Quantile sketch";
+}
+
+void KWQuantileSketch::Test()
+{
+	const int nValueNumber = 100000;
+	const int nSketchNumber = 4;
+	KWQuantileSketch sketch;
+	KWQuantileSketch mergedSketch;
+	KWQuantileSketch partSketches[nSketchNumber];
+	KWQuantileSketch smallSketch;
+	ContinuousVector cvBinUpperBounds;
+	Continuous cValue;
+	double dProb;
+	longint lRankError;
+	longint lMaxRankError;
+	int i;
+
+	// Alimentation d'un sketch avec une permutation des entiers de 0 a N-1, plus des valeurs manquantes
+	for (i = 0; i < nValueNumber; i++)
+	{
+		cValue = (Continuous)(((longint)i * 7919) % nValueNumber);
+		sketch.AddValue(cValue);
+		partSketches[i % nSketchNumber].AddValue(cValue);
+		if (i % 1000 == 0)
+		{
+			sketch.AddValue(KWContinuous::GetMissingValue());
+			partSketches[i % nSketchNumber].AddValue(KWContinuous::GetMissingValue());
+		}
+	}
+	cout << "Sketch of a permutation of " << nValueNumber << " values" << endl;
+	cout << sketch << endl;
+
+	// Quantiles estimes, a comparer aux quantiles exacts
+	cout << "Prob\tQuantile\tExact" << endl;
+	for (i = 0; i <= 10; i++)
+	{
+		dProb = i / 10.0;
+		cout << dProb << "\t" << KWContinuous::ContinuousToString(sketch.ComputeQuantile(dProb)) << "\t"
+		     << (int)floor(dProb * (nValueNumber - 1)) << endl;
+	}
+
+	// Erreur max sur les rangs
+	lMaxRankError = 0;
+	for (i = 0; i < nValueNumber; i += 97)
+	{
+		lRankError = sketch.ComputeRank(i) - (i + 1);
+		if (lRankError < 0)
+			lRankError = -lRankError;
+		lMaxRankError = max(lMaxRankError, lRankError);
+	}
+	cout << "Max rank error below 2%\t" << BooleanToString(lMaxRankError < nValueNumber / 50) << endl;
+	cout << endl;
+
+	// Fusion de sketchs partiels
+	for (i = 0; i < nSketchNumber; i++)
+		mergedSketch.Merge(&partSketches[i]);
+	cout << "Merged sketch of " << nSketchNumber << " partial sketches" << endl;
+	cout << mergedSketch << endl;
+	lMaxRankError = 0;
+	for (i = 0; i < nValueNumber; i += 97)
+	{
+		lRankError = mergedSketch.ComputeRank(i) - (i + 1);
+		if (lRankError < 0)
+			lRankError = -lRankError;
+		lMaxRankError = max(lMaxRankError, lRankError);
+	}
+	cout << "Max rank error below 2%\t" << BooleanToString(lMaxRankError < nValueNumber / 50) << endl;
+	cout << endl;
+
+	// Bornes de bins equi-frequents
+	sketch.ExportBinUpperBounds(10, &cvBinUpperBounds);
+	cout << "Bin upper bounds (10 bins)" << endl;
+	for (i = 0; i < cvBinUpperBounds.GetSize(); i++)
+		cout << "\t" << KWContinuous::ContinuousToString(cvBinUpperBounds.GetAt(i));
+	cout << endl;
+	cout << "Bin index of 55555\t" << SearchBinIndex(&cvBinUpperBounds, 55555) << endl;
+	cout << endl;
+
+	// Cas de peu de valeurs distinctes: les bornes sont les valeurs elles-memes
+	for (i = 0; i < nValueNumber; i++)
+		smallSketch.AddValue((Continuous)(i % 5));
+	smallSketch.ExportBinUpperBounds(10, &cvBinUpperBounds);
+	cout << "Bin upper bounds (10 bins) for 5 distinct values" << endl;
+	for (i = 0; i < cvBinUpperBounds.GetSize(); i++)
+		cout << "\t" << KWContinuous::ContinuousToString(cvBinUpperBounds.GetAt(i));
+	cout << endl;
+	cout << endl;
+
+	// Serialisation et deserialisation
+	PLShared_QuantileSketch::Test();
+}
+
+int KWQuantileSketch::ComputeLevelCapacity(int nLevel) const
+{
+	int nCapacity;
+
+	require(0 <= nLevel and nLevel < GetLevelNumber());
+
+	nCapacity = (int)ceil(nSketchSize * pow(2.0 / 3, GetLevelNumber() - 1 - nLevel));
+	return max(nCapacity, (int)nMinLevelCapacity);
+}
+
+void KWQuantileSketch::AddLevel()
+{
+	oaCompactors.Add(new ContinuousVector);
+	ivCompactionNumbers.Add(0);
+	UpdateCapacities();
+}
+
+void KWQuantileSketch::UpdateCapacities()
+{
+	int nLevel;
+
+	ivLevelCapacities.SetSize(GetLevelNumber());
+	nStoredValueCapacity = 0;
+	for (nLevel = 0; nLevel < GetLevelNumber(); nLevel++)
+	{
+		ivLevelCapacities.SetAt(nLevel, ComputeLevelCapacity(nLevel));
+		nStoredValueCapacity += ivLevelCapacities.GetAt(nLevel);
+	}
+}
+
+void KWQuantileSketch::Compress()
+{
+	int nLevel;
+
+	// Compaction du premier niveau plein, qui existe forcement si la capacite totale est atteinte
+	for (nLevel = 0; nLevel < GetLevelNumber(); nLevel++)
+	{
+		if (cast(ContinuousVector*, oaCompactors.GetAt(nLevel))->GetSize() >= ivLevelCapacities.GetAt(nLevel))
+		{
+			// Ajout d'un niveau si necessaire
+			if (nLevel == GetLevelNumber() - 1)
+				AddLevel();
+			CompactLevel(nLevel);
+			break;
+		}
+	}
+}
+
+void KWQuantileSketch::CompactLevel(int nLevel)
+{
+	ContinuousVector* cvCompactor;
+	ContinuousVector* cvUpperCompactor;
+	int nPairNumber;
+	int nOffset;
+	int i;
+	Continuous cRemainingValue;
+	boolean bRemainingValue;
+
+	require(0 <= nLevel and nLevel < GetLevelNumber() - 1);
+
+	cvCompactor = cast(ContinuousVector*, oaCompactors.GetAt(nLevel));
+	cvUpperCompactor = cast(ContinuousVector*, oaCompactors.GetAt(nLevel + 1));
+	assert(cvCompactor->GetSize() >= 2);
+
+	// Tri du compacteur, en laissant de cote la plus grande valeur si leur nombre est impair
+	cvCompactor->Sort();
+	nPairNumber = cvCompactor->GetSize() / 2;
+	bRemainingValue = cvCompactor->GetSize() % 2 == 1;
+	cRemainingValue = cvCompactor->GetAt(cvCompactor->GetSize() - 1);
+
+	// Promotion d'une valeur sur deux, en alternant les positions paires et impaires d'une compaction a l'autre
+	nOffset = ivCompactionNumbers.GetAt(nLevel) % 2;
+	ivCompactionNumbers.UpgradeAt(nLevel, 1);
+	for (i = 0; i < nPairNumber; i++)
+		cvUpperCompactor->Add(cvCompactor->GetAt(2 * i + nOffset));
+
+	// Vidage du compacteur
+	cvCompactor->SetSize(0);
+	if (bRemainingValue)
+		cvCompactor->Add(cRemainingValue);
+	nStoredValueNumber -= nPairNumber;
+}
+
+void KWQuantileSketch::ExportSortedValues(ContinuousVector* cvSortedValues, LongintVector* lvCumulatedWeights) const
+{
+	ObjectArray oaSortedCompactors;
+	IntVector ivPositions;
+	ContinuousVector* cvSortedCompactor;
+	int nLevel;
+	int nBestLevel;
+	Continuous cBestValue;
+	longint lCumulatedWeight;
+
+	require(cvSortedValues != NULL);
+	require(lvCumulatedWeights != NULL);
+
+	// Tri d'une copie de chaque compacteur
+	for (nLevel = 0; nLevel < GetLevelNumber(); nLevel++)
+	{
+		cvSortedCompactor = cast(ContinuousVector*, oaCompactors.GetAt(nLevel))->Clone();
+		cvSortedCompactor->Sort();
+		oaSortedCompactors.Add(cvSortedCompactor);
+	}
+	ivPositions.SetSize(GetLevelNumber());
+
+	// Fusion des compacteurs tries, en cumulant les poids
+	cvSortedValues->SetSize(0);
+	lvCumulatedWeights->SetSize(0);
+	lCumulatedWeight = 0;
+	while (cvSortedValues->GetSize() < nStoredValueNumber)
+	{
+		// Recherche de la plus petite valeur courante parmi les niveaux
+		nBestLevel = -1;
+		cBestValue = 0;
+		for (nLevel = 0; nLevel < GetLevelNumber(); nLevel++)
+		{
+			cvSortedCompactor = cast(ContinuousVector*, oaSortedCompactors.GetAt(nLevel));
+			if (ivPositions.GetAt(nLevel) < cvSortedCompactor->GetSize() and
+			    (nBestLevel == -1 or cvSortedCompactor->GetAt(ivPositions.GetAt(nLevel)) < cBestValue))
+			{
+				nBestLevel = nLevel;
+				cBestValue = cvSortedCompactor->GetAt(ivPositions.GetAt(nLevel));
+			}
+		}
+		assert(nBestLevel != -1);
+
+		// Ajout de la valeur avec son poids cumule
+		ivPositions.UpgradeAt(nBestLevel, 1);
+		lCumulatedWeight += (longint)1 << nBestLevel;
+		cvSortedValues->Add(cBestValue);
+		lvCumulatedWeights->Add(lCumulatedWeight);
+	}
+	assert(lCumulatedWeight == lValueNumber);
+	oaSortedCompactors.DeleteAll();
+}
+
+///////////////////////////////////////////////////////
+// Classe PLShared_QuantileSketch
+
+PLShared_QuantileSketch::PLShared_QuantileSketch() {}
+
+PLShared_QuantileSketch::~PLShared_QuantileSketch() {}
+
+void PLShared_QuantileSketch::Test()
+{
+	KWQuantileSketch sketch;
+	PLShared_QuantileSketch shared_sketch;
+	PLSerializer serializer;
+	int i;
+
+	// Alimentation d'un sketch
+	for (i = 0; i < 10000; i++)
+		sketch.AddValue((Continuous)((i * 101) % 10000));
+
+	// Serialisation
+	serializer.OpenForWrite(NULL);
+	shared_sketch.bIsDeclared = true;
+	shared_sketch.GetQuantileSketch()->CopyFrom(&sketch);
+	shared_sketch.Serialize(&serializer);
+	serializer.Close();
+
+	// Deserialisation
+	serializer.OpenForRead(NULL);
+	shared_sketch.Deserialize(&serializer);
+	serializer.Close();
+
+	// Affichage
+	cout << "Deserialized sketch" << endl;
+	cout << *shared_sketch.GetQuantileSketch() << endl;
+	cout << "Same median\t"
+	     << BooleanToString(shared_sketch.GetQuantileSketch()->ComputeQuantile(0.5) == sketch.ComputeQuantile(0.5))
+	     << endl;
+}
+
+void PLShared_QuantileSketch::SerializeObject(PLSerializer* serializer, const Object* o) const
+{
+	const KWQuantileSketch* sketch;
+	PLShared_ContinuousVector shared_cvCompactor;
+	int nLevel;
+
+	require(serializer != NULL);
+	require(serializer->IsOpenForWrite());
+	require(o != NULL);
+
+	sketch = cast(const KWQuantileSketch*, o);
+
+	// Serialisation des caracteristiques globales
+	serializer->PutInt(sketch->nSketchSize);
+	serializer->PutLongint(sketch->lValueNumber);
+	serializer->PutLongint(sketch->lMissingValueNumber);
+	serializer->PutDouble(sketch->cMinValue);
+	serializer->PutDouble(sketch->cMaxValue);
+
+	// Serialisation des compacteurs
+	serializer->PutIntVector(&sketch->ivCompactionNumbers);
+	for (nLevel = 0; nLevel < sketch->GetLevelNumber(); nLevel++)
+		shared_cvCompactor.SerializeObject(serializer, sketch->oaCompactors.GetAt(nLevel));
+}
+
+void PLShared_QuantileSketch::DeserializeObject(PLSerializer* serializer, Object* o) const
+{
+	KWQuantileSketch* sketch;
+	PLShared_ContinuousVector shared_cvCompactor;
+	ContinuousVector* cvCompactor;
+	int nLevel;
+
+	require(serializer != NULL);
+	require(serializer->IsOpenForRead());
+	require(o != NULL);
+
+	sketch = cast(KWQuantileSketch*, o);
+
+	// Deserialisation des caracteristiques globales
+	sketch->oaCompactors.DeleteAll();
+	sketch->nSketchSize = serializer->GetInt();
+	sketch->lValueNumber = serializer->GetLongint();
+	sketch->lMissingValueNumber = serializer->GetLongint();
+	sketch->cMinValue = serializer->GetDouble();
+	sketch->cMaxValue = serializer->GetDouble();
+
+	// Deserialisation des compacteurs
+	serializer->GetIntVector(&sketch->ivCompactionNumbers);
+	sketch->nStoredValueNumber = 0;
+	for (nLevel = 0; nLevel < sketch->ivCompactionNumbers.GetSize(); nLevel++)
+	{
+		cvCompactor = new ContinuousVector;
+		shared_cvCompactor.DeserializeObject(serializer, cvCompactor);
+		sketch->oaCompactors.Add(cvCompactor);
+		sketch->nStoredValueNumber += cvCompactor->GetSize();
+	}
+	sketch->UpdateCapacities();
+}
+
+Object* PLShared_QuantileSketch::Create() const
+{
+	return new KWQuantileSketch;
+}
@@ -0,0 +1,264 @@
+// Copyright (c) 2023-2026 Orange. All rights reserved.
+// This software is distributed under the BSD 3-Clause-clear License, the text of which is available
+// at https://spdx.org/licenses/BSD-3-Clause-Clear.html or see the "LICENSE" file for more details.
+
+#pragma once
+
+class KWQuantileSketch;
+class PLShared_QuantileSketch;
+
+#include "Object.h"
+#include "Vector.h"
+#include "KWContinuous.h"
+#include "PLSharedObject.h"
+
+/////////////////////////////////////////////////////////////////////////////////
+// Classe KWQuantileSketch
+// Resume compact d'un flux de valeurs numeriques, permettant d'estimer ses quantiles
+// en une seule passe et en memoire bornee, selon l'algorithme KLL
+//   Karnin, Lang et Liberty, "Optimal quantile approximation in streams", FOCS 2016
+// Les valeurs sont stockees dans une hierarchie de compacteurs, ou chaque valeur du compacteur
+// de niveau h represente 2^h valeurs du flux. Quand un compacteur est plein, il est trie et une
+// valeur sur deux est promue au niveau superieur.
+// Les sketchs sont fusionnables, ce qui permet de les calculer independamment par esclave, puis
+// de les agreger dans le maitre.
+// L'erreur sur les rangs est de l'ordre de 1.7/K, pour un sketch de taille K (defaut: 200, soit environ 1%),
+// avec une memoire de l'ordre de 3*K valeurs, quel que soit le nombre de valeurs du flux.
+// Les compactions sont deterministes (alternance des positions promues), ce qui garantit la reproductibilite
+// des resultats pour un meme ordre d'ajout et de fusion des valeurs
+class KWQuantileSketch : public Object
+{
+public:
+	// Constructeur
+	KWQuantileSketch();
+	~KWQuantileSketch();
+
+	// Taille du sketch, pilotant sa precision (defaut: 200)
+	// Ne peut etre modifie que si le sketch est vide
+	void SetSketchSize(int nValue);
+	int GetSketchSize() const;
+
+	// Taille par defaut du sketch
+	static int GetDefaultSketchSize();
+
+	// Ajout d'une valeur, la valeur manquante etant comptee a part
+	void AddValue(Continuous cValue);
+
+	// Fusion avec un autre sketch de meme taille
+	void Merge(const KWQuantileSketch* otherSketch);
+
+	// Reinitialisation
+	void Initialize();
+
+	// Nombre de valeurs ajoutees, hors valeurs manquantes
+	longint GetValueNumber() const;
+
+	// Nombre de valeurs manquantes
+	longint GetMissingValueNumber() const;
+
+	// Valeurs min et max exactes (valeur manquante si aucune valeur)
+	Continuous GetMinValue() const;
+	Continuous GetMaxValue() const;
+
+	// Nombre de valeurs effectivement stockees dans le sketch
+	int GetStoredValueNumber() const;
+
+	// Estimation du rang d'une valeur: nombre de valeurs inferieures ou egales
+	longint ComputeRank(Continuous cValue) const;
+
+	// Estimation du quantile d'une probabilite comprise entre 0 et 1
+	// Renvoie exactement le min pour 0 et le max pour 1
+	Continuous ComputeQuantile(double dProb) const;
+
+	// Calcul des bornes superieures de bins approximativement equi-frequents
+	// Les bornes sont distinctes et croissantes: la premiere borne est le min exact (bin reduit a cette valeur),
+	// la derniere le max exact, et il y a au plus nBinNumber+1 bornes
+	// Chaque valeur non manquante est ainsi associee a la plus petite borne superieure ou egale
+	// Le vecteur en sortie est vide s'il n'y a aucune valeur
+	void ExportBinUpperBounds(int nBinNumber, ContinuousVector* cvBinUpperBounds) const;
+
+	// Recherche de l'index de la plus petite borne superieure ou egale a une valeur, dans un vecteur
+	// de bornes croissantes (taille du vecteur si la valeur est au dela de la derniere borne)
+	static int SearchBinIndex(const ContinuousVector* cvBinUpperBounds, Continuous cValue);
+
+	// Estimation de la memoire maximale utilisee par un sketch d'une taille donnee, quel que soit le nombre
+	// de valeurs ajoutees
+	static longint ComputeMaxUsedMemory(int nSketchSize);
+
+	// Duplication
+	KWQuantileSketch* Clone() const;
+	void CopyFrom(const KWQuantileSketch* sourceSketch);
+
+	// Memoire utilisee
+	longint GetUsedMemory() const override;
+
+	// Affichage
+	void Write(ostream& ost) const override;
+
+	// Libelles utilisateur
+	const ALString GetClassLabel() const override;
+
+	// Methode de test
+	static void Test();
+
+	///////////////////////////////////////////////////////////////////////////////
+	///// Implementation
+protected:
+	// Nombre de niveaux de compacteurs
+	int GetLevelNumber() const;
+
+	// Capacite d'un compacteur, decroissant geometriquement avec sa distance au plus haut niveau
+	int ComputeLevelCapacity(int nLevel) const;
+
+	// Ajout d'un niveau de compacteur, et mise a jour des capacites par niveau et de la capacite totale
+	void AddLevel();
+	void UpdateCapacities();
+
+	// Compaction du premier niveau ayant atteint sa capacite
+	void Compress();
+
+	// Compaction d'un niveau, en promouvant une valeur sur deux au niveau superieur
+	void CompactLevel(int nLevel);
+
+	// Export de toutes les valeurs stockees triees, avec leur poids cumule
+	void ExportSortedValues(ContinuousVector* cvSortedValues, LongintVector* lvCumulatedWeights) const;
+
+	// Taille du sketch
+	int nSketchSize;
+
+	// Compacteurs par niveau (ContinuousVector), le niveau h contenant des valeurs de poids 2^h
+	ObjectArray oaCompactors;
+
+	// Nombre de compactions effectuees par niveau, dont la parite determine les valeurs promues
+	IntVector ivCompactionNumbers;
+
+	// Capacite par niveau, recalculee a chaque ajout de niveau
+	IntVector ivLevelCapacities;
+
+	// Nombre total de valeurs stockees et capacite totale des compacteurs
+	int nStoredValueNumber;
+	int nStoredValueCapacity;
+
+	// Statistiques exactes
+	longint lValueNumber;
+	longint lMissingValueNumber;
+	Continuous cMinValue;
+	Continuous cMaxValue;
+
+	// Taille par defaut et taille minimum d'un compacteur
+	static const int nDefaultSketchSize = 200;
+	static const int nMinLevelCapacity = 2;
+
+	// Nombre maximum de niveaux, les poids des valeurs etant des longint
+	static const int nMaxLevelNumber = 64;
+
+	friend class PLShared_QuantileSketch;
+};
+
+///////////////////////////////////////////////////////
+// Classe PLShared_QuantileSketch
+// Serialisation des sketchs de quantiles
+class PLShared_QuantileSketch : public PLSharedObject
+{
+public:
+	// Constructeur
+	PLShared_QuantileSketch();
+	~PLShared_QuantileSketch();
+
+	// Acces au sketch
+	void SetQuantileSketch(KWQuantileSketch* sketch);
+	KWQuantileSketch* GetQuantileSketch();
+
+	// Reimplementation des methodes virtuelles
+	void SerializeObject(PLSerializer* serializer, const Object* o) const override;
+	void DeserializeObject(PLSerializer* serializer, Object* o) const override;
+
+	// Methode de test
+	static void Test();
+
+	//////////////////////////////////////////////////////////////////
+	///// Implementation
+protected:
+	Object* Create() const override;
+};
+
+////////////////////////////////////////////////////////////////////
+// Methodes en inline
+
+inline int KWQuantileSketch::GetSketchSize() const
+{
+	return nSketchSize;
+}
+
+inline int KWQuantileSketch::GetDefaultSketchSize()
+{
+	return nDefaultSketchSize;
+}
+
+inline void KWQuantileSketch::AddValue(Continuous cValue)
+{
+	// Cas de la valeur manquante
+	if (cValue == KWContinuous::GetMissingValue())
+	{
+		lMissingValueNumber++;
+		return;
+	}
+
+	// Mise a jour des statistiques exactes
+	if (lValueNumber == 0)
+	{
+		cMinValue = cValue;
+		cMaxValue = cValue;
+	}
+	else if (cValue < cMinValue)
+		cMinValue = cValue;
+	else if (cValue > cMaxValue)
+		cMaxValue = cValue;
+	lValueNumber++;
+
+	// Ajout dans le premier compacteur, avec compression si necessaire
+	cast(ContinuousVector*, oaCompactors.GetAt(0))->Add(cValue);
+	nStoredValueNumber++;
+	if (nStoredValueNumber >= nStoredValueCapacity)
+		Compress();
+}
+
+inline longint KWQuantileSketch::GetValueNumber() const
+{
+	return lValueNumber;
+}
+
+inline longint KWQuantileSketch::GetMissingValueNumber() const
+{
+	return lMissingValueNumber;
+}
+
+inline Continuous KWQuantileSketch::GetMinValue() const
+{
+	return cMinValue;
+}
+
+inline Continuous KWQuantileSketch::GetMaxValue() const
+{
+	return cMaxValue;
+}
+
+inline int KWQuantileSketch::GetStoredValueNumber() const
+{
+	return nStoredValueNumber;
+}
+
+inline int KWQuantileSketch::GetLevelNumber() const
+{
+	return oaCompactors.GetSize();
+}
+
+inline void PLShared_QuantileSketch::SetQuantileSketch(KWQuantileSketch* sketch)
+{
+	SetObject(sketch);
+}
+
+inline KWQuantileSketch* PLShared_QuantileSketch::GetQuantileSketch()
+{
+	return cast(KWQuantileSketch*, GetObject());
+}
@@ -9,6 +9,7 @@
 KWSortBuckets::KWSortBuckets()
 {
 	bIsIndexComputed = false;
+	bIsHashPartitioned = false;
 }
 
 KWSortBuckets::~KWSortBuckets()
@@ -29,6 +30,7 @@ void KWSortBuckets::Build(KWSortBucket* mainBucket, const ObjectArray* oaSplits)
 	require(mainBucket->Check());
 	require(oaSplits != NULL);
 	require(oaSplits->GetSize() > 0);
+	require(not bIsHashPartitioned);
 
 	// Nettoyage initial
 	DeleteAll();
@@ -86,6 +88,28 @@ void KWSortBuckets::Build(KWSortBucket* mainBucket, const ObjectArray* oaSplits)
 	ensure(Check());
 }
 
+void KWSortBuckets::BuildHashPartitions(int nPartitionNumber)
+{
+	int i;
+
+	require(nPartitionNumber > 0);
+
+	// Nettoyage initial
+	DeleteAll();
+	bIsHashPartitioned = true;
+
+	// Creation des partitions, sans bornes
+	for (i = 0; i < nPartitionNumber; i++)
+		oaBuckets.Add(new KWSortBucket);
+	ensure(Check());
+}
+
+void KWSortBuckets::SetHashPartitioned(boolean bValue)
+{
+	require(GetBucketNumber() == 0);
+	bIsHashPartitioned = bValue;
+}
+
 void KWSortBuckets::Initialize(const ObjectArray* oaSourceBuckets)
 {
 	KWSortBucket* bucket;
@@ -121,6 +145,7 @@ void KWSortBuckets::SplitLargeBucket(KWSortBucket* largeBucket, KWSortBuckets* s
 
 	require(largeBucket != NULL);
 	require(largeBucket->Check());
+	require(not bIsHashPartitioned);
 	require(subBuckets != NULL);
 	require(subBuckets->Check());
 	require(largeBucket->GetLowerBound()->Compare(
@@ -176,6 +201,15 @@ void KWSortBuckets::IndexBuckets()
 
 	require(Check());
 
+	// Pas d'index en mode partitionnement par hashage : l'index du bucket est calcule directement
+	if (bIsHashPartitioned)
+	{
+		oaDistinctKeys.RemoveAll();
+		ivBucketIndexes.SetSize(0);
+		bIsIndexComputed = true;
+		return;
+	}
+
 	// Initialisation des resultats
 	oaDistinctKeys.RemoveAll();
 	ivBucketIndexes.SetSize(0);
@@ -244,6 +278,15 @@ KWSortBucket* KWSortBuckets::SearchBucket(const KWKey* key) const
 	require(key != NULL);
 	require(oaBuckets.GetSize() > 0);
 	require(bIsIndexComputed);
+
+	// Acces direct en mode partitionnement par hashage
+	if (bIsHashPartitioned)
+	{
+		nIndex = (int)(key->ComputeHashValue() % oaBuckets.GetSize());
+		if (nIndex < 0)
+			nIndex += oaBuckets.GetSize();
+		return cast(KWSortBucket*, oaBuckets.GetAt(nIndex));
+	}
 	require(cast(KWSortBucket*, oaBuckets.GetAt(0))->IsLessOrEqualThan(key));
 	require(cast(KWSortBucket*, oaBuckets.GetAt(GetBucketNumber() - 1))->IsGreaterOrEqualThan(key));
 
@@ -353,6 +396,7 @@ void KWSortBuckets::CopyFrom(const KWSortBuckets* sbSource)
 	oaDistinctKeys.CopyFrom(&sbSource->oaDistinctKeys);
 	ivBucketIndexes.CopyFrom(&sbSource->ivBucketIndexes);
 	bIsIndexComputed = sbSource->bIsIndexComputed;
+	bIsHashPartitioned = sbSource->bIsHashPartitioned;
 }
 
 boolean KWSortBuckets::Check() const
@@ -375,7 +419,17 @@ boolean KWSortBuckets::Check() const
 	{
 		bucket = cast(KWSortBucket*, oaBuckets.GetAt(i));
 		bOk = bOk and bucket->Check();
-		if (lastBucket != NULL)
+
+		// Les partitions par hashage n'ont pas de bornes
+		if (bIsHashPartitioned)
+		{
+			if (bOk and (bucket->GetLowerBound()->GetSize() > 0 or bucket->GetUpperBound()->GetSize() > 0))
+			{
+				bOk = false;
+				bucket->AddError("Hash partition should not have bounds");
+			}
+		}
+		else if (lastBucket != NULL)
 		{
 			if (bOk and lastBucket->GetUpperBound()->Compare(bucket->GetLowerBound()) != 0)
 			{
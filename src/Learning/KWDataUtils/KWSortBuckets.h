@@ -22,6 +22,10 @@ class PLShared_SortBucket;
 //	- de construire les chunks a partir des bornes issues d'un sampling (splits)
 //  - de remplacer un chunk par deux sous-chunks (resultats du split de ce premier chunk)
 //	- de verifier l'appartenance d'une clef a un chunk
+// Les buckets peuvent egalement etre des partitions par hashage de la cle, sans bornes:
+// une clef appartient alors au bucket d'index (hash de la cle) modulo (nombre de buckets).
+// Deux fichiers partitionnes avec le meme nombre de partitions ont ainsi les memes clefs
+// dans leurs partitions de meme index, ce qui permet de les traiter independamment.
 class KWSortBuckets : public Object
 {
 public:
@@ -43,6 +47,14 @@ public:
 	// Les parametres en entree appartienennt a l'appelant et sont inchanges lors de l'appel
 	void Build(KWSortBucket* mainBucket, const ObjectArray* oaSplits);
 
+	// Construit nPartitionNumber buckets sans bornes, en mode partitionnement par hashage
+	void BuildHashPartitions(int nPartitionNumber);
+
+	// Mode partitionnement par hashage (defaut: false)
+	// Le mode ne peut etre modifie que si le container est vide; il est conserve par RemoveAll et DeleteAll
+	void SetHashPartitioned(boolean bValue);
+	boolean IsHashPartitioned() const;
+
 	// Initialisation a partir d'un tableau de buckets (KWSortBucket)
 	// Memoire: les buckets sont recopies
 	void Initialize(const ObjectArray* oaSourceBuckets);
@@ -71,7 +83,7 @@ public:
 
 	// Ajoute une ligne au bucket qui contient la clef key
 	// La taille des buffers est mise a jour
-	// La recherche du bucket est dichotomique
+	// La recherche du bucket est dichotomique (directe en mode partitionnement par hashage)
 	void AddLineAtKey(KWKey* key, CharVector* cvLine);
 
 	// Renvoie le premier chunk qui est plus gros que la taille specifiee
@@ -83,7 +95,7 @@ public:
 	// Recopie du contenu
 	void CopyFrom(const KWSortBuckets* bSource);
 
-	// Verification de coherence de l'ensemble des buckets (bornes des buckets)
+	// Verification de coherence de l'ensemble des buckets (bornes des buckets, absentes en mode hashage)
 	boolean Check() const override;
 
 	// Verification des noms de fichier des buckets
@@ -119,6 +131,9 @@ protected:
 	// Index du premier bucket du container correspondant a chaque cle distincte
 	IntVector ivBucketIndexes;
 	boolean bIsIndexComputed;
+
+	// Mode partitionnement par hashage
+	boolean bIsHashPartitioned;
 };
 
 /////////////////////////////////////////////////////////////////////////////////
@@ -282,6 +297,11 @@ inline int KWSortBuckets::GetBucketNumber() const
 	return oaBuckets.GetSize();
 }
 
+inline boolean KWSortBuckets::IsHashPartitioned() const
+{
+	return bIsHashPartitioned;
+}
+
 inline KWSortBucket* KWSortBuckets::GetBucketAt(int nIndex) const
 {
 	require(oaBuckets.GetSize() > nIndex);
@@ -23,6 +23,7 @@ KWSortedChunkBuilderTask::KWSortedChunkBuilderTask()
 
 	shared_oaBuckets = new PLShared_ObjectArray(new PLShared_SortBucket);
 	DeclareSharedParameter(shared_oaBuckets);
+	DeclareSharedParameter(&shared_bHashPartitioned);
 	DeclareSharedParameter(&shared_sFileName);
 	DeclareSharedParameter(&shared_bHeaderLineUsed);
 	DeclareSharedParameter(&shared_cInputFieldSeparator);
@@ -121,6 +122,7 @@ boolean KWSortedChunkBuilderTask::BuildSortedChunks(const KWSortBuckets* buckets
 		bucket->SetId(IntToString(i));
 		shared_oaBuckets->GetObjectArray()->Add(bucket);
 	}
+	shared_bHashPartitioned = buckets->IsHashPartitioned();
 	if (GetVerbose())
 		AddMessage(sTmp + "Bucket Number : " + IntToString(i));
 
@@ -535,6 +537,7 @@ boolean KWSortedChunkBuilderTask::SlaveInitialize()
 	keyExtractor.SetKeyFieldIndexes(shared_ivKeyFieldIndexes.GetConstIntVector());
 
 	// Initialisation des buckets a partir d'un tableau de buckets (transfert des buckets)
+	slaveBuckets.SetHashPartitioned(shared_bHashPartitioned);
 	slaveBuckets.Initialize(shared_oaBuckets->GetObjectArray());
 	slaveBuckets.IndexBuckets();
 	assert(slaveBuckets.Check());
@@ -66,6 +66,8 @@ public:
 	// - la liste des fichiers qui le constitue
 	// - le nombre de lignes de l'ensemble de ses fichiers
 	// - la taille de l'ensemble de ses fichiers
+	// Si les buckets sont en mode partitionnement par hashage (cf. KWSortBuckets::BuildHashPartitions),
+	// chaque ligne est envoyee dans le bucket de sa partition, et les chunks ne sont pas ordonnes entre eux
 	boolean BuildSortedChunks(const KWSortBuckets* buckets);
 
 	// Nombre d'erreurs d'encodage detectees
@@ -156,6 +158,9 @@ protected:
 	// Tableau des buckets contenant les specification des chunks
 	PLShared_ObjectArray* shared_oaBuckets;
 
+	// Mode partitionnement par hashage des buckets
+	PLShared_Boolean shared_bHashPartitioned;
+
 	// Taille memoire max pour la gestion memoire des buckets de chaque esclave
 	PLShared_Longint shared_lMaxSlaveBucketMemory;
 
@@ -101,6 +101,7 @@ void Test(int argc, char** argv)
 	// KWSortedChunkBuilderTask::Test();
 	// KWChunkSorterTask::Test();
 	// KWFileSorter::Test();
+	// KWFileHashPartitioner::Test();
 	// RMResourceManager::Test();
 	// PEProtocolTestTask::Test();
 	// KWTestDatabaseTransferTask::STMainTestReadWrite(argc, argv);
@@ -65,6 +65,7 @@
 #include "KWKeySampleExtractorTask.h"
 #include "KWSortedChunkBuilderTask.h"
 #include "KWChunkSorterTask.h"
+#include "KWFileHashPartitioner.h"
 #include "PLSTDatabaseTextFile.h"
 #include "KWTestDatabaseTransfer.h"
 #include "KWKeyPositionSampleExtractorTask.h"
@@ -621,3 +621,33 @@ boolean GetVarPartDeploymentMode()
 	}
 	return bVarPartDeploymentModeMode;
 }
+
+int GetLearningApproximateQuantileBinNumber()
+{
+	static boolean bIsInitialized = false;
+	static int nLearningApproximateQuantileBinNumber = 0;
+	ALString sLearningApproximateQuantileBinNumber;
+
+	// Determination du nombre de bins au premier appel
+	if (not bIsInitialized)
+	{
+		// Recherche de la variable d'environnement
+		sLearningApproximateQuantileBinNumber = p_getenv("KhiopsApproximateQuantileBinNumber");
+
+		// Conversion au mieux en un entier positif
+		if (sLearningApproximateQuantileBinNumber == "")
+			nLearningApproximateQuantileBinNumber = 0;
+		else
+			nLearningApproximateQuantileBinNumber = StringToInt(sLearningApproximateQuantileBinNumber);
+		if (nLearningApproximateQuantileBinNumber < 0)
+			nLearningApproximateQuantileBinNumber = 0;
+
+		// Utilisable uniquement en mode expert
+		if (not GetLearningExpertMode())
+			nLearningApproximateQuantileBinNumber = 0;
+
+		// Memorisation du flag d'initialisation
+		bIsInitialized = true;
+	}
+	return nLearningApproximateQuantileBinNumber;
+}
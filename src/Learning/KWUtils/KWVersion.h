@@ -163,3 +163,10 @@ boolean GetSNBForceDenseMode();
 
 // Indicateur du mode ou le dictionnaire associee au coclustering individus * variables est construit (en fin d'apprentissage du coclustering)
 boolean GetVarPartDeploymentMode();
+
+// Nombre de bins utilise pour la discretisation approximative des variables numeriques (en mode expert uniquement)
+// Si non nul, les valeurs numeriques sont pre-granularisees selon des quantiles approximatifs, calcules par sketch
+// lors de la premiere lecture de la base, et la discretisation MODL est effectuee sur ces bins
+// Ce mode est controlable par la variable d'environnement KhiopsApproximateQuantileBinNumber
+// Renvoie 0 (mode exact) si non specifie ou invalide
+int GetLearningApproximateQuantileBinNumber();
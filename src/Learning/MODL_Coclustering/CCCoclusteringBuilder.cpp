@@ -780,19 +780,11 @@ boolean CCCoclusteringBuilder::CreateStandardInitialDataGrid()
 	TaskProgression::BeginTask();
 	TaskProgression::DisplayMainLabel("Create coclustering optimization data");
 
-	// Lecture des enregistrements de la base
+	// Alimentation d'une base de tuple a partir de la base lue en flux, en tenant compte de l'attribut d'effectif
 	if (bOk and not TaskProgression::IsInterruptionRequested())
 	{
-		TaskProgression::DisplayLabel("Read database");
+		TaskProgression::DisplayLabel("Read database and extract tuples");
 		TaskProgression::DisplayProgression(20);
-		bOk = ReadDatabaseAndCheckRemainingMemory(GetDatabase());
-	}
-
-	// Alimentation d'une base de tuple a partir de la base, en tenant compte de l'attribut d'effectif
-	if (bOk and not TaskProgression::IsInterruptionRequested())
-	{
-		TaskProgression::DisplayLabel("Extract database tuples");
-		TaskProgression::DisplayProgression(30);
 		bOk = FillStandardTupleTableFromDatabase(GetDatabase(), &tupleTable);
 	}
 
@@ -839,36 +831,21 @@ boolean CCCoclusteringBuilder::CreateStandardInitialDataGrid()
 boolean CCCoclusteringBuilder::FillStandardTupleTableFromDatabase(KWDatabase* database, KWTupleTable* tupleTable)
 {
 	boolean bOk = true;
-	longint lAvailableMemory;
-	KWTuple* inputTuple;
+	CCStandardTupleTableFiller tupleTableFiller;
 	int nAttribute;
 	KWAttribute* attribute;
 	KWAttribute* frequencyAttribute;
 	KWLoadIndexVector livLoadIndexes;
-	KWObject* kwoObject;
-	int nObject;
-	int nObjectFrequency;
-	longint lTotalFrequency;
-	int nNewTupleNumberToBuild;
-	longint lEmptyTupleTableUsedMemory;
-	longint lMinTupleNecessaryMemory;
-	longint lAvailableRemainingMemory;
-	longint lRemainingTupleNecessaryMemory;
 	ALString sTmp;
 
 	require(not GetVarPartCoclustering());
 	require(CheckStandardSpecifications());
 	require(database != NULL);
-	require(database->GetObjects()->GetSize() > 0);
+	require(database->GetObjects()->GetSize() == 0);
 	require(tupleTable != NULL);
 	require(not tupleTable->GetUpdateMode());
 	require(tupleTable->GetSize() == 0);
 
-	// Debut de suivi de tache
-	TaskProgression::BeginTask();
-	TaskProgression::DisplayMainLabel("Extract database tuples " + database->GetDatabaseName());
-	lAvailableMemory = RMResourceManager::GetRemainingAvailableMemory();
-
 	// Recherche de l'index de l'attribut d'effectif
 	frequencyAttribute = NULL;
 	if (GetFrequencyAttributeName() != "")
@@ -887,110 +864,16 @@ boolean CCCoclusteringBuilder::FillStandardTupleTableFromDatabase(KWDatabase* da
 		livLoadIndexes.Add(attribute->GetLoadIndex());
 	}
 
-	// Memoire necessaire pour construire les prochain tuples, verifiee periodiquement
-	nNewTupleNumberToBuild = TaskProgression::GetRefreshFrequency();
-	lMinTupleNecessaryMemory = KWTupleTable::ComputeNecessaryMemory(nNewTupleNumberToBuild, GetAttributeNumber()) +
-				   KWTupleTable::ComputeNecessaryBuildingMemory(nNewTupleNumberToBuild) + 16 * lMB;
-
-	// Passage de la table de tuples en mode edition
+	// Lecture de la base en flux, en passant la table de tuples en mode edition le temps de la lecture
+	// La lecture gere le suivi de tache, les interruptions et le controle de la memoire au fil de l'eau
 	tupleTable->SetUpdateMode(true);
-	inputTuple = tupleTable->GetInputTuple();
-	lEmptyTupleTableUsedMemory = tupleTable->GetUsedMemory();
-
-	// Parcours des objets de la base
-	lTotalFrequency = 0;
-	Global::ActivateErrorFlowControl();
-	for (nObject = 0; nObject < database->GetObjects()->GetSize(); nObject++)
-	{
-		kwoObject = cast(KWObject*, database->GetObjects()->GetAt(nObject));
-		assert(kwoObject != NULL);
-
-		// Suivi de la tache au debut pour gerer la memoire de facon preventive
-		if (TaskProgression::IsRefreshNecessary(nObject))
-		{
-			// Arret si pas assez de memoire restante
-			lAvailableRemainingMemory = RMResourceManager::GetRemainingAvailableMemory();
-			if (lAvailableRemainingMemory < lMinTupleNecessaryMemory)
-			{
-				bOk = false;
-
-				// Estimation de la memoire necessaire pour finaliser le remplissage de la table de tuple
-				lRemainingTupleNecessaryMemory =
-				    (longint)((tupleTable->GetUsedMemory() - lEmptyTupleTableUsedMemory) *
-					      (double)(database->GetObjects()->GetSize() - nObject - 1) /
-					      (nObject + 1));
-				lRemainingTupleNecessaryMemory =
-				    max(lRemainingTupleNecessaryMemory, lMinTupleNecessaryMemory);
-
-				// Message d'erreur
-				Object::AddError(
-				    sTmp + "Not enough memory after extracting " +
-				    LongintToReadableString((longint)nObject + 1) + " database tuples out of " +
-				    LongintToReadableString(database->GetObjects()->GetSize()) +
-				    RMResourceManager::BuildMissingMemoryMessage(lRemainingTupleNecessaryMemory));
-				AddSimpleMessage(RMResourceManager::BuildMemoryLimitMessage());
-				break;
-			}
-
-			// Arret si interruption utilisateur
-			if (TaskProgression::IsInterruptionRequested())
-				break;
-
-			// Affichage de la progression
-			TaskProgression::DisplayProgression(
-			    (int)(100.0 * (nObject + 1) / (double)database->GetObjects()->GetSize()));
-			TaskProgression::DisplayLabel(sTmp + IntToString(nObject) + " tuples");
-		}
-
-		// Acces a l'effectif, avec warning eventuel
-		nObjectFrequency = GetDatabaseObjectFrequency(kwoObject, frequencyAttribute);
-		assert(nObjectFrequency >= 0);
-		lTotalFrequency += nObjectFrequency;
-
-		// Erreur si effectif total trop important
-		if (lTotalFrequency > INT_MAX)
-		{
-			Object::AddError(sTmp + "Database tuple extraction interrupted after record " +
-					 LongintToString(kwoObject->GetCreationIndex()) +
-					 " because total frequency is too large (" +
-					 LongintToReadableString(lTotalFrequency) + ")");
-			bOk = false;
-			break;
-		}
-
-		// Prise en compte si effectif non null
-		if (nObjectFrequency > 0)
-		{
-			// Parametrage du tuple d'entree de la table a cree
-			for (nAttribute = 0; nAttribute < livLoadIndexes.GetSize(); nAttribute++)
-			{
-				if (tupleTable->GetAttributeTypeAt(nAttribute) == KWType::Symbol)
-					inputTuple->SetSymbolAt(
-					    nAttribute, kwoObject->GetSymbolValueAt(livLoadIndexes.GetAt(nAttribute)));
-				else
-					inputTuple->SetContinuousAt(nAttribute, kwoObject->GetContinuousValueAt(
-										    livLoadIndexes.GetAt(nAttribute)));
-			}
-
-			// Ajout d'un nouveau tuple apres avoir specifie son effectif
-			assert(nObjectFrequency <= INT_MAX - tupleTable->GetTotalFrequency());
-			inputTuple->SetFrequency(nObjectFrequency);
-			tupleTable->UpdateWithInputTuple();
-		}
-
-		// Liberation de l'objet une fois traite
-		delete kwoObject;
-		database->GetObjects()->SetAt(nObject, NULL);
-	}
-	Global::DesactivateErrorFlowControl();
-
-	// Test final si interruption utilisateur
-	if (TaskProgression::IsInterruptionRequested())
-		bOk = false;
+	tupleTableFiller.Initialize(this, tupleTable, &livLoadIndexes, frequencyAttribute);
+	bOk = database->ReadAllAndProcess(&tupleTableFiller);
 
 	// Message sur l'effectif total
-	if (bOk and GetFrequencyAttributeName() != "" and not TaskProgression::IsInterruptionRequested())
-		database->AddMessage(sTmp + "Total frequency: " + LongintToReadableString(lTotalFrequency));
+	if (bOk and GetFrequencyAttributeName() != "")
+		database->AddMessage(sTmp + "Total frequency: " +
+				     LongintToReadableString(tupleTableFiller.GetTotalFrequency()));
 
 	// Finalisation en repassant la table de tuples en mode consultation
 	tupleTable->SetUpdateMode(false);
@@ -1004,13 +887,7 @@ boolean CCCoclusteringBuilder::FillStandardTupleTableFromDatabase(KWDatabase* da
 		bOk = false;
 	}
 
-	// Nettoyage de la base pour liberer les objets non necessairement traites
-	database->DeleteAll();
-
-	// Fin de suivi de tache
-	TaskProgression::EndTask();
-
-	ensure(GetDatabase()->GetObjects()->GetSize() == 0);
+	ensure(database->GetObjects()->GetSize() == 0);
 	ensure(not tupleTable->GetUpdateMode());
 	ensure(bOk or tupleTable->GetSize() == 0);
 	return bOk;
@@ -1026,6 +903,7 @@ int CCCoclusteringBuilder::GetDatabaseObjectFrequency(const KWObject* kwoObject,
 	require(frequencyAttribute == NULL or frequencyAttribute->GetName() == GetFrequencyAttributeName());
 
 	// Recherche de l'effectif de la cellule, en fonction de l'eventuelle variable d'effectif
+	// Les warnings sont emis pendant la lecture de la base, dont le libelle indique l'enregistrement courant
 	nObjectFrequency = 1;
 	if (frequencyAttribute != NULL)
 	{
@@ -1038,10 +916,9 @@ int CCCoclusteringBuilder::GetDatabaseObjectFrequency(const KWObject* kwoObject,
 		// Enregistrement ignore si effectif trop grand
 		if (cObjectFrequency > INT_MAX)
 		{
-			GetDatabase()->AddWarning(
-			    sTmp + "Ignored record " + LongintToString(kwoObject->GetCreationIndex()) +
-			    ", frequency variable (" + GetFrequencyAttributeName() + ") with value too large (" +
-			    KWContinuous::ContinuousToString(cObjectFrequency) + ")");
+			GetDatabase()->AddWarning(sTmp + "Ignored record, frequency variable (" +
+						  GetFrequencyAttributeName() + ") with value too large (" +
+						  KWContinuous::ContinuousToString(cObjectFrequency) + ")");
 
 			// On met l'effectif a 0 pour ignorer l'enregistrement
 			nObjectFrequency = 0;
@@ -1049,28 +926,24 @@ int CCCoclusteringBuilder::GetDatabaseObjectFrequency(const KWObject* kwoObject,
 		// Enregistrement ignore si effectif negatif ou nul
 		else if (cObjectFrequency <= 0)
 		{
-			GetDatabase()->AddWarning(
-			    sTmp + "Ignored record " + LongintToString(kwoObject->GetCreationIndex()) +
-			    ", frequency variable (" + GetFrequencyAttributeName() + ") with non positive value (" +
-			    KWContinuous::ContinuousToString(cObjectFrequency) + ")");
+			GetDatabase()->AddWarning(sTmp + "Ignored record, frequency variable (" +
+						  GetFrequencyAttributeName() + ") with non positive value (" +
+						  KWContinuous::ContinuousToString(cObjectFrequency) + ")");
 		}
 		// Warning si erreur d'arrondi
 		else if (fabs(cObjectFrequency - nObjectFrequency) > 0.05)
 		{
 			if (nObjectFrequency > 0)
 			{
-				GetDatabase()->AddWarning(
-				    sTmp + "Record " + LongintToString(kwoObject->GetCreationIndex()) +
-				    ", frequency variable (" + GetFrequencyAttributeName() +
-				    ") with non integer value (" + KWContinuous::ContinuousToString(cObjectFrequency) +
-				    " -> " + IntToString(nObjectFrequency) + ")");
+				GetDatabase()->AddWarning(sTmp + "Frequency variable (" + GetFrequencyAttributeName() +
+							  ") with non integer value (" +
+							  KWContinuous::ContinuousToString(cObjectFrequency) + " -> " +
+							  IntToString(nObjectFrequency) + ")");
 			}
 			else
 			{
-				GetDatabase()->AddWarning(sTmp + "Ignored record " +
-							  LongintToString(kwoObject->GetCreationIndex()) +
-							  ", frequency variable (" + GetFrequencyAttributeName() +
-							  ") with null rounded value (" +
+				GetDatabase()->AddWarning(sTmp + "Ignored record, frequency variable (" +
+							  GetFrequencyAttributeName() + ") with null rounded value (" +
 							  KWContinuous::ContinuousToString(cObjectFrequency) + ")");
 			}
 		}
@@ -3837,3 +3710,87 @@ void CCCoclusteringBuilder::SortAttributePartsAndValues(CCHierarchicalDataGrid*
 		}
 	}
 }
+
+//////////////////////////////////////////////////////////////////////////////////
+// Classe CCStandardTupleTableFiller
+
+CCStandardTupleTableFiller::CCStandardTupleTableFiller()
+{
+	coclusteringBuilder = NULL;
+	outputTupleTable = NULL;
+	livAttributeLoadIndexes = NULL;
+	frequencyAttribute = NULL;
+	lTotalFrequency = 0;
+}
+
+CCStandardTupleTableFiller::~CCStandardTupleTableFiller() {}
+
+void CCStandardTupleTableFiller::Initialize(CCCoclusteringBuilder* builder, KWTupleTable* tupleTable,
+					    const KWLoadIndexVector* livLoadIndexes,
+					    const KWAttribute* frequencyAttributeValue)
+{
+	require(builder != NULL);
+	require(tupleTable != NULL);
+	require(tupleTable->GetUpdateMode());
+	require(livLoadIndexes != NULL);
+	require(livLoadIndexes->GetSize() == tupleTable->GetAttributeNumber());
+
+	coclusteringBuilder = builder;
+	outputTupleTable = tupleTable;
+	livAttributeLoadIndexes = livLoadIndexes;
+	frequencyAttribute = frequencyAttributeValue;
+	lTotalFrequency = 0;
+}
+
+boolean CCStandardTupleTableFiller::ProcessObject(KWObject* kwoObject)
+{
+	boolean bOk = true;
+	KWTuple* inputTuple;
+	int nAttribute;
+	KWLoadIndex liLoadIndex;
+	int nObjectFrequency;
+	ALString sTmp;
+
+	require(coclusteringBuilder != NULL);
+	require(outputTupleTable != NULL);
+	require(outputTupleTable->GetUpdateMode());
+	require(kwoObject != NULL);
+
+	// Acces a l'effectif, avec warning eventuel
+	nObjectFrequency = coclusteringBuilder->GetDatabaseObjectFrequency(kwoObject, frequencyAttribute);
+	assert(nObjectFrequency >= 0);
+	lTotalFrequency += nObjectFrequency;
+
+	// Erreur si effectif total trop important
+	if (lTotalFrequency > INT_MAX)
+	{
+		coclusteringBuilder->AddError(sTmp + "Database tuple extraction interrupted after record " +
+					      LongintToString(kwoObject->GetCreationIndex()) +
+					      " because total frequency is too large (" +
+					      LongintToReadableString(lTotalFrequency) + ")");
+		bOk = false;
+	}
+	// Prise en compte si effectif non null
+	else if (nObjectFrequency > 0)
+	{
+		// Parametrage du tuple d'entree de la table a cree
+		inputTuple = outputTupleTable->GetInputTuple();
+		for (nAttribute = 0; nAttribute < livAttributeLoadIndexes->GetSize(); nAttribute++)
+		{
+			liLoadIndex = livAttributeLoadIndexes->GetAt(nAttribute);
+			if (outputTupleTable->GetAttributeTypeAt(nAttribute) == KWType::Symbol)
+				inputTuple->SetSymbolAt(nAttribute, kwoObject->GetSymbolValueAt(liLoadIndex));
+			else
+				inputTuple->SetContinuousAt(nAttribute, kwoObject->GetContinuousValueAt(liLoadIndex));
+		}
+
+		// Ajout d'un nouveau tuple apres avoir specifie son effectif
+		assert(nObjectFrequency <= INT_MAX - outputTupleTable->GetTotalFrequency());
+		inputTuple->SetFrequency(nObjectFrequency);
+		outputTupleTable->UpdateWithInputTuple();
+	}
+
+	// Liberation de l'objet une fois traite
+	delete kwoObject;
+	return bOk;
+}
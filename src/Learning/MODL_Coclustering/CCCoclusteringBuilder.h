@@ -5,6 +5,7 @@
 #pragma once
 
 class CCCoclusteringBuilder;
+class CCStandardTupleTableFiller;
 
 #include "PLDatabaseTextFile.h"
 #include "KWTupleTable.h"
@@ -141,7 +142,8 @@ protected:
 	// - les valeurs manquantes sont gardees et traitees comme les autres valeurs
 	//
 	// Gestion de la memoire
-	// - la premiere etape consiste en la lecture de la base, avec des verifications memoire au fil de l'eau
+	// - la premiere etape consiste en la lecture de la base en flux, avec des verifications memoire au fil de l'eau,
+	//   chaque enregistrement etant directement agrege dans une table de tuples distincts
 	// - les etapes suivante construisent la grille initiale progressivement (attributs, tuples, parties, cellules,
 	//   avec des verification memoire au fil de l'eau
 	//   - ces estimations sont  parfois dans le pire des cas, mais ce n'est pas un probleme etant donne
@@ -156,11 +158,13 @@ protected:
 
 	// Alimentation d'une table de tuples comportant les attributs a analyser a partir de la base
 	// en tenant compte de l'eventuel attribut d'effectif par enregistrement
-	// Les objets de la base doivent etre charges en memoire. Ils sont liberes au fur et a mesure de leur traitement
-	// pour liberer la memoire des que leur contenu est transfere dans un tuple.
+	// La base est lue en flux, sans etre chargee en memoire: chaque objet lu est immediatement transfere
+	// dans la table de tuples puis detruit, ce qui limite la memoire necessaire au nombre de tuples distincts
+	// et permet de traiter des bases plus grandes que la memoire disponible
 	boolean FillStandardTupleTableFromDatabase(KWDatabase* database, KWTupleTable* tupleTable);
 
 	// Renvoie l'effectif associe a un enregistrement, avec eventuellement affichage de warning
+	// Methode appelee pendant la lecture en flux de la base, les warnings etant localises par l'enregistrement courant
 	// Renvoie 1 si l'attribut d'effectif est NULL
 	// Renvoie 0 si erreur dans la specification de l'effectif
 	int GetDatabaseObjectFrequency(const KWObject* kwoObject, const KWAttribute* frequencyAttribute);
@@ -225,9 +229,11 @@ protected:
 	// Apres lecture de la base, chaque etape de construction de la grille initiale (creation des attributs, parties, cellules)
 	// est effectuee avec suivi de tache, controle de la memoire utilisee au fil de l'eau, et gestion des interruptions utilisateurs
 
-	// Lecture de la base de donnees
+	// Lecture de la base de donnees, dans le cas VarPart
 	//
 	// La base est entierement lue avant la construction de la grille initiale.
+	// Dans le cas standard variables x variables, la base est en revanche lue en flux, car la grille initiale
+	// est directement construite a partir de la table des tuples distincts, sans autre passe sur les donnees.
 	// Bien qu'il soit possible de construire la grille au fur et a mesure de la lecture
 	// pour economiser de la memoire, cette approche n'est pas retenue pour les raisons suivantes :
 	// - Estimer la memoire necessaire avant la lecture elle-meme est quasiment impossible
@@ -369,4 +375,47 @@ protected:
 	mutable int nAnyTimeOptimizationIndex;
 	mutable Timer tAnyTimeTimer;
 	mutable double dAnyTimeBestCost;
+
+	// Acces aux services d'extraction des tuples pendant la lecture en flux de la base
+	friend class CCStandardTupleTableFiller;
+};
+
+/////////////////////////////////////////////////////////////////////////////////
+// Alimentation d'une table de tuples en mode mise a jour a partir des objets d'une base lus en flux,
+// dans le cas d'un coclustering de variables
+class CCStandardTupleTableFiller : public KWDatabaseObjectProcessor
+{
+public:
+	// Constructeur
+	CCStandardTupleTableFiller();
+	~CCStandardTupleTableFiller();
+
+	// Initialisation du parametrage, la table de tuples devant etre en mode mise a jour
+	// L'attribut d'effectif peut etre NULL
+	void Initialize(CCCoclusteringBuilder* builder, KWTupleTable* tupleTable,
+			const KWLoadIndexVector* livLoadIndexes, const KWAttribute* frequencyAttribute);
+
+	// Ajout du tuple correspondant a un objet, avec prise en compte de son effectif, puis destruction de l'objet
+	// Renvoie false avec message d'erreur si l'effectif total devient trop important
+	boolean ProcessObject(KWObject* kwoObject) override;
+
+	// Effectif total des objets traites
+	longint GetTotalFrequency() const;
+
+	///////////////////////////////////////////////////////////////////////////////
+	///// Implementation
+protected:
+	CCCoclusteringBuilder* coclusteringBuilder;
+	KWTupleTable* outputTupleTable;
+	const KWLoadIndexVector* livAttributeLoadIndexes;
+	const KWAttribute* frequencyAttribute;
+	longint lTotalFrequency;
 };
+
+////////////////////////////////////////////////////////////////////
+// Methodes en inline
+
+inline longint CCStandardTupleTableFiller::GetTotalFrequency() const
+{
+	return lTotalFrequency;
+}
@@ -1047,6 +1047,7 @@ longint SNBDataTableBinarySliceSetRandomizedAttributeIterator::ComputeNecessaryM
 SNBDataTableBinarySliceSetColumn::SNBDataTableBinarySliceSetColumn()
 {
 	bSparseMode = false;
+	InitializePacking(32, 0);
 }
 
 SNBDataTableBinarySliceSetColumn::~SNBDataTableBinarySliceSetColumn() {}
@@ -1061,9 +1062,96 @@ boolean SNBDataTableBinarySliceSetColumn::GetSparseMode() const
 	return bSparseMode;
 }
 
+void SNBDataTableBinarySliceSetColumn::InitializePacking(int nValue, int nChunkInstanceNumber)
+{
+	require(nValue == 4 or nValue == 8 or nValue == 16 or nValue == 32);
+	require(nChunkInstanceNumber >= 0);
+
+	// Parametrage du stockage des valeurs
+	nValueBitNumber = nValue;
+	nValuePerDataLog2 = 0;
+	while ((nValueBitNumber << nValuePerDataLog2) < 32)
+		nValuePerDataLog2++;
+	if (nValueBitNumber == 32)
+		nValueMask = 0xFFFFFFFF;
+	else
+		nValueMask = (1u << nValueBitNumber) - 1;
+
+	// Parametrage du stockage des valeurs sparse
+	nSparseValueDataSize = ComputeSparseValueDataSize(nValueBitNumber, nChunkInstanceNumber);
+
+	// Reinitialisation des donnees
+	nDenseValueNumber = 0;
+	ivData.SetSize(0);
+}
+
+int SNBDataTableBinarySliceSetColumn::GetValueBitNumber() const
+{
+	return nValueBitNumber;
+}
+
+boolean SNBDataTableBinarySliceSetColumn::SetDenseValueNumber(int nValue)
+{
+	boolean bOk;
+
+	require(not GetSparseMode());
+	require(nValue >= 0);
+
+	// Allocation du stockage, initialise a zero, soit la valeur manquante
+	bOk = ivData.SetLargeSize((int)ComputeDenseDataSize(nValue, nValueBitNumber));
+	if (bOk)
+	{
+		ivData.Initialize();
+		nDenseValueNumber = nValue;
+	}
+	else
+		nDenseValueNumber = 0;
+	return bOk;
+}
+
+void SNBDataTableBinarySliceSetColumn::SetDenseValueAt(int nIndex, int nValue)
+{
+	int nDataIndex;
+	int nSlotIndex;
+
+	require(not GetSparseMode());
+	require(0 <= nIndex and nIndex < GetValueNumber());
+	require(-1 <= nValue and (unsigned int)(nValue + 1) <= nValueMask);
+	require(GetDenseValueAt(nIndex) == -1);
+
+	// Les valeurs sont stockees decalees de 1 pour coder la valeur manquante -1
+	nDataIndex = nIndex >> nValuePerDataLog2;
+	nSlotIndex = nIndex & ((1 << nValuePerDataLog2) - 1);
+	ivData.SetAt(nDataIndex, (int)((unsigned int)ivData.GetAt(nDataIndex) |
+				       ((unsigned int)(nValue + 1) << (nSlotIndex * nValueBitNumber))));
+}
+
+void SNBDataTableBinarySliceSetColumn::AddSparseValue(int nInstanceIndex, int nValue)
+{
+	require(GetSparseMode());
+	require(nInstanceIndex >= 0);
+	require(0 <= nValue and (unsigned int)nValue <= nValueMask);
+	require(GetValueNumber() == 0 or GetSparseValueInstanceIndexAt(GetValueNumber() - 1) < nInstanceIndex);
+
+	if (nSparseValueDataSize == 1)
+		ivData.Add((int)(((unsigned int)nInstanceIndex << nValueBitNumber) | (unsigned int)nValue));
+	else
+	{
+		ivData.Add(nInstanceIndex);
+		ivData.Add(nValue);
+	}
+}
+
 boolean SNBDataTableBinarySliceSetColumn::SetDataSize(int nValue)
 {
-	return ivData.SetLargeSize(nValue);
+	boolean bOk;
+
+	bOk = ivData.SetLargeSize(nValue);
+
+	// En mode dense, le nombre de valeurs ne peut etre deduit de la taille des donnees: il est
+	// reinitialise et doit etre specifie avec SetDenseValueNumber
+	nDenseValueNumber = 0;
+	return bOk;
 }
 
 int SNBDataTableBinarySliceSetColumn::GetDataSize() const
@@ -1081,41 +1169,88 @@ int SNBDataTableBinarySliceSetColumn::GetDataAt(int nIndex) const
 	return ivData.GetAt(nIndex);
 }
 
-void SNBDataTableBinarySliceSetColumn::AddData(int nValue)
+int SNBDataTableBinarySliceSetColumn::ComputeValueBitNumber(int nPartNumber)
+{
+	int nValueBitNumber;
+
+	// On prevoit une valeur supplementaire pour la valeur manquante
+	// On utilise le stockage standard si le nombre de parties n'est pas connu
+	if (nPartNumber <= 0)
+		nValueBitNumber = 32;
+	else if (nPartNumber < 16)
+		nValueBitNumber = 4;
+	else if (nPartNumber < 256)
+		nValueBitNumber = 8;
+	else if (nPartNumber < 65536)
+		nValueBitNumber = 16;
+	else
+		nValueBitNumber = 32;
+	return nValueBitNumber;
+}
+
+longint SNBDataTableBinarySliceSetColumn::ComputeDenseDataSize(longint lValueNumber, int nValueBitNumber)
 {
-	ivData.Add(nValue);
+	require(lValueNumber >= 0);
+	require(nValueBitNumber == 4 or nValueBitNumber == 8 or nValueBitNumber == 16 or nValueBitNumber == 32);
+	return (lValueNumber * nValueBitNumber + 31) / 32;
+}
+
+int SNBDataTableBinarySliceSetColumn::ComputeSparseValueDataSize(int nValueBitNumber, int nChunkInstanceNumber)
+{
+	int nInstanceBitNumber;
+
+	require(nValueBitNumber == 4 or nValueBitNumber == 8 or nValueBitNumber == 16 or nValueBitNumber == 32);
+	require(nChunkInstanceNumber >= 0);
+
+	// Nombre de bits necessaires pour coder les index d'instance du chunk
+	nInstanceBitNumber = 1;
+	while (nInstanceBitNumber < 31 and (1 << nInstanceBitNumber) < nChunkInstanceNumber)
+		nInstanceBitNumber++;
+
+	// Une valeur sparse tient dans un seul `int` si l'index d'instance et la valeur y tiennent ensemble
+	if (nInstanceBitNumber + nValueBitNumber <= 32)
+		return 1;
+	else
+		return 2;
 }
 
 boolean SNBDataTableBinarySliceSetColumn::Check() const
 {
 	boolean bOk = true;
-	int nData;
+	int nValue;
 	int nPreviousInstanceIndex;
 
-	// En sparse il doit avoir une quantite pair de donnees
-	bOk = bOk and (not bSparseMode or ivData.GetSize() % 2 == 0);
+	// Verification du parametrage du stockage
+	bOk = bOk and (nValueBitNumber << nValuePerDataLog2) == 32;
+	bOk = bOk and (nSparseValueDataSize == 1 or nSparseValueDataSize == 2);
+
+	// Verification de la taille des donnees
+	if (bSparseMode)
+		bOk = bOk and ivData.GetSize() % nSparseValueDataSize == 0;
+	else
+		bOk = bOk and ivData.GetSize() == ComputeDenseDataSize(nDenseValueNumber, nValueBitNumber);
 
 	// Verification des rangs des donnees
-	for (nData = 0; nData < ivData.GetSize(); nData++)
+	for (nValue = 0; bOk and nValue < GetValueNumber(); nValue++)
 	{
 		// Cas sparse : toutes les valeurs sont non-negatifs
 		if (bSparseMode)
-			bOk = bOk and ivData.GetAt(nData) >= 0;
+			bOk = bOk and GetSparseValueAt(nValue) >= 0;
 		// Cas dense : toutes les valeurs sont non-negatifs ou -1 (manquantes)
 		else
-			bOk = bOk and ivData.GetAt(nData) >= -1;
+			bOk = bOk and GetDenseValueAt(nValue) >= -1;
 	}
 
 	// Cas sparse: Verification que les indexes d'instance sont croissantes
-	if (bSparseMode and ivData.GetSize() > 0)
+	if (bOk and bSparseMode and GetValueNumber() > 0)
 	{
-		nPreviousInstanceIndex = ivData.GetAt(0);
-		for (nData = 2; nData < ivData.GetSize(); nData += 2)
+		nPreviousInstanceIndex = GetSparseValueInstanceIndexAt(0);
+		for (nValue = 1; nValue < GetValueNumber(); nValue++)
 		{
-			bOk = bOk and nPreviousInstanceIndex < ivData.GetAt(nData);
+			bOk = bOk and nPreviousInstanceIndex < GetSparseValueInstanceIndexAt(nValue);
 			if (not bOk)
 				break;
-			nPreviousInstanceIndex = ivData.GetAt(nData);
+			nPreviousInstanceIndex = GetSparseValueInstanceIndexAt(nValue);
 		}
 	}
 	return bOk;
@@ -1169,6 +1304,13 @@ void SNBDataTableBinarySliceSetChunkPhysicalLayout::PartiallyInitialize(
 	for (nAttribute = 0; nAttribute < schema->GetAttributeNumber(); nAttribute++)
 		ivAttributeSparseModes.SetAt(nAttribute, schema->GetAttributeAt(nAttribute)->GetSparseMode());
 
+	// Initialization des nombres de bits par valeur des attributs, selon leur nombre de parties
+	ivAttributeValueBitNumbers.SetSize(schema->GetAttributeNumber());
+	for (nAttribute = 0; nAttribute < schema->GetAttributeNumber(); nAttribute++)
+		ivAttributeValueBitNumbers.SetAt(
+		    nAttribute, SNBDataTableBinarySliceSetColumn::ComputeValueBitNumber(
+				    schema->GetAttributeAt(nAttribute)->GetSourceModalityNumber()));
+
 	ensure(IsPartiallyInitialized());
 }
 
@@ -1245,6 +1387,13 @@ boolean SNBDataTableBinarySliceSetChunkPhysicalLayout::GetAttributeSparseModeAt(
 	return ivAttributeSparseModes.GetAt(nAttribute);
 }
 
+int SNBDataTableBinarySliceSetChunkPhysicalLayout::GetAttributeValueBitNumberAt(int nAttribute) const
+{
+	require(IsPartiallyInitialized());
+	require(0 <= nAttribute and nAttribute < layout->GetAttributeNumber());
+	return ivAttributeValueBitNumbers.GetAt(nAttribute);
+}
+
 double SNBDataTableBinarySliceSetChunkPhysicalLayout::GetSparsityRate() const
 {
 	longint lChunkValueNumber;
@@ -1252,14 +1401,17 @@ double SNBDataTableBinarySliceSetChunkPhysicalLayout::GetSparsityRate() const
 
 	require(IsInitialized());
 
-	// On calcule le nombre total des `int`s stockes
+	// On calcule le nombre total des valeurs stockees
 	lChunkValueNumber = 0;
 	for (nAttribute = 0; nAttribute < layout->GetAttributeNumber(); nAttribute++)
 	{
 		if (GetAttributeSparseModeAt(nAttribute))
-			lChunkValueNumber += GetAttributeDataSizeAt(nAttribute) / 2;
+			lChunkValueNumber += GetAttributeDataSizeAt(nAttribute) /
+					     SNBDataTableBinarySliceSetColumn::ComputeSparseValueDataSize(
+						 GetAttributeValueBitNumberAt(nAttribute),
+						 layout->GetInstanceNumberAtChunk(GetChunkIndex()));
 		else
-			lChunkValueNumber += GetAttributeDataSizeAt(nAttribute);
+			lChunkValueNumber += layout->GetInstanceNumberAtChunk(GetChunkIndex());
 	}
 
 	return lChunkValueNumber /
@@ -1377,6 +1529,7 @@ boolean SNBDataTableBinarySliceSetChunkPhysicalLayout::Check() const
 		bOk = bOk and (lvBlockSizes.GetSize() == layout->GetSliceNumber());
 		bOk = bOk and (lvBlockOffsets.GetSize() == layout->GetSliceNumber());
 		bOk = bOk and (ivAttributeDataSizes.GetSize() == layout->GetAttributeNumber());
+		bOk = bOk and (ivAttributeValueBitNumbers.GetSize() == layout->GetAttributeNumber());
 	}
 
 	// Verifications d'integrite lors d'une instance intialisee
@@ -1663,18 +1816,17 @@ boolean SNBDataTableBinarySliceSetChunkBuffer::InitializeBlockFromSliceSetAt(
 		nAttribute = nSliceAttributeOffset + nSliceAttribute;
 		column = cast(SNBDataTableBinarySliceSetColumn*, oaLoadedBlock.GetAt(nSliceAttribute));
 		column->SetSparseMode(schema->GetAttributeAt(nAttribute)->GetSparseMode());
-		if (column->GetSparseMode())
-			column->SetDataSize(0);
-		else
+		column->InitializePacking(physicalLayout.GetAttributeValueBitNumberAt(nAttribute),
+					  nChunkInstanceNumber);
+		if (not column->GetSparseMode())
 		{
-			physicalLayout.SetAttributeDataSizeAt(nAttribute,
-							      layout->GetInstanceNumberAtChunk(nChunkIndex));
-			bOk = bOk and column->SetDataSize(layout->GetInstanceNumberAtChunk(nChunkIndex));
+			bOk = bOk and column->SetDenseValueNumber(nChunkInstanceNumber);
 			if (not bOk)
 			{
 				AddError("Could not allocate block vector for column data");
 				break;
 			}
+			physicalLayout.SetAttributeDataSizeAt(nAttribute, column->GetDataSize());
 		}
 		if (bOk)
 			oaLoadedBlock.SetAt(nSliceAttribute, column);
@@ -1716,7 +1868,7 @@ boolean SNBDataTableBinarySliceSetChunkBuffer::InitializeBlockFromSliceSetAt(
 				}
 
 				// Ajout a la colonne
-				column->SetDataAt(nChunkInstance, nAttributeValueIndex);
+				column->SetDenseValueAt(nChunkInstance, nAttributeValueIndex);
 			}
 
 			// Transposition des donnees issus des bloc sparse de l'objet courant dans les colonnes du bloc
@@ -1756,10 +1908,9 @@ boolean SNBDataTableBinarySliceSetChunkBuffer::InitializeBlockFromSliceSetAt(
 					// Ajustement de l'index a zero et ajout a la colonne
 					nAttributeValueIndex =
 					    lrint(attributeValueIndexBlock->GetValueAt(nSparseValue)) - 1;
-					column->AddData(nChunkInstance);
-					column->AddData(nAttributeValueIndex);
-					lLoadedSparseValueNumber++;
 					assert(nAttributeValueIndex >= 0);
+					column->AddSparseValue(nChunkInstance, nAttributeValueIndex);
+					lLoadedSparseValueNumber++;
 
 					// S'il y a un overflow de memoire on passe a l'etat "overflow".
 					// On continue a lire le slice set pour estimer la memoire necessaire mais
@@ -2073,8 +2224,16 @@ boolean SNBDataTableBinarySliceSetChunkBuffer::LoadBlockAt(int nSlice)
 			column = cast(SNBDataTableBinarySliceSetColumn*,
 				      oaLoadedBlock.GetAt(layout->GetRelativeIndexAtAttribute(nAttribute)));
 			column->SetSparseMode(physicalLayout.GetAttributeSparseModeAt(nAttribute));
-			column->SetDataSize(physicalLayout.GetAttributeDataSizeAt(nAttribute));
-			bOk = column->SetDataSize(physicalLayout.GetAttributeDataSizeAt(nAttribute));
+			column->InitializePacking(physicalLayout.GetAttributeValueBitNumberAt(nAttribute),
+						  layout->GetInstanceNumberAtChunk(nChunkIndex));
+			if (column->GetSparseMode())
+				bOk = column->SetDataSize(physicalLayout.GetAttributeDataSizeAt(nAttribute));
+			else
+			{
+				bOk = column->SetDenseValueNumber(layout->GetInstanceNumberAtChunk(nChunkIndex));
+				assert(not bOk or
+				       column->GetDataSize() == physicalLayout.GetAttributeDataSizeAt(nAttribute));
+			}
 			if (not bOk)
 				break;
 		}
@@ -2186,7 +2345,7 @@ boolean SNBDataTableBinarySliceSetChunkBuffer::Check() const
 		{
 			column = cast(SNBDataTableBinarySliceSetColumn*, oaLoadedBlock.GetAt(nAttribute));
 			if (not column->GetSparseMode())
-				bOk = bOk and column->GetDataSize() == layout->GetInstanceNumberAtChunk(nChunkIndex);
+				bOk = bOk and column->GetValueNumber() == layout->GetInstanceNumberAtChunk(nChunkIndex);
 			bOk = bOk and column->Check();
 		}
 	}
@@ -2248,7 +2407,8 @@ const ALString SNBDataTableBinarySliceSetChunkBuffer::GetClassLabel() const
 
 longint SNBDataTableBinarySliceSetChunkBuffer::ComputeNecessaryMemory(
     int nInstanceNumber, int nChunkNumber, const IntVector* ivSparseMissingValueNumberPerAttribute,
-    int nDenseAttributeNumber, int nSliceNumber, double dSparseChunkMemoryFactor, boolean bDisk)
+    int nDenseAttributeNumber, int nMaxSourcePartNumber, int nSliceNumber, double dSparseChunkMemoryFactor,
+    boolean bDisk)
 {
 	int nAttributeNumber;
 	int nMaxSliceAttributeNumber;
@@ -2261,6 +2421,7 @@ longint SNBDataTableBinarySliceSetChunkBuffer::ComputeNecessaryMemory(
 	int nSliceAttributeNumber;
 	longint lSliceSparseValueNumber;
 	int nSliceAttribute;
+	int nValueBitNumber;
 	ObjectArray oaDummy;
 
 	require(0 < nChunkNumber and nChunkNumber <= nInstanceNumber);
@@ -2300,11 +2461,17 @@ longint SNBDataTableBinarySliceSetChunkBuffer::ComputeNecessaryMemory(
 	// Sur-estimee dans le cas d'un seul chunk (il n'y pas besoin de slack dans ce cas la)
 	dSlackFactor = 1 + dSparseChunkMemoryFactor;
 
-	// Memoire necessaire pour la matrice des index de recodage
+	// Memoire necessaire pour la matrice des index de recodage, stockes de facon compacte dans les colonnes
+	// en utilisant le nombre de bits par valeur de l'attribut ayant le plus de parties
+	nValueBitNumber = SNBDataTableBinarySliceSetColumn::ComputeValueBitNumber(nMaxSourcePartNumber);
 	lSlackedGlobalSliceSparseValueNumber = longint(lMaxSliceSparseValueNumber * dSlackFactor);
 	lSlackedGlobalSliceSparseValueNumber += nInstanceNumber / nChunkNumber;
 	lIndexMatrixNecessaryMemory =
-	    (longint(nDenseAttributeNumber) * nInstanceNumber / nSliceNumber + lSlackedGlobalSliceSparseValueNumber) *
+	    (longint(nDenseAttributeNumber) *
+		 SNBDataTableBinarySliceSetColumn::ComputeDenseDataSize(nInstanceNumber, nValueBitNumber) /
+		 nSliceNumber +
+	     lSlackedGlobalSliceSparseValueNumber *
+		 SNBDataTableBinarySliceSetColumn::ComputeSparseValueDataSize(nValueBitNumber, nInstanceNumber)) *
 	    sizeof(int);
 
 	// Comme les vecteur de tres grande taille remplissent tres bien les segments de memoire de
@@ -189,6 +189,9 @@ public:
 	// Calcul de Ln(P( X = x | Y = y )); modalites specifiees par des indexes de parties
 	Continuous GetLnSourceConditionalProb(int nSourceModality, int nTargetModality) const;
 
+	// Nombre de modalites (parties) source de l'attribut
+	int GetSourceModalityNumber() const;
+
 	// DataGridStats issu de la preparation de donnees
 	const KWDataGridStats* GetPreparedDataGridStats() const;
 
@@ -395,7 +398,10 @@ protected:
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////
 // Colonne pour la lecture de donnees d'un attribut d'un SNBDataTableBinarySliceSet
-//
+// Les index de parties sont stockes de facon compacte, sur 4, 8, 16 ou 32 bits selon le nombre de
+// parties de l'attribut prepare, plusieurs valeurs etant regroupees dans un meme `int` de stockage.
+// En mode sparse, l'index d'instance et l'index de partie d'une valeur sont regroupes dans un seul `int`
+// s'ils tiennent ensemble sur 32 bits, et stockes dans deux `int`s sinon.
 class SNBDataTableBinarySliceSetColumn : public Object
 {
 public:
@@ -407,6 +413,12 @@ public:
 	void SetSparseMode(boolean bValue);
 	boolean GetSparseMode() const;
 
+	// Parametrage du stockage compact: nombre de bits par valeur (4, 8, 16 ou 32) et nombre d'instances
+	// du chunk (utilise pour le stockage des index d'instance en mode sparse)
+	// Doit etre appele apres SetSparseMode, et reinitialise les donnees
+	void InitializePacking(int nValueBitNumber, int nChunkInstanceNumber);
+	int GetValueBitNumber() const;
+
 	/////////////////////////////////////////////////////////////////////////////
 	// API d'acces aux donnes (read-only)
 
@@ -422,6 +434,18 @@ public:
 	// Acces a l'index d'instance d'une valeur sparse
 	int GetSparseValueInstanceIndexAt(int nValueIndex) const;
 
+	/////////////////////////////////////////////////////////////////////////////
+	// API d'ecriture des donnees
+
+	// Nombre de valeurs en mode dense: alloue le stockage, avec des valeurs manquantes (-1)
+	boolean SetDenseValueNumber(int nValue);
+
+	// Modification d'une valeur en mode dense; ne doit etre appele qu'une seule fois par valeur
+	void SetDenseValueAt(int nIndex, int nValue);
+
+	// Ajout d'une valeur en mode sparse, par index d'instance croissant
+	void AddSparseValue(int nInstanceIndex, int nValue);
+
 	////////////////////////////////////////////////////////////////////
 	// API de bas niveau independante du type stocke (read-write)
 
@@ -433,11 +457,20 @@ public:
 	void SetDataAt(int nIndex, int nValue);
 	int GetDataAt(int nIndex) const;
 
-	// Ajout a la fin du tableau de donnees
-	void AddData(int nValue);
-
 	//////////////////////////////////////
 	// Services Divers
+
+	// Nombre de bits necessaires pour stocker les index d'un attribut ayant un nombre de parties donne
+	// (en plus de la valeur manquante -1 du mode dense)
+	static int ComputeValueBitNumber(int nPartNumber);
+
+	// Nombre de `int`s de stockage pour des valeurs denses
+	static longint ComputeDenseDataSize(longint lValueNumber, int nValueBitNumber);
+
+	// Nombre de `int`s de stockage par valeur sparse (1 ou 2)
+	static int ComputeSparseValueDataSize(int nValueBitNumber, int nChunkInstanceNumber);
+
+	// Verification d'integrite
 	boolean Check() const override;
 
 	///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -446,6 +479,21 @@ protected:
 	// True si les donnees sont stockes en mode sparse
 	boolean bSparseMode;
 
+	// Nombre de bits par valeur
+	int nValueBitNumber;
+
+	// Logarithme en base 2 du nombre de valeurs denses par `int` de stockage
+	int nValuePerDataLog2;
+
+	// Masque d'extraction d'une valeur
+	unsigned int nValueMask;
+
+	// Nombre de valeurs en mode dense
+	int nDenseValueNumber;
+
+	// Nombre de `int`s par valeur en mode sparse
+	int nSparseValueDataSize;
+
 	// Tableau des donnees de l'attribut
 	IntVector ivData;
 };
@@ -502,6 +550,9 @@ public:
 	void SetAttributeSparseModeAt(int nAttribute, boolean bValue);
 	boolean GetAttributeSparseModeAt(int nAttribute) const;
 
+	// Nombre de bits par valeur de l'attribut dans le stockage compact des colonnes
+	int GetAttributeValueBitNumberAt(int nAttribute) const;
+
 	// Taux d'sparsite
 	double GetSparsityRate() const;
 
@@ -540,6 +591,9 @@ protected:
 
 	// Mode de sparsite des attributes
 	IntVector ivAttributeSparseModes;
+
+	// Nombre de bits par valeur des attributs
+	IntVector ivAttributeValueBitNumbers;
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -601,9 +655,11 @@ public:
 
 	// Estimation de l'empreinte memoire
 	// Selon le parametre bDisk, l'empreinte est estimee pour l'empreinte sur disque ou en RAM
+	// Le nombre maximal de parties source des attributs permet d'estimer la taille du stockage compact
+	// des colonnes (0 si inconnu)
 	static longint ComputeNecessaryMemory(int nInstanceNumber, int nChunkNumber,
 					      const IntVector* ivSparseMissingValueNumberPerAttribute,
-					      int nDenseAttributeNumber, int nSliceNumber,
+					      int nDenseAttributeNumber, int nMaxSourcePartNumber, int nSliceNumber,
 					      double dSparseChunkMemoryFactor, boolean bDisk);
 
 	///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -868,6 +924,11 @@ inline Continuous SNBDataTableBinarySliceSetAttribute::GetLnSourceConditionalPro
 	return conditionalProbas.GetSourceConditionalLogProbAt(nSourceModalityIndex, nTargetModalityIndex);
 }
 
+inline int SNBDataTableBinarySliceSetAttribute::GetSourceModalityNumber() const
+{
+	return conditionalProbas.GetSourceSize();
+}
+
 inline boolean SNBDataTableBinarySliceSet::GetAttributeColumnView(const SNBDataTableBinarySliceSetAttribute* attribute,
 								  SNBDataTableBinarySliceSetColumn*& outputColumn)
 {
@@ -879,32 +940,47 @@ inline int SNBDataTableBinarySliceSetColumn::GetValueNumber() const
 	int nValueNumber;
 
 	if (GetSparseMode())
-		nValueNumber = GetDataSize() / 2;
+		nValueNumber = GetDataSize() / nSparseValueDataSize;
 	else
-		nValueNumber = GetDataSize();
+		nValueNumber = nDenseValueNumber;
 
 	return nValueNumber;
 }
 
 inline int SNBDataTableBinarySliceSetColumn::GetDenseValueAt(int nIndex) const
 {
+	int nSlotIndex;
+
 	require(not GetSparseMode());
 	require(0 <= nIndex and nIndex < GetValueNumber());
-	return ivData.GetAt(nIndex);
+
+	// Les valeurs sont stockees decalees de 1 pour coder la valeur manquante -1
+	nSlotIndex = nIndex & ((1 << nValuePerDataLog2) - 1);
+	return (int)(((unsigned int)ivData.GetAt(nIndex >> nValuePerDataLog2) >> (nSlotIndex * nValueBitNumber)) &
+		     nValueMask) -
+	       1;
 }
 
 inline int SNBDataTableBinarySliceSetColumn::GetSparseValueAt(int nValueIndex) const
 {
 	require(GetSparseMode());
 	require(0 <= nValueIndex and nValueIndex < GetValueNumber());
-	return ivData.GetAt(2 * nValueIndex + 1);
+
+	if (nSparseValueDataSize == 1)
+		return (int)((unsigned int)ivData.GetAt(nValueIndex) & nValueMask);
+	else
+		return ivData.GetAt(2 * nValueIndex + 1);
 }
 
 inline int SNBDataTableBinarySliceSetColumn::GetSparseValueInstanceIndexAt(int nValueIndex) const
 {
 	require(GetSparseMode());
 	require(0 <= nValueIndex and nValueIndex < GetValueNumber());
-	return ivData.GetAt(2 * nValueIndex);
+
+	if (nSparseValueDataSize == 1)
+		return (int)((unsigned int)ivData.GetAt(nValueIndex) >> nValueBitNumber);
+	else
+		return ivData.GetAt(2 * nValueIndex);
 }
 
 inline int SNBDataTableBinarySliceSet::GetInitializedChunkInstanceNumber() const
@@ -265,6 +265,125 @@ boolean SNBPredictorSelectionDataCostCalculator::IsUndoAllowed()
 	return lastModificationAttribute != NULL;
 }
 
+void SNBPredictorSelectionDataCostCalculator::UpdateTargetPartScoresWithColumn(
+    SNBTargetPart* targetPart, const SNBDataTableBinarySliceSetColumn* chunkColumn,
+    const SNBDataTableBinarySliceSetAttribute* attribute, int nAttributeTargetPart, Continuous cDeltaWeight)
+{
+	ContinuousVector* cvScores;
+	int nSourceModality;
+	int nColumnValueNumber;
+	int nColumnValueIndex;
+	int nChunkInstance;
+
+	require(targetPart != NULL);
+	require(chunkColumn != NULL);
+	require(attribute != NULL);
+
+	// Precalcul des increments de score pour chaque modalite source de l'attribut
+	cvWorkingWeightedLnProbs.SetSize(attribute->GetSourceModalityNumber());
+	for (nSourceModality = 0; nSourceModality < cvWorkingWeightedLnProbs.GetSize(); nSourceModality++)
+		cvWorkingWeightedLnProbs.SetAt(nSourceModality,
+					       cDeltaWeight * attribute->GetLnSourceConditionalProb(
+								  nSourceModality, nAttributeTargetPart));
+
+	// Mise a jour des scores de la partie cible seulement pour les valeurs presentes de la colonne sparse
+	cvScores = targetPart->GetScores();
+	nColumnValueNumber = chunkColumn->GetValueNumber();
+	if (chunkColumn->GetSparseMode())
+	{
+		for (nColumnValueIndex = 0; nColumnValueIndex < nColumnValueNumber; nColumnValueIndex++)
+		{
+			nChunkInstance = chunkColumn->GetSparseValueInstanceIndexAt(nColumnValueIndex);
+			cvScores->UpgradeAt(nChunkInstance, cvWorkingWeightedLnProbs.GetAt(
+								chunkColumn->GetSparseValueAt(nColumnValueIndex)));
+		}
+	}
+	// Mise a jour des scores de la partie cible pour toutes les valeurs d'une colonne dense
+	else
+	{
+		for (nChunkInstance = 0; nChunkInstance < nColumnValueNumber; nChunkInstance++)
+			cvScores->UpgradeAt(nChunkInstance,
+					    cvWorkingWeightedLnProbs.GetAt(chunkColumn->GetDenseValueAt(nChunkInstance)));
+	}
+}
+
+void SNBPredictorSelectionDataCostCalculator::ComputeAllInstanceNonNormalizedDataCosts()
+{
+	Continuous cActualScores[nInstanceBlockSize];
+	Continuous cScores[nInstanceBlockSize];
+	double dInstanceInverseProbs[nInstanceBlockSize];
+	int nChunkInstanceNumber;
+	int nFirstChunkInstance;
+	int nBlockInstanceNumber;
+	int nTargetPartNumber;
+	int nTargetPart;
+	SNBTargetPart* targetPart;
+	const ContinuousVector* cvScores;
+	double dTargetPartWeight;
+	Continuous cDeltaScore;
+	double dInstanceLaplaceNumerator;
+	double dInstanceNonNormalizedDataCost;
+	int i;
+
+	dSelectionDataCost = 0.0;
+	nChunkInstanceNumber = GetDataTableBinarySliceSet()->GetInitializedChunkInstanceNumber();
+	nTargetPartNumber = oaTargetParts.GetSize();
+	for (nFirstChunkInstance = 0; nFirstChunkInstance < nChunkInstanceNumber;
+	     nFirstChunkInstance += nInstanceBlockSize)
+	{
+		nBlockInstanceNumber = min((int)nInstanceBlockSize, nChunkInstanceNumber - nFirstChunkInstance);
+
+		// Score de la partie cible reelle de chaque instance du bloc
+		for (i = 0; i < nBlockInstanceNumber; i++)
+		{
+			cActualScores[i] =
+			    GetActualTargetPartAt(nFirstChunkInstance + i)->GetScores()->GetAt(nFirstChunkInstance + i);
+			dInstanceInverseProbs[i] = 0.0;
+		}
+
+		// Accumulation des contributions de chaque partie cible (voir formule (1))
+		// Pour la partie cible reelle, la difference de score est nulle et sa contribution, egale
+		// a son poids, est obtenue sans cas particulier
+		for (nTargetPart = 0; nTargetPart < nTargetPartNumber; nTargetPart++)
+		{
+			targetPart = cast(SNBTargetPart*, oaTargetParts.GetAt(nTargetPart));
+			dTargetPartWeight = GetTargetPartWeight(targetPart);
+
+			// Recopie des scores du bloc dans un tableau contigu
+			cvScores = targetPart->GetScores();
+			for (i = 0; i < nBlockInstanceNumber; i++)
+				cScores[i] = cvScores->GetAt(nFirstChunkInstance + i);
+
+			// Prise en compte de l'exponentielle, en tenant compte du seuil de validite
+			for (i = 0; i < nBlockInstanceNumber; i++)
+			{
+				cDeltaScore = cScores[i] - cActualScores[i];
+				dInstanceInverseProbs[i] +=
+				    dTargetPartWeight * (cDeltaScore >= cMaxScore ? dMaxExpScore : exp(cDeltaScore));
+			}
+		}
+
+		// Calcul des couts des instances du bloc, avec le numerateur de Laplace
+		for (i = 0; i < nBlockInstanceNumber; i++)
+		{
+			assert(dInstanceInverseProbs[i] >= 1);
+			dInstanceInverseProbs[i] /= GetInstanceInverseProbDivisor(nFirstChunkInstance + i);
+			assert(dInstanceInverseProbs[i] >= 1);
+			dInstanceLaplaceNumerator = dInstanceNumber / dInstanceInverseProbs[i] + dLaplaceEpsilon;
+			assert(0 < dInstanceLaplaceNumerator and dInstanceLaplaceNumerator < dLaplaceDenominator);
+			dInstanceNonNormalizedDataCost = -log(dInstanceLaplaceNumerator);
+			dSelectionDataCost += dInstanceNonNormalizedDataCost;
+			dvInstanceNonNormalizedDataCosts.SetAt(nFirstChunkInstance + i, dInstanceNonNormalizedDataCost);
+		}
+	}
+	dSelectionDataCost += nChunkInstanceNumber * log(dLaplaceDenominator);
+}
+
+double SNBPredictorSelectionDataCostCalculator::GetInstanceInverseProbDivisor(int nChunkInstance) const
+{
+	return 1.0;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////
 // Classe SNBSingletonTargetPart
 
@@ -383,8 +502,6 @@ void SNBClassifierSelectionDataCostCalculator::InitializeTargetPartition()
 void SNBClassifierSelectionDataCostCalculator::InitializeDataCostState()
 {
 	int nTargetValueNumber;
-	int nChunkInstance;
-	double dInstanceNonNormalizedDataCost;
 
 	// Calcul d'un epsilon de Laplace pour la gestion des petites probabilites
 	// En effet, cette normalisation est faite en univarie, mais le probleme peut
@@ -408,16 +525,7 @@ void SNBClassifierSelectionDataCostCalculator::InitializeDataCostState()
 	cMaxScore = (Continuous)log(dMaxExpScore);
 
 	// Calcul du couts de la selection vide
-	dSelectionDataCost = 0.0;
-	for (nChunkInstance = 0; nChunkInstance < GetDataTableBinarySliceSet()->GetInitializedChunkInstanceNumber();
-	     nChunkInstance++)
-	{
-		dInstanceNonNormalizedDataCost = ComputeInstanceNonNormalizedDataCost(nChunkInstance);
-		dvInstanceNonNormalizedDataCosts.SetAt(nChunkInstance, dInstanceNonNormalizedDataCost);
-		dSelectionDataCost += dInstanceNonNormalizedDataCost;
-	}
-	dSelectionDataCost +=
-	    GetDataTableBinarySliceSet()->GetInitializedChunkInstanceNumber() * log(dLaplaceDenominator);
+	ComputeAllInstanceNonNormalizedDataCosts();
 
 	// Initialisation des variables pour defaire une modification
 	lastModificationAttribute = NULL;
@@ -453,12 +561,6 @@ boolean SNBClassifierSelectionDataCostCalculator::UpdateTargetPartScoresWithWeig
 	boolean bOk = true;
 	SNBDataTableBinarySliceSetColumn* chunkColumn;
 	int nTargetPart;
-	SNBTargetPart* targetPart;
-	int nColumnValueNumber;
-	int nColumnValueIndex;
-	int nChunkInstance;
-	int nChunkInstanceValue;
-	Continuous cLogProb;
 
 	// Acces a la colonne de donnees de l'attribut
 	chunkColumn = NULL;
@@ -468,35 +570,8 @@ boolean SNBClassifierSelectionDataCostCalculator::UpdateTargetPartScoresWithWeig
 	if (bOk)
 	{
 		for (nTargetPart = 0; nTargetPart < oaTargetParts.GetSize(); nTargetPart++)
-		{
-			targetPart = cast(SNBTargetPart*, oaTargetParts.GetAt(nTargetPart));
-
-			// Mise a jour des scores de la partie cible courante seulement pour les valeurs presentes de la colonne sparse
-			if (chunkColumn->GetSparseMode())
-			{
-				nColumnValueNumber = chunkColumn->GetValueNumber();
-				for (nColumnValueIndex = 0; nColumnValueIndex < nColumnValueNumber; nColumnValueIndex++)
-				{
-					nChunkInstance = chunkColumn->GetSparseValueInstanceIndexAt(nColumnValueIndex);
-					nChunkInstanceValue = chunkColumn->GetSparseValueAt(nColumnValueIndex);
-					cLogProb =
-					    attribute->GetLnSourceConditionalProb(nChunkInstanceValue, nTargetPart);
-					targetPart->GetScores()->UpgradeAt(nChunkInstance, cDeltaWeight * cLogProb);
-				}
-			}
-			// Mise a jour des scores de la partie cible courante seulement pour les valeurs denses
-			else
-			{
-				nColumnValueNumber = chunkColumn->GetValueNumber();
-				for (nChunkInstance = 0; nChunkInstance < nColumnValueNumber; nChunkInstance++)
-				{
-					nChunkInstanceValue = chunkColumn->GetDenseValueAt(nChunkInstance);
-					cLogProb =
-					    attribute->GetLnSourceConditionalProb(nChunkInstanceValue, nTargetPart);
-					targetPart->GetScores()->UpgradeAt(nChunkInstance, cDeltaWeight * cLogProb);
-				}
-			}
-		}
+			UpdateTargetPartScoresWithColumn(cast(SNBTargetPart*, oaTargetParts.GetAt(nTargetPart)),
+							 chunkColumn, attribute, nTargetPart, cDeltaWeight);
 	}
 	return bOk;
 }
@@ -506,9 +581,6 @@ boolean SNBClassifierSelectionDataCostCalculator::UpdateDataCost()
 	const boolean bTrace = false;
 	boolean bOk = true;
 	int nTargetPart;
-	int nChunkInstanceNumber;
-	int nChunkInstance;
-	double dInstanceNonNormalizedDataCost;
 
 	// Entete de trace de debbogage
 	if (bTrace)
@@ -520,15 +592,7 @@ boolean SNBClassifierSelectionDataCostCalculator::UpdateDataCost()
 	}
 
 	// Mise-a-jour du score en recalculant tous les couts par instance
-	dSelectionDataCost = 0.0;
-	nChunkInstanceNumber = GetDataTableBinarySliceSet()->GetInitializedChunkInstanceNumber();
-	for (nChunkInstance = 0; nChunkInstance < nChunkInstanceNumber; nChunkInstance++)
-	{
-		dInstanceNonNormalizedDataCost = ComputeInstanceNonNormalizedDataCost(nChunkInstance);
-		dSelectionDataCost += dInstanceNonNormalizedDataCost;
-		dvInstanceNonNormalizedDataCosts.SetAt(nChunkInstance, dInstanceNonNormalizedDataCost);
-	}
-	dSelectionDataCost += nChunkInstanceNumber * log(dLaplaceDenominator);
+	ComputeAllInstanceNonNormalizedDataCosts();
 
 	return bOk;
 }
@@ -579,6 +643,18 @@ boolean SNBClassifierSelectionDataCostCalculator::UpdateDataCostWithSparseAttrib
 	return bOk;
 }
 
+SNBTargetPart* SNBClassifierSelectionDataCostCalculator::GetActualTargetPartAt(int nChunkInstance) const
+{
+	return cast(SNBTargetPart*,
+		    oaTargetParts.GetAt(
+			GetDataTableBinarySliceSet()->GetTargetValueIndexAtInitializedChunkInstance(nChunkInstance)));
+}
+
+double SNBClassifierSelectionDataCostCalculator::GetTargetPartWeight(const SNBTargetPart* targetPart) const
+{
+	return 1.0;
+}
+
 SNBTargetPart* SNBClassifierSelectionDataCostCalculator::CreatePart()
 {
 	return new SNBSingletonTargetPart;
@@ -838,8 +914,6 @@ void SNBRegressorSelectionDataCostCalculator::InitializeTargetPartition()
 
 void SNBRegressorSelectionDataCostCalculator::InitializeDataCostState()
 {
-	int nChunkInstance;
-	double dInstanceNonNormalizedDataCost;
 
 	// Calcul d'un epsilon de Laplace pour la gestion des petites probabilites
 	// En effet, cette normalisation est faite en univarie, mais le probleme peut
@@ -864,16 +938,7 @@ void SNBRegressorSelectionDataCostCalculator::InitializeDataCostState()
 	cMaxScore = (Continuous)log(dMaxExpScore);
 
 	// Calcul du couts de la selection vide
-	dSelectionDataCost = 0.0;
-	for (nChunkInstance = 0; nChunkInstance < GetDataTableBinarySliceSet()->GetInitializedChunkInstanceNumber();
-	     nChunkInstance++)
-	{
-		dInstanceNonNormalizedDataCost = ComputeInstanceNonNormalizedDataCost(nChunkInstance);
-		dvInstanceNonNormalizedDataCosts.SetAt(nChunkInstance, dInstanceNonNormalizedDataCost);
-		dSelectionDataCost += dInstanceNonNormalizedDataCost;
-	}
-	dSelectionDataCost +=
-	    GetDataTableBinarySliceSet()->GetInitializedChunkInstanceNumber() * log(dLaplaceDenominator);
+	ComputeAllInstanceNonNormalizedDataCosts();
 
 	// Initialisation des variables pour defaire une modification
 	lastModificationAttribute = NULL;
@@ -1118,11 +1183,6 @@ boolean SNBRegressorSelectionDataCostCalculator::UpdateTargetPartScoresWithWeigh
 	int nAttributeTargetPartFrequency;
 	int nAttributeTargetPart;
 	SNBDataTableBinarySliceSetColumn* chunkColumn;
-	int nColumnValueNumber;
-	int nColumnValueIndex;
-	int nChunkInstance;
-	int nChunkInstanceValue;
-	Continuous cLogProb;
 
 	// Memorisation des indexes de parties cibles multivaries pour chaque une des parties cibles de l'attribut
 	GetDataTableBinarySliceSet()->ExportTargetPartFrequencies(attribute, &ivAttributeTargetPartFrequencies);
@@ -1150,37 +1210,10 @@ boolean SNBRegressorSelectionDataCostCalculator::UpdateTargetPartScoresWithWeigh
 	if (bOk)
 	{
 		for (nTargetPart = 0; nTargetPart < oaTargetParts.GetSize(); nTargetPart++)
-		{
-			targetPart = cast(SNBIntervalTargetPart*, oaTargetParts.GetAt(nTargetPart));
-
-			// Mise a jour des scores de la partie cible courante seulement pour les valeurs presentes de la colonne sparse
-			if (chunkColumn->GetSparseMode())
-			{
-				nColumnValueNumber = chunkColumn->GetValueNumber();
-				for (nColumnValueIndex = 0; nColumnValueIndex < nColumnValueNumber; nColumnValueIndex++)
-				{
-					nChunkInstance = chunkColumn->GetSparseValueInstanceIndexAt(nColumnValueIndex);
-					nChunkInstanceValue = chunkColumn->GetSparseValueAt(nColumnValueIndex);
-					cLogProb = attribute->GetLnSourceConditionalProb(
-					    nChunkInstanceValue,
-					    ivAttributeTargetPartIndexByTargetPartIndex.GetAt(nTargetPart));
-					targetPart->GetScores()->UpgradeAt(nChunkInstance, cDeltaWeight * cLogProb);
-				}
-			}
-			// Mise a jour des scores de la partie cible courante pour les valeurs denses
-			else
-			{
-				nColumnValueNumber = chunkColumn->GetValueNumber();
-				for (nChunkInstance = 0; nChunkInstance < nColumnValueNumber; nChunkInstance++)
-				{
-					nChunkInstanceValue = chunkColumn->GetDenseValueAt(nChunkInstance);
-					cLogProb = attribute->GetLnSourceConditionalProb(
-					    nChunkInstanceValue,
-					    ivAttributeTargetPartIndexByTargetPartIndex.GetAt(nTargetPart));
-					targetPart->GetScores()->UpgradeAt(nChunkInstance, cDeltaWeight * cLogProb);
-				}
-			}
-		}
+			UpdateTargetPartScoresWithColumn(cast(SNBTargetPart*, oaTargetParts.GetAt(nTargetPart)),
+							 chunkColumn, attribute,
+							 ivAttributeTargetPartIndexByTargetPartIndex.GetAt(nTargetPart),
+							 cDeltaWeight);
 	}
 	return bOk;
 }
@@ -1190,9 +1223,6 @@ boolean SNBRegressorSelectionDataCostCalculator::UpdateDataCost()
 	const boolean bTrace = false;
 	boolean bOk = true;
 	int nTargetPart;
-	int nChunkInstanceNumber;
-	int nChunkInstance;
-	double dInstanceNonNormalizedDataCost;
 
 	// Entete de trace de debbogage
 	if (bTrace)
@@ -1204,15 +1234,7 @@ boolean SNBRegressorSelectionDataCostCalculator::UpdateDataCost()
 	}
 
 	// Mise-a-jour du score en recalculant tous les couts par instance
-	dSelectionDataCost = 0.0;
-	nChunkInstanceNumber = GetDataTableBinarySliceSet()->GetInitializedChunkInstanceNumber();
-	for (nChunkInstance = 0; nChunkInstance < nChunkInstanceNumber; nChunkInstance++)
-	{
-		dInstanceNonNormalizedDataCost = ComputeInstanceNonNormalizedDataCost(nChunkInstance);
-		dSelectionDataCost += dInstanceNonNormalizedDataCost;
-		dvInstanceNonNormalizedDataCosts.SetAt(nChunkInstance, dInstanceNonNormalizedDataCost);
-	}
-	dSelectionDataCost += nChunkInstanceNumber * log(dLaplaceDenominator);
+	ComputeAllInstanceNonNormalizedDataCosts();
 
 	return bOk;
 }
@@ -1264,6 +1286,18 @@ boolean SNBRegressorSelectionDataCostCalculator::UpdateDataCostWithSparseAttribu
 	return bOk;
 }
 
+SNBTargetPart* SNBRegressorSelectionDataCostCalculator::GetActualTargetPartAt(int nChunkInstance) const
+{
+	return cast(SNBTargetPart*,
+		    oaTargetParts.GetAt(ivTargetPartIndexesByRank.GetAt(
+			GetDataTableBinarySliceSet()->GetTargetValueIndexAtInitializedChunkInstance(nChunkInstance))));
+}
+
+double SNBRegressorSelectionDataCostCalculator::GetTargetPartWeight(const SNBTargetPart* targetPart) const
+{
+	return cast(const SNBIntervalTargetPart*, targetPart)->GetFrequency();
+}
+
 SNBTargetPart* SNBRegressorSelectionDataCostCalculator::CreatePart()
 {
 	return new SNBIntervalTargetPart;
@@ -1868,8 +1902,6 @@ void SNBGeneralizedClassifierSelectionDataCostCalculator::InitializeTargetValueG
 void SNBGeneralizedClassifierSelectionDataCostCalculator::InitializeDataCostState()
 {
 	int nTargetValueNumber;
-	int nChunkInstance;
-	double dInstanceNonNormalizedDataCost;
 
 	require(GetDataTableBinarySliceSet() != NULL);
 	require(GetDataTableBinarySliceSet()->IsReadyToReadChunk());
@@ -1896,16 +1928,7 @@ void SNBGeneralizedClassifierSelectionDataCostCalculator::InitializeDataCostStat
 	cMaxScore = (Continuous)log(dMaxExpScore);
 
 	// Calcul du couts de la selection vide
-	dSelectionDataCost = 0.0;
-	for (nChunkInstance = 0; nChunkInstance < GetDataTableBinarySliceSet()->GetInitializedChunkInstanceNumber();
-	     nChunkInstance++)
-	{
-		dInstanceNonNormalizedDataCost = ComputeInstanceNonNormalizedDataCost(nChunkInstance);
-		dvInstanceNonNormalizedDataCosts.SetAt(nChunkInstance, dInstanceNonNormalizedDataCost);
-		dSelectionDataCost += dInstanceNonNormalizedDataCost;
-	}
-	dSelectionDataCost +=
-	    GetDataTableBinarySliceSet()->GetInitializedChunkInstanceNumber() * log(dLaplaceDenominator);
+	ComputeAllInstanceNonNormalizedDataCosts();
 
 	// Initialisation des variables pour defaire une modification
 	lastModificationAttribute = NULL;
@@ -2214,11 +2237,6 @@ boolean SNBGeneralizedClassifierSelectionDataCostCalculator::UpdateTargetPartSco
 	int nTargetPart;
 	SNBGroupTargetPart* targetPart;
 	int nAttributeTargetPart;
-	int nColumnValueNumber;
-	int nColumnValueIndex;
-	int nChunkInstance;
-	int nChunkInstanceValue;
-	Continuous cLogProb;
 
 	// Acces a la colonne de donnees de l'attribut
 	chunkColumn = NULL;
@@ -2234,32 +2252,8 @@ boolean SNBGeneralizedClassifierSelectionDataCostCalculator::UpdateTargetPartSco
 		{
 			targetPart = cast(SNBGroupTargetPart*, oaTargetParts.GetAt(nTargetPart));
 			nAttributeTargetPart = targetPart->GetSignature()->GetAt(nSignatureAttributeIndex);
-
-			// Mise a jour des scores de la partie cible courante seulement pour les valeurs presentes de la colonne sparse
-			if (chunkColumn->GetSparseMode())
-			{
-				nColumnValueNumber = chunkColumn->GetValueNumber();
-				for (nColumnValueIndex = 0; nColumnValueIndex < nColumnValueNumber; nColumnValueIndex++)
-				{
-					nChunkInstance = chunkColumn->GetSparseValueInstanceIndexAt(nColumnValueIndex);
-					nChunkInstanceValue = chunkColumn->GetSparseValueAt(nColumnValueIndex);
-					cLogProb = attribute->GetLnSourceConditionalProb(nChunkInstanceValue,
-											 nAttributeTargetPart);
-					targetPart->GetScores()->UpgradeAt(nChunkInstance, cDeltaWeight * cLogProb);
-				}
-			}
-			// Mise a jour des scores de la partie cible pour une colonne dense
-			else
-			{
-				nColumnValueNumber = chunkColumn->GetValueNumber();
-				for (nChunkInstance = 0; nChunkInstance < nColumnValueNumber; nChunkInstance++)
-				{
-					nChunkInstanceValue = chunkColumn->GetDenseValueAt(nChunkInstance);
-					cLogProb = attribute->GetLnSourceConditionalProb(nChunkInstanceValue,
-											 nAttributeTargetPart);
-					targetPart->GetScores()->UpgradeAt(nChunkInstance, cDeltaWeight * cLogProb);
-				}
-			}
+			UpdateTargetPartScoresWithColumn(targetPart, chunkColumn, attribute, nAttributeTargetPart,
+							 cDeltaWeight);
 		}
 	}
 	return bOk;
@@ -2270,9 +2264,6 @@ boolean SNBGeneralizedClassifierSelectionDataCostCalculator::UpdateDataCost()
 	const boolean bTrace = false;
 	boolean bOk = true;
 	int nTargetPart;
-	int nChunkInstanceNumber;
-	int nChunkInstance;
-	double dInstanceNonNormalizedDataCost;
 
 	// Entete de trace de debbogage
 	if (bTrace)
@@ -2284,15 +2275,7 @@ boolean SNBGeneralizedClassifierSelectionDataCostCalculator::UpdateDataCost()
 	}
 
 	// Mise-a-jour du score en recalculant tous les couts par instance
-	dSelectionDataCost = 0.0;
-	nChunkInstanceNumber = GetDataTableBinarySliceSet()->GetInitializedChunkInstanceNumber();
-	for (nChunkInstance = 0; nChunkInstance < nChunkInstanceNumber; nChunkInstance++)
-	{
-		dInstanceNonNormalizedDataCost = ComputeInstanceNonNormalizedDataCost(nChunkInstance);
-		dSelectionDataCost += dInstanceNonNormalizedDataCost;
-		dvInstanceNonNormalizedDataCosts.SetAt(nChunkInstance, dInstanceNonNormalizedDataCost);
-	}
-	dSelectionDataCost += nChunkInstanceNumber * log(dLaplaceDenominator);
+	ComputeAllInstanceNonNormalizedDataCosts();
 
 	return bOk;
 }
@@ -2343,6 +2326,24 @@ boolean SNBGeneralizedClassifierSelectionDataCostCalculator::UpdateDataCostWithS
 	return bOk;
 }
 
+SNBTargetPart* SNBGeneralizedClassifierSelectionDataCostCalculator::GetActualTargetPartAt(int nChunkInstance) const
+{
+	return cast(SNBTargetPart*,
+		    oaTargetPartsByTargetValueIndex.GetAt(
+			GetDataTableBinarySliceSet()->GetTargetValueIndexAtInitializedChunkInstance(nChunkInstance)));
+}
+
+double SNBGeneralizedClassifierSelectionDataCostCalculator::GetTargetPartWeight(const SNBTargetPart* targetPart) const
+{
+	return cast(const SNBGroupTargetPart*, targetPart)->GetFrequency();
+}
+
+double SNBGeneralizedClassifierSelectionDataCostCalculator::GetInstanceInverseProbDivisor(int nChunkInstance) const
+{
+	return GetTargetValueFrequencyAt(
+	    GetDataTableBinarySliceSet()->GetTargetValueIndexAtInitializedChunkInstance(nChunkInstance));
+}
+
 SNBTargetPart* SNBGeneralizedClassifierSelectionDataCostCalculator::CreatePart()
 {
 	return new SNBGroupTargetPart;
@@ -209,6 +209,39 @@ protected:
 	// True si l'on peut faire la derniere modification
 	boolean IsUndoAllowed();
 
+	/////////////////////////////////////////////////////////////////////////////////////
+	// Noyaux de calcul communs aux sous-classes
+	//
+	// Les boucles sur les instances sont les plus couteuses de l'apprentissage du SNB. Elles sont ecrites
+	// de facon a parcourir des tableaux contigus avec un corps de boucle sans indirection, ce qui permet
+	// au compilateur de les vectoriser. Les resultats sont identiques a ceux des calculs instance par instance.
+
+	// Mise a jour des scores d'une partie cible avec la colonne d'un attribut dont le poids change
+	// Les increments de score cDeltaWeight * ln P(X = x | Y = nAttributeTargetPart) sont precalcules
+	// une fois pour toutes les modalites source de l'attribut, puis ajoutes aux scores des instances
+	void UpdateTargetPartScoresWithColumn(SNBTargetPart* targetPart, const SNBDataTableBinarySliceSetColumn* chunkColumn,
+					      const SNBDataTableBinarySliceSetAttribute* attribute,
+					      int nAttributeTargetPart, Continuous cDeltaWeight);
+
+	// Calcul des couts non normalises de toutes les instances du chunk (cf. ComputeInstanceNonNormalizedDataCost
+	// des sous-classes), et mise a jour du cout de la selection
+	// Les instances sont traitees par blocs: pour chaque bloc, on accumule les contributions de chaque partie
+	// cible au lieu de parcourir toutes les parties cibles pour chaque instance
+	void ComputeAllInstanceNonNormalizedDataCosts();
+
+	// Partie cible de la valeur cible reelle d'une instance du chunk
+	virtual SNBTargetPart* GetActualTargetPartAt(int nChunkInstance) const = 0;
+
+	// Poids d'une partie cible dans l'inverse de la probabilite d'une instance: 1 pour une classification
+	// standard, effectif de la partie sinon
+	virtual double GetTargetPartWeight(const SNBTargetPart* targetPart) const = 0;
+
+	// Diviseur de l'inverse de la probabilite d'une instance (defaut: 1)
+	virtual double GetInstanceInverseProbDivisor(int nChunkInstance) const;
+
+	// Nombre d'instances par bloc dans les calculs de cout
+	static const int nInstanceBlockSize = 256;
+
 	/////////////////////////
 	// Parametres
 
@@ -224,6 +257,9 @@ protected:
 	// Objets *TargetPart reutilisables (cache)
 	ObjectList olReleasedPartsCache;
 
+	// Vecteur de travail pour les increments de score par modalite source d'un attribut
+	ContinuousVector cvWorkingWeightedLnProbs;
+
 	// Nombre d'instances caste en double
 	double dInstanceNumber;
 
@@ -336,6 +372,10 @@ protected:
 	// Calcul du cout de selection non normalise pour une instance donnee
 	double ComputeInstanceNonNormalizedDataCost(int nInstance) const;
 
+	// Reimplementation des methodes d'acces aux parties cibles pour les noyaux de calcul
+	SNBTargetPart* GetActualTargetPartAt(int nChunkInstance) const override;
+	double GetTargetPartWeight(const SNBTargetPart* targetPart) const override;
+
 	// Verification de la coherence de la partition cible
 	boolean CheckParts() const;
 };
@@ -425,6 +465,10 @@ protected:
 	// Calcul du cout de selection non normalise pour une instance donnee
 	double ComputeInstanceNonNormalizedDataCost(int nInstance) const;
 
+	// Reimplementation des methodes d'acces aux parties cibles pour les noyaux de calcul
+	SNBTargetPart* GetActualTargetPartAt(int nChunkInstance) const override;
+	double GetTargetPartWeight(const SNBTargetPart* targetPart) const override;
+
 	// Vue de liste de la partition cible
 	ObjectList olTargetPartition;
 
@@ -586,6 +630,11 @@ protected:
 	// Calcul du cout de selection non normalise pour une instance donnee
 	double ComputeInstanceNonNormalizedDataCost(int nInstance) const;
 
+	// Reimplementation des methodes d'acces aux parties cibles pour les noyaux de calcul
+	SNBTargetPart* GetActualTargetPartAt(int nChunkInstance) const override;
+	double GetTargetPartWeight(const SNBTargetPart* targetPart) const override;
+	double GetInstanceInverseProbDivisor(int nChunkInstance) const override;
+
 	// Initialisation des services d'indexation de groupes cible pour les attributs
 	void InitializeTargetValueGroupMatchings();
 	void CleanTargetValueGroupMatchings();
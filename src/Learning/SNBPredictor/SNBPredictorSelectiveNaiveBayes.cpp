@@ -219,6 +219,44 @@ IntVector* SNBPredictorSelectiveNaiveBayes::ComputeTrainingSparseMissingValueNum
 	return ivTrainingSparseMissingValueNumberPerAttribute;
 }
 
+int SNBPredictorSelectiveNaiveBayes::ComputeTrainingMaxSourcePartNumber() const
+{
+	ObjectArray oaDataPreparationStats;
+	int nTrainingAttributeNumber;
+	int nMaxSourcePartNumber;
+	int nAttribute;
+	KWDataPreparationStats* dataPreparationStats;
+
+	require(GetClassStats() != NULL);
+	require(GetClassStats()->Check());
+
+	// Obtention des statistiques des attributs triees par level
+	oaDataPreparationStats.CopyFrom(GetClassStats()->GetAllPreparedStats());
+	oaDataPreparationStats.SetCompareFunction(KWLearningReportCompareSortValue);
+	oaDataPreparationStats.Sort();
+
+	// Calcul du max des tailles des grilles source des attributs prepares
+	nTrainingAttributeNumber = ComputeTrainingAttributeNumber();
+	nMaxSourcePartNumber = 0;
+	for (nAttribute = 0; nAttribute < oaDataPreparationStats.GetSize(); nAttribute++)
+	{
+		// Arret si on depase le nombre d'attributs a utiliser dans l'entrainement
+		if (nAttribute >= nTrainingAttributeNumber)
+			break;
+
+		// Arret si la grille de preparation n'est pas disponible
+		dataPreparationStats = cast(KWDataPreparationStats*, oaDataPreparationStats.GetAt(nAttribute));
+		if (dataPreparationStats->GetPreparedDataGridStats() == NULL)
+		{
+			nMaxSourcePartNumber = 0;
+			break;
+		}
+		nMaxSourcePartNumber = max(nMaxSourcePartNumber,
+					   dataPreparationStats->GetPreparedDataGridStats()->ComputeSourceGridSize());
+	}
+	return nMaxSourcePartNumber;
+}
+
 double SNBPredictorSelectiveNaiveBayes::ComputeSparseMemoryFactor()
 {
 	KWDataTableSliceSet* sliceSet;
@@ -148,6 +148,10 @@ protected:
 	// Memoire : Appelant
 	IntVector* ComputeTrainingSparseMissingValueNumberPerAttribute() const;
 
+	// Nombre maximal de parties source (cellules en multivarie) des attributs utilises pour l'apprentissage
+	// Retourne 0 si ce nombre n'est pas disponible
+	int ComputeTrainingMaxSourcePartNumber() const;
+
 	////////////////////////////////
 	// Objets de travail
 
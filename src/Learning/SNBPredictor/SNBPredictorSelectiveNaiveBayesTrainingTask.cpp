@@ -470,7 +470,7 @@ longint SNBPredictorSelectiveNaiveBayesTrainingTask::ComputeGlobalSlaveNecessary
 	lGlobalDataCostCalculatorMemory = ComputeGlobalSlaveScorerNecessaryMemory();
 	lGlobalBinarySliceSetChunkBufferMemory = SNBDataTableBinarySliceSetChunkBuffer::ComputeNecessaryMemory(
 	    nInstanceNumber, 1, ivSparseMissingValueNumberPerAttribute, nAttributeNumber - nSparseAttributeNumber,
-	    nSliceNumber, dSparseMemoryFactor, false);
+	    masterSnbPredictor->ComputeTrainingMaxSourcePartNumber(), nSliceNumber, dSparseMemoryFactor, false);
 
 	// Nettoyage vecteur des comptes des valeurs sparse
 	delete ivSparseMissingValueNumberPerAttribute;
@@ -566,7 +566,8 @@ longint SNBPredictorSelectiveNaiveBayesTrainingTask::ComputeGlobalSlaveBinarySli
 	// avec les estimations des objets necessaires avec un seul chunk
 	lNecessaryMemory = SNBDataTableBinarySliceSetChunkBuffer::ComputeNecessaryMemory(
 	    nInstanceNumber, 1, ivTrainingSparseMissingValueNumberPerAttribute,
-	    nAttributeNumber - nSparseAttributeNumber, nSliceNumber, dSparseMemoryFactor, false);
+	    nAttributeNumber - nSparseAttributeNumber, masterSnbPredictor->ComputeTrainingMaxSourcePartNumber(),
+	    nSliceNumber, dSparseMemoryFactor, false);
 
 	// Nettoyage
 	delete ivTrainingSparseMissingValueNumberPerAttribute;
@@ -843,8 +844,8 @@ longint SNBPredictorSelectiveNaiveBayesTrainingTask::ComputeGlobalSlaveNecessary
 	ivSparseMissingValueNumberPerAttribute =
 	    masterSnbPredictor->ComputeTrainingSparseMissingValueNumberPerAttribute();
 	lNecessaryDisk = SNBDataTableBinarySliceSetChunkBuffer::ComputeNecessaryMemory(
-	    nInstanceNumber, 1, ivSparseMissingValueNumberPerAttribute, nAttributeNumber - nSparseAttributeNumber, 1,
-	    1.0, true);
+	    nInstanceNumber, 1, ivSparseMissingValueNumberPerAttribute, nAttributeNumber - nSparseAttributeNumber,
+	    masterSnbPredictor->ComputeTrainingMaxSourcePartNumber(), 1, 1.0, true);
 
 	// Nettoyage
 	delete ivSparseMissingValueNumberPerAttribute;
@@ -992,9 +993,13 @@ boolean SNBPredictorSelectiveNaiveBayesTrainingTask::MasterInitializeDataTableBi
 			// Estimation du nombre de valeurs denses dans un bloc
 			nDenseAttributeNumber = masterSnbPredictor->ComputeTrainingAttributeNumber() -
 						masterSnbPredictor->ComputeTrainingSparseAttributeNumber();
-			lSlaveDenseValuesMemoryPerBlock = longint(nDenseAttributeNumber) *
-							  masterSnbPredictor->GetInstanceNumber() * sizeof(int) /
-							  longint(nSlaveProcessNumber * nSliceNumber);
+			lSlaveDenseValuesMemoryPerBlock =
+			    longint(nDenseAttributeNumber) *
+			    SNBDataTableBinarySliceSetColumn::ComputeDenseDataSize(
+				masterSnbPredictor->GetInstanceNumber(),
+				SNBDataTableBinarySliceSetColumn::ComputeValueBitNumber(
+				    masterSnbPredictor->ComputeTrainingMaxSourcePartNumber())) *
+			    sizeof(int) / longint(nSlaveProcessNumber * nSliceNumber);
 
 			// Estimation de la memoire max des valeurs sparse dans un bloc
 			//
@@ -0,0 +1,553 @@
+// Copyright (c) 2023-2026 Orange. All rights reserved.
+// This software is distributed under the BSD 3-Clause-clear License, the text of which is available
+// at https://spdx.org/licenses/BSD-3-Clause-Clear.html or see the "LICENSE" file for more details.
+
+#include "CompactNumericKeyDictionary.h"
+
+CompactNumericKeyDictionary::CompactNumericKeyDictionary()
+{
+	pSlots = NULL;
+	nTableSize = 0;
+	nCount = 0;
+}
+
+CompactNumericKeyDictionary::~CompactNumericKeyDictionary()
+{
+	RemoveAll();
+}
+
+void CompactNumericKeyDictionary::SetAt(NUMERIC key, Object* newValue)
+{
+	int nIndex;
+
+	// Remplacement de la valeur si la cle existe deja
+	nIndex = SearchSlotIndex(key.ToLongint());
+	if (nIndex != -1)
+	{
+		pSlots[nIndex].oValue = newValue;
+		return;
+	}
+
+	// Retaillage dynamique avant insertion si le taux de remplissage maximum est atteint
+	if (nTableSize == 0)
+		ReinitTable(nMinTableSize);
+	else if (nTableSize < nMaxTableSize and (longint)(nCount + 1) * 4 > (longint)nTableSize * 3)
+		ReinitTable(2 * nTableSize);
+	assert(nCount < nTableSize);
+
+	// Insertion de la nouvelle cle
+	InsertNewKey(key.ToLongint(), newValue);
+}
+
+boolean CompactNumericKeyDictionary::RemoveKey(NUMERIC key)
+{
+	int nIndex;
+	int nNextIndex;
+
+	// Recherche de la case de la cle
+	nIndex = SearchSlotIndex(key.ToLongint());
+	if (nIndex == -1)
+		return false;
+
+	// Decalage arriere des elements suivants qui ne sont pas dans leur case ideale,
+	// pour preserver l'invariant de Robin Hood sans marqueur de suppression
+	nNextIndex = (nIndex + 1) & (nTableSize - 1);
+	while (pSlots[nNextIndex].nDistance > 1)
+	{
+		pSlots[nIndex] = pSlots[nNextIndex];
+		pSlots[nIndex].nDistance--;
+		nIndex = nNextIndex;
+		nNextIndex = (nIndex + 1) & (nTableSize - 1);
+	}
+
+	// Liberation de la derniere case decalee
+	pSlots[nIndex].lKey = 0;
+	pSlots[nIndex].oValue = NULL;
+	pSlots[nIndex].nDistance = 0;
+	nCount--;
+
+	// Retaillage dynamique
+	if (nCount > 20 and nCount < nTableSize / 8)
+		ReinitTable(ComputeTableSize(nCount * 2));
+	return true;
+}
+
+void CompactNumericKeyDictionary::RemoveAll()
+{
+	if (pSlots != NULL)
+		DeleteMemoryBlock(pSlots);
+	pSlots = NULL;
+	nTableSize = 0;
+	nCount = 0;
+}
+
+void CompactNumericKeyDictionary::DeleteAll()
+{
+	int nIndex;
+
+	// Destruction des valeurs
+	for (nIndex = 0; nIndex < nTableSize; nIndex++)
+	{
+		if (pSlots[nIndex].nDistance > 0 and pSlots[nIndex].oValue != NULL)
+			delete pSlots[nIndex].oValue;
+	}
+	RemoveAll();
+}
+
+POSITION CompactNumericKeyDictionary::GetStartPosition() const
+{
+	int nIndex;
+
+	// La position code l'index de la prochaine case occupee, plus un pour qu'elle soit non nulle
+	if (nCount == 0)
+		return NULL;
+	nIndex = 0;
+	while (pSlots[nIndex].nDistance == 0)
+		nIndex++;
+	return (POSITION)(longint)(nIndex + 1);
+}
+
+void CompactNumericKeyDictionary::GetNextAssoc(POSITION& rNextPosition, NUMERIC& key, Object*& oValue) const
+{
+	int nIndex;
+
+	require(rNextPosition != NULL);
+
+	// Acces a la case courante
+	nIndex = (int)((longint)rNextPosition - 1);
+	assert(0 <= nIndex and nIndex < nTableSize);
+	assert(pSlots[nIndex].nDistance > 0);
+	key = pSlots[nIndex].lKey;
+	oValue = pSlots[nIndex].oValue;
+
+	// Recherche de la case occupee suivante
+	nIndex++;
+	while (nIndex < nTableSize and pSlots[nIndex].nDistance == 0)
+		nIndex++;
+	if (nIndex < nTableSize)
+		rNextPosition = (POSITION)(longint)(nIndex + 1);
+	else
+		rNextPosition = NULL;
+}
+
+void CompactNumericKeyDictionary::ExportObjectArray(ObjectArray* oaResult) const
+{
+	int nIndex;
+	int nResultIndex;
+
+	require(oaResult != NULL);
+
+	// Parcours direct des cases de la table
+	oaResult->SetSize(nCount);
+	nResultIndex = 0;
+	for (nIndex = 0; nIndex < nTableSize; nIndex++)
+	{
+		if (pSlots[nIndex].nDistance > 0)
+		{
+			oaResult->SetAt(nResultIndex, pSlots[nIndex].oValue);
+			nResultIndex++;
+		}
+	}
+	ensure(nResultIndex == nCount);
+}
+
+void CompactNumericKeyDictionary::CopyFrom(const CompactNumericKeyDictionary* cnkdSource)
+{
+	require(cnkdSource != NULL);
+
+	// Cas particulier ou source egale cible
+	if (cnkdSource == this)
+		return;
+
+	// Recopie directe de la table, dont l'organisation ne depend que des cles et de la taille
+	RemoveAll();
+	if (cnkdSource->nTableSize > 0)
+	{
+		pSlots = (CNKDSlot*)NewMemoryBlock(cnkdSource->nTableSize * sizeof(CNKDSlot));
+		memcpy(pSlots, cnkdSource->pSlots, cnkdSource->nTableSize * sizeof(CNKDSlot));
+		nTableSize = cnkdSource->nTableSize;
+		nCount = cnkdSource->nCount;
+	}
+}
+
+CompactNumericKeyDictionary* CompactNumericKeyDictionary::Clone() const
+{
+	CompactNumericKeyDictionary* cnkdClone;
+
+	cnkdClone = new CompactNumericKeyDictionary;
+	cnkdClone->CopyFrom(this);
+	return cnkdClone;
+}
+
+void CompactNumericKeyDictionary::Write(ostream& ost) const
+{
+	POSITION current;
+	NUMERIC key;
+	Object* oValue;
+	const int nMax = 10;
+	int n;
+
+	ost << GetClassLabel() << " [" << GetCount() << "]\n";
+	current = GetStartPosition();
+	n = 0;
+	while (current != NULL)
+	{
+		n++;
+		GetNextAssoc(current, key, oValue);
+		ost << "\t" << key << ":";
+		if (oValue == NULL)
+			ost << "\tnull\n";
+		else
+			ost << "\t" << *oValue << "\n";
+
+		// Gestion du nombre limite de valeurs a afficher
+		if (n >= nMax)
+		{
+			ost << "\t...\n";
+			break;
+		}
+	}
+}
+
+longint CompactNumericKeyDictionary::GetUsedMemory() const
+{
+	return sizeof(CompactNumericKeyDictionary) + (longint)nTableSize * sizeof(CNKDSlot);
+}
+
+longint CompactNumericKeyDictionary::GetOverallUsedMemory() const
+{
+	longint lUsedMemory;
+	int nIndex;
+
+	lUsedMemory = GetUsedMemory();
+	for (nIndex = 0; nIndex < nTableSize; nIndex++)
+	{
+		if (pSlots[nIndex].nDistance > 0 and pSlots[nIndex].oValue != NULL)
+			lUsedMemory += pSlots[nIndex].oValue->GetUsedMemory();
+	}
+	return lUsedMemory;
+}
+
+longint CompactNumericKeyDictionary::GetUsedMemoryPerElement() const
+{
+	// Taux de remplissage compris entre 3/8 et 3/4 en regime de croissance, soit environ deux cases par element
+	return 2 * sizeof(CNKDSlot);
+}
+
+int CompactNumericKeyDictionary::ComputeTableSize(int nElementNumber)
+{
+	int nSize;
+
+	require(nElementNumber >= 0);
+
+	nSize = nMinTableSize;
+	while (nSize < nElementNumber and nSize < nMaxTableSize)
+		nSize *= 2;
+	return nSize;
+}
+
+void CompactNumericKeyDictionary::ReinitTable(int nNewTableSize)
+{
+	CNKDSlot* pOldSlots;
+	int nOldTableSize;
+	int nIndex;
+
+	require(nNewTableSize >= nMinTableSize);
+	require(nNewTableSize <= nMaxTableSize);
+	require((nNewTableSize & (nNewTableSize - 1)) == 0);
+	require(nNewTableSize > nCount);
+
+	// Creation d'une nouvelle table vide
+	pOldSlots = pSlots;
+	nOldTableSize = nTableSize;
+	pSlots = (CNKDSlot*)NewMemoryBlock(nNewTableSize * sizeof(CNKDSlot));
+	memset(pSlots, 0, nNewTableSize * sizeof(CNKDSlot));
+	nTableSize = nNewTableSize;
+	nCount = 0;
+
+	// Reinsertion des elements de l'ancienne table
+	for (nIndex = 0; nIndex < nOldTableSize; nIndex++)
+	{
+		if (pOldSlots[nIndex].nDistance > 0)
+			InsertNewKey(pOldSlots[nIndex].lKey, pOldSlots[nIndex].oValue);
+	}
+	if (pOldSlots != NULL)
+		DeleteMemoryBlock(pOldSlots);
+}
+
+void CompactNumericKeyDictionary::InsertNewKey(longint lKey, Object* oValue)
+{
+	CNKDSlot insertedSlot;
+	CNKDSlot swapSlot;
+	int nIndex;
+
+	require(nCount < nTableSize);
+	require(SearchSlotIndex(lKey) == -1);
+
+	// Parcours a partir de la case ideale jusqu'a trouver une case libre, en echangeant l'element a inserer
+	// avec tout element plus proche de sa case ideale (strategie de Robin Hood)
+	insertedSlot.lKey = lKey;
+	insertedSlot.oValue = oValue;
+	insertedSlot.nDistance = 1;
+	nIndex = ComputeSlotIndex(lKey);
+	while (pSlots[nIndex].nDistance > 0)
+	{
+		if (pSlots[nIndex].nDistance < insertedSlot.nDistance)
+		{
+			swapSlot = pSlots[nIndex];
+			pSlots[nIndex] = insertedSlot;
+			insertedSlot = swapSlot;
+		}
+		nIndex = (nIndex + 1) & (nTableSize - 1);
+		insertedSlot.nDistance++;
+	}
+	pSlots[nIndex] = insertedSlot;
+	nCount++;
+}
+
+const ALString CompactNumericKeyDictionary::GetClassLabel() const
+{
+	return "Compact numeric key dictionary";
+}
+
+void CompactNumericKeyDictionary::Test()
+{
+	CompactNumericKeyDictionary cnkdTest;
+	CompactNumericKeyDictionary* cnkdClone;
+	NumericKeyDictionary nkdReference;
+	ObjectArray oaNumericKeyArray;
+	ObjectArray oaExported;
+	SampleObject* soElement;
+	SampleObject soTest;
+	NUMERIC key;
+	Object* oValue;
+	POSITION position;
+	int i;
+	int nKey;
+	int nOperationNumber;
+	int nOperation;
+	int nErrorNumber;
+	int nIteratedNumber;
+	int nMaxSize;
+
+	// Initialisation de 11 NUMERIC
+	SetRandomSeed(1);
+	oaNumericKeyArray.SetSize(11);
+	for (i = 0; i < oaNumericKeyArray.GetSize(); i++)
+	{
+		soElement = new SampleObject;
+		soElement->SetInt(i);
+		oaNumericKeyArray.SetAt(i, soElement);
+	}
+
+	/////
+	cout << "Test des fonctionnalites de base\n";
+	//
+	cout << "Insertion de 10 NUMERICs\n";
+	for (i = 0; i < 10; i++)
+		cnkdTest.SetAt(oaNumericKeyArray.GetAt(i), &soTest);
+	cout << "\tCompact numeric key dictionary size\t" << cnkdTest.GetCount() << "\n";
+
+	//
+	cout << "Test d'existence\n";
+	for (i = 8; i < 11; i++)
+	{
+		soElement = cast(SampleObject*, oaNumericKeyArray.GetAt(i));
+		cout << "\tLookup (" << *soElement << "): " << (cnkdTest.Lookup(soElement) != NULL) << "\n";
+	}
+
+	//
+	cout << "Insertion puis supression d'une cle\n";
+	cnkdTest.SetAt(&soTest, &soTest);
+	cout << "Inserted: " << (cnkdTest.Lookup(&soTest) != NULL) << endl;
+	cnkdTest.RemoveKey(&soTest);
+	cout << "Removed: " << (cnkdTest.Lookup(&soTest) == NULL) << endl;
+
+	//
+	cout << "Cles entieres, dont la cle 0\n";
+	cnkdTest.RemoveAll();
+	for (i = 0; i < 5; i++)
+		cnkdTest.SetAt(i, oaNumericKeyArray.GetAt(i));
+	cout << "\tLookup (0): " << (cnkdTest.Lookup(0) == oaNumericKeyArray.GetAt(0)) << "\n";
+	cout << "\tLookup (5): " << (cnkdTest.Lookup(5) != NULL) << "\n";
+	cnkdTest.ExportObjectArray(&oaExported);
+	cout << "\tExported size: " << oaExported.GetSize() << "\n";
+	cnkdClone = cnkdTest.Clone();
+	cout << "\tClone size: " << cnkdClone->GetCount() << "\n";
+	cout << "\tClone lookup (4): " << (cnkdClone->Lookup(4) == oaNumericKeyArray.GetAt(4)) << "\n";
+	delete cnkdClone;
+
+	/////
+	cout << "Test de coherence avec NumericKeyDictionary\n";
+	nOperationNumber = AcquireRangedInt("Nombre d'operations aleatoires", 1, 10000000, 1000000);
+	cnkdTest.RemoveAll();
+	nErrorNumber = 0;
+	for (nOperation = 0; nOperation < nOperationNumber; nOperation++)
+	{
+		// Operation aleatoire sur une cle aleatoire, avec plus d'insertions que de suppressions
+		// puis l'inverse, pour tester les croissances et decroissances de la table
+		nKey = RandomInt(nOperationNumber / 10);
+		if (RandomDouble() < (nOperation < nOperationNumber / 2 ? 0.7 : 0.2))
+		{
+			cnkdTest.SetAt(nKey, &soTest);
+			nkdReference.SetAt(nKey, &soTest);
+		}
+		else
+		{
+			if (cnkdTest.RemoveKey(nKey) != nkdReference.RemoveKey(nKey))
+				nErrorNumber++;
+		}
+
+		// Recherche d'une autre cle aleatoire
+		nKey = RandomInt(nOperationNumber / 10);
+		if (cnkdTest.Lookup(nKey) != nkdReference.Lookup(nKey))
+			nErrorNumber++;
+	}
+
+	// Verification du parcours complet
+	nIteratedNumber = 0;
+	position = cnkdTest.GetStartPosition();
+	while (position != NULL)
+	{
+		cnkdTest.GetNextAssoc(position, key, oValue);
+		if (nkdReference.Lookup(key) != oValue)
+			nErrorNumber++;
+		nIteratedNumber++;
+	}
+	cout << "\tSize\t" << cnkdTest.GetCount() << "\t" << nkdReference.GetCount() << "\n";
+	cout << "\tIterated\t" << nIteratedNumber << "\n";
+	cout << "\tErrors\t" << nErrorNumber << "\n";
+
+	// Comparaison des performances
+	cout << "Test de performance\n";
+	nMaxSize = AcquireRangedInt("Taille maximale des dictionnaires", 1000, 100000000, 100000);
+	TestPerformance(nMaxSize);
+
+	// Nettoyage
+	cnkdTest.RemoveAll();
+	oaNumericKeyArray.DeleteAll();
+}
+
+void CompactNumericKeyDictionary::TestPerformance(int nMaxSize)
+{
+	CompactNumericKeyDictionary cnkdPerf;
+	NumericKeyDictionary nkdPerf;
+	SampleObject soTest;
+	NUMERIC key;
+	Object* oValue;
+	POSITION position;
+	int nSize;
+	int nDictionary;
+	int i;
+	int nFound;
+	int nStartClock;
+	int nInsertClock;
+	int nLookupClock;
+	int nMissingLookupClock;
+	int nIterateClock;
+	longint lUsedMemory;
+	ALString sDictionaryLabel;
+
+	require(nMaxSize > 0);
+
+	// Tailles de dictionnaire croissantes par puissance de 10, a partir de 1000
+	cout << "SYS\tDictionary\tSize\tInsert\tLookup\tMissing lookup\tIterate\tUsed memory\n";
+	nSize = min(1000, nMaxSize);
+	while (nSize <= nMaxSize)
+	{
+		for (nDictionary = 0; nDictionary < 2; nDictionary++)
+		{
+			// Insertion de cles numeriques pseudo-aleatoires distinctes, a la facon de pointeurs
+			nStartClock = clock();
+			for (i = 0; i < nSize; i++)
+			{
+				key = (longint)IthRandomUnsignedLongint(i) & ~(longint)7;
+				if (nDictionary == 0)
+					nkdPerf.SetAt(key, &soTest);
+				else
+					cnkdPerf.SetAt(key, &soTest);
+			}
+			nInsertClock = clock() - nStartClock;
+
+			// Recherche des cles existantes
+			nFound = 0;
+			nStartClock = clock();
+			for (i = 0; i < nSize; i++)
+			{
+				key = (longint)IthRandomUnsignedLongint(i) & ~(longint)7;
+				if (nDictionary == 0)
+					oValue = nkdPerf.Lookup(key);
+				else
+					oValue = cnkdPerf.Lookup(key);
+				if (oValue != NULL)
+					nFound++;
+			}
+			nLookupClock = clock() - nStartClock;
+			assert(nFound == (nDictionary == 0 ? nkdPerf.GetCount() : cnkdPerf.GetCount()));
+
+			// Recherche de cles absentes
+			nFound = 0;
+			nStartClock = clock();
+			for (i = 0; i < nSize; i++)
+			{
+				key = (longint)IthRandomUnsignedLongint(i) | (longint)1;
+				if (nDictionary == 0)
+					oValue = nkdPerf.Lookup(key);
+				else
+					oValue = cnkdPerf.Lookup(key);
+				if (oValue != NULL)
+					nFound++;
+			}
+			nMissingLookupClock = clock() - nStartClock;
+			assert(nFound == 0);
+
+			// Parcours de toutes les paires
+			nFound = 0;
+			nStartClock = clock();
+			if (nDictionary == 0)
+			{
+				position = nkdPerf.GetStartPosition();
+				while (position != NULL)
+				{
+					nkdPerf.GetNextAssoc(position, key, oValue);
+					nFound++;
+				}
+			}
+			else
+			{
+				position = cnkdPerf.GetStartPosition();
+				while (position != NULL)
+				{
+					cnkdPerf.GetNextAssoc(position, key, oValue);
+					nFound++;
+				}
+			}
+			nIterateClock = clock() - nStartClock;
+
+			// Affichage des resultats, puis nettoyage
+			if (nDictionary == 0)
+			{
+				sDictionaryLabel = nkdPerf.GetClassLabel();
+				lUsedMemory = nkdPerf.GetUsedMemory();
+				nkdPerf.RemoveAll();
+			}
+			else
+			{
+				sDictionaryLabel = cnkdPerf.GetClassLabel();
+				lUsedMemory = cnkdPerf.GetUsedMemory();
+				cnkdPerf.RemoveAll();
+			}
+			cout << "SYS\t" << sDictionaryLabel << "\t" << nSize << "\t";
+			cout << nInsertClock * 1.0 / CLOCKS_PER_SEC << "\t";
+			cout << nLookupClock * 1.0 / CLOCKS_PER_SEC << "\t";
+			cout << nMissingLookupClock * 1.0 / CLOCKS_PER_SEC << "\t";
+			cout << nIterateClock * 1.0 / CLOCKS_PER_SEC << "\t";
+			cout << lUsedMemory << "\n";
+		}
+
+		// Taille suivante
+		if (nSize > nMaxSize / 10)
+			break;
+		nSize *= 10;
+	}
+}
@@ -0,0 +1,199 @@
+// Copyright (c) 2023-2026 Orange. All rights reserved.
+// This software is distributed under the BSD 3-Clause-clear License, the text of which is available
+// at https://spdx.org/licenses/BSD-3-Clause-Clear.html or see the "LICENSE" file for more details.
+
+#pragma once
+
+#include "Object.h"
+
+class CompactNumericKeyDictionary;
+struct CNKDSlot;
+
+//////////////////////////////////////////////////////////////////////
+// Dictionaire d'objet a cle numerique, par adressage ouvert
+// Meme interface que NumericKeyDictionary, avec une implementation alternative,
+// a choisir explicitement pour les dictionnaires intensivement sollicites en recherche
+//
+// Les paires (cle, valeur) sont stockees directement dans un tableau contigu de cases,
+// sans allocation par element ni chainage, ce qui evite les acces memoire indirects:
+//  . taille de table puissance de 2, taux de remplissage maximum de 3/4
+//  . sondage lineaire avec la strategie de Robin Hood: lors d'une insertion, un element
+//    prend la place de l'element rencontre s'il est plus loin de sa case ideale que ce dernier,
+//    ce qui borne la variance des longueurs de sondage et permet d'arreter une recherche
+//    infructueuse des que l'on rencontre un element plus proche de sa case ideale
+//  . suppression par decalage arriere des elements suivants, sans marqueur de suppression
+//
+// Contrairement a NumericKeyDictionary, l'ordre de parcours des elements est celui des cases
+// de la table, et le dictionnaire ne doit pas etre modifie pendant un parcours
+//
+// Memoire
+//   Les objets n'appartiennent pas au dictionaire: leur liberation
+//   n'est pas geree par cette classe
+class CompactNumericKeyDictionary : public Object
+{
+public:
+	// Constructeur
+	CompactNumericKeyDictionary();
+	~CompactNumericKeyDictionary();
+
+	// Nombre d'elements
+	int GetCount() const;
+	boolean IsEmpty() const;
+
+	// Recherche par cle
+	// Renvoie NULL si non trouve
+	Object* Lookup(NUMERIC key) const;
+
+	// Ajout d'une nouvelle paire (key, value)
+	// (ou remplacement d'une valeur pour une cle donnee)
+	void SetAt(NUMERIC key, Object* newValue);
+
+	// Supression d'une cle
+	// Retourne true si la cle existait
+	boolean RemoveKey(NUMERIC key);
+
+	// Supression ou destruction de tous les elements
+	void RemoveAll();
+	void DeleteAll();
+
+	// Parcours de toutes les paires (key, value)
+	// Example:
+	//  position = myDic->GetStartPosition();
+	//	while (position != NULL)
+	//	{
+	//		myDic->GetNextAssoc(position, key, oElement);
+	//      myObject = cast(MyClass*, oElement);
+	//		cout << *myObject << "\n";
+	//	}
+	POSITION GetStartPosition() const;
+	void GetNextAssoc(POSITION& rNextPosition, NUMERIC& key, Object*& oValue) const;
+
+	// Conversion vers un tableau
+	// Memoire: le contenu precedent du container resultat n'est plus reference (mais pas detruit)
+	void ExportObjectArray(ObjectArray* oaResult) const;
+
+	// Copie du contenu d'un dictionnaire source
+	void CopyFrom(const CompactNumericKeyDictionary* cnkdSource);
+
+	// Clone: alloue et retourne le Clone
+	CompactNumericKeyDictionary* Clone() const;
+
+	// Affichage du contenu du dictionaire
+	void Write(ostream& ost) const override;
+
+	// Estimation de la memoire utilisee
+	longint GetUsedMemory() const override;
+
+	// Estimation de la memoire utilisee avec prise en compte des objet contenus
+	longint GetOverallUsedMemory() const;
+
+	// Estimation de la memoire utilisee par element, pour le dimensionnement a prior des containers
+	longint GetUsedMemoryPerElement() const;
+
+	// Libelle de la classe
+	const ALString GetClassLabel() const override;
+
+	// Test de la classe
+	static void Test();
+
+	// Comparaison des performances avec NumericKeyDictionary en insertion, recherche et parcours,
+	// pour des tailles croissantes de dictionnaire, jusqu'a une taille maximale
+	static void TestPerformance(int nMaxSize);
+
+	///////////////////////////////////////////////////////////////////////////////////////
+	///// Implementation
+protected:
+	// Taille de la table
+	int GetTableSize() const;
+
+	// Plus petite taille de table permettant de stocker un nombre d'elements donne
+	static int ComputeTableSize(int nElementNumber);
+
+	// Retaillage de la table, en preservant son contenu
+	void ReinitTable(int nNewTableSize);
+
+	// Index de la case ideale d'une cle
+	int ComputeSlotIndex(longint lKey) const;
+
+	// Recherche de l'index de la case d'une cle, -1 si non trouvee
+	int SearchSlotIndex(longint lKey) const;
+
+	// Insertion d'une cle absente de la table, qui doit avoir au moins une case libre
+	void InsertNewKey(longint lKey, Object* oValue);
+
+	// Tableau des cases, de taille nTableSize
+	CNKDSlot* pSlots;
+	int nTableSize;
+	int nCount;
+
+	// Tailles min et max de la table
+	static const int nMinTableSize = 16;
+	static const int nMaxTableSize = 1 << 30;
+};
+
+// Case de la table de CompactNumericKeyDictionary
+// La distance a la case ideale est stockee en commencant a 1, la valeur 0 indiquant une case libre
+struct CNKDSlot
+{
+	longint lKey;
+	Object* oValue;
+	int nDistance;
+};
+
+////////////////////////////////////////////////////////////////////
+// Methodes en inline
+
+inline int CompactNumericKeyDictionary::GetCount() const
+{
+	return nCount;
+}
+
+inline boolean CompactNumericKeyDictionary::IsEmpty() const
+{
+	return nCount == 0;
+}
+
+inline Object* CompactNumericKeyDictionary::Lookup(NUMERIC key) const
+{
+	int nIndex;
+
+	nIndex = SearchSlotIndex(key.ToLongint());
+	if (nIndex == -1)
+		return NULL;
+	else
+		return pSlots[nIndex].oValue;
+}
+
+inline int CompactNumericKeyDictionary::GetTableSize() const
+{
+	return nTableSize;
+}
+
+inline int CompactNumericKeyDictionary::ComputeSlotIndex(longint lKey) const
+{
+	require(nTableSize > 0);
+	return (int)(IthRandomUnsignedLongint((ulongint)lKey) & (ulongint)(nTableSize - 1));
+}
+
+inline int CompactNumericKeyDictionary::SearchSlotIndex(longint lKey) const
+{
+	int nIndex;
+	int nDistance;
+
+	// Cas d'une table vide
+	if (nCount == 0)
+		return -1;
+
+	// Parcours des cases a partir de la case ideale, jusqu'a une case vide ou une case dont l'element
+	// est plus proche de sa case ideale, ce qui garantit l'absence de la cle d'apres l'invariant de Robin Hood
+	nIndex = ComputeSlotIndex(lKey);
+	nDistance = 1;
+	while (pSlots[nIndex].nDistance >= nDistance)
+	{
+		if (pSlots[nIndex].lKey == lKey)
+			return nIndex;
+		nIndex = (nIndex + 1) & (nTableSize - 1);
+		nDistance++;
+	}
+	return -1;
+}
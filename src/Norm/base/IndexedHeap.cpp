@@ -0,0 +1,402 @@
+// Copyright (c) 2023-2026 Orange. All rights reserved.
+// This software is distributed under the BSD 3-Clause-clear License, the text of which is available
+// at https://spdx.org/licenses/BSD-3-Clause-Clear.html or see the "LICENSE" file for more details.
+
+#include "IndexedHeap.h"
+#include "SortedList.h"
+
+IndexedHeap::IndexedHeap()
+{
+	fCompareFunction = NULL;
+}
+
+IndexedHeap::~IndexedHeap() {}
+
+IndexedHeap::IndexedHeap(CompareFunction fCompare)
+{
+	fCompareFunction = fCompare;
+}
+
+void IndexedHeap::SetCompareFunction(CompareFunction fCompare)
+{
+	require(IsEmpty());
+	fCompareFunction = fCompare;
+}
+
+Object* IndexedHeap::RemoveHead()
+{
+	Object* object;
+
+	require(not IsEmpty());
+
+	object = oaHeapElements.GetAt(0);
+	RemoveAt(HandleToPosition(ivHeapHandles.GetAt(0)));
+	return object;
+}
+
+POSITION IndexedHeap::Add(Object* object)
+{
+	int nHandle;
+	int nHeapIndex;
+
+	require(fCompareFunction != NULL);
+	require(object != NULL);
+
+	// Recherche d'un identifiant libre, ou creation d'un nouvel identifiant
+	if (ivFreeHandles.GetSize() > 0)
+	{
+		nHandle = ivFreeHandles.GetAt(ivFreeHandles.GetSize() - 1);
+		ivFreeHandles.SetSize(ivFreeHandles.GetSize() - 1);
+	}
+	else
+	{
+		nHandle = ivHandleHeapIndexes.GetSize();
+		ivHandleHeapIndexes.Add(-1);
+	}
+
+	// Ajout en fin de tas, puis remontee vers la racine
+	nHeapIndex = oaHeapElements.GetSize();
+	oaHeapElements.Add(object);
+	ivHeapHandles.Add(nHandle);
+	ivHandleHeapIndexes.SetAt(nHandle, nHeapIndex);
+	SiftUp(nHeapIndex);
+	return HandleToPosition(nHandle);
+}
+
+void IndexedHeap::RemoveAt(POSITION position)
+{
+	int nHandle;
+	int nHeapIndex;
+	int nLastHeapIndex;
+
+	require(position != NULL);
+
+	// Recherche de l'index de l'element dans le tas
+	nHandle = PositionToHandle(position);
+	require(0 <= nHandle and nHandle < ivHandleHeapIndexes.GetSize());
+	nHeapIndex = ivHandleHeapIndexes.GetAt(nHandle);
+	require(nHeapIndex != -1);
+
+	// Remplacement de l'element par le dernier element du tas
+	nLastHeapIndex = oaHeapElements.GetSize() - 1;
+	if (nHeapIndex != nLastHeapIndex)
+		SwapHeapElements(nHeapIndex, nLastHeapIndex);
+	oaHeapElements.SetSize(nLastHeapIndex);
+	ivHeapHandles.SetSize(nLastHeapIndex);
+
+	// Liberation de l'identifiant de l'element supprime
+	ivHandleHeapIndexes.SetAt(nHandle, -1);
+	ivFreeHandles.Add(nHandle);
+
+	// Repositionnement de l'element deplace, qui peut devoir monter ou descendre
+	if (nHeapIndex < nLastHeapIndex)
+	{
+		if (SiftUp(nHeapIndex) == nHeapIndex)
+			SiftDown(nHeapIndex);
+	}
+}
+
+void IndexedHeap::UpdateAt(POSITION position)
+{
+	int nHandle;
+	int nHeapIndex;
+
+	require(position != NULL);
+
+	// Recherche de l'index de l'element dans le tas
+	nHandle = PositionToHandle(position);
+	require(0 <= nHandle and nHandle < ivHandleHeapIndexes.GetSize());
+	nHeapIndex = ivHandleHeapIndexes.GetAt(nHandle);
+	require(nHeapIndex != -1);
+
+	// Repositionnement de l'element, en montee ou en descente
+	if (SiftUp(nHeapIndex) == nHeapIndex)
+		SiftDown(nHeapIndex);
+}
+
+void IndexedHeap::RemoveAll()
+{
+	oaHeapElements.SetSize(0);
+	ivHeapHandles.SetSize(0);
+	ivHandleHeapIndexes.SetSize(0);
+	ivFreeHandles.SetSize(0);
+}
+
+void IndexedHeap::DeleteAll()
+{
+	oaHeapElements.DeleteAll();
+	RemoveAll();
+}
+
+void IndexedHeap::ExportObjectArray(ObjectArray* oaResult) const
+{
+	require(oaResult != NULL);
+	oaResult->CopyFrom(&oaHeapElements);
+}
+
+boolean IndexedHeap::Check() const
+{
+	boolean bOk = true;
+	int nHeapIndex;
+	int nHandle;
+
+	// Coherence des tailles
+	bOk = bOk and oaHeapElements.GetSize() == ivHeapHandles.GetSize();
+	bOk = bOk and oaHeapElements.GetSize() + ivFreeHandles.GetSize() == ivHandleHeapIndexes.GetSize();
+
+	// Verification de la propriete de tas et de l'indexation des elements
+	for (nHeapIndex = 0; nHeapIndex < oaHeapElements.GetSize(); nHeapIndex++)
+	{
+		if (not bOk)
+			break;
+		nHandle = ivHeapHandles.GetAt(nHeapIndex);
+		bOk = bOk and ivHandleHeapIndexes.GetAt(nHandle) == nHeapIndex;
+		if (nHeapIndex > 0)
+			bOk = bOk and CompareHeapElements((nHeapIndex - 1) / nArity, nHeapIndex) <= 0;
+	}
+
+	// Verification des identifiants libres
+	for (nHandle = 0; nHandle < ivFreeHandles.GetSize(); nHandle++)
+	{
+		if (not bOk)
+			break;
+		bOk = bOk and ivHandleHeapIndexes.GetAt(ivFreeHandles.GetAt(nHandle)) == -1;
+	}
+	return bOk;
+}
+
+void IndexedHeap::Write(ostream& ost) const
+{
+	const int nMax = 10;
+	int nHeapIndex;
+
+	ost << GetClassLabel() << " [" << GetCount() << "]\n";
+	for (nHeapIndex = 0; nHeapIndex < oaHeapElements.GetSize(); nHeapIndex++)
+	{
+		// Gestion du nombre limite de valeurs a afficher
+		if (nHeapIndex >= nMax)
+		{
+			ost << "\t...\n";
+			break;
+		}
+		ost << "\t" << *oaHeapElements.GetAt(nHeapIndex) << "\n";
+	}
+}
+
+longint IndexedHeap::GetUsedMemory() const
+{
+	longint lUsedMemory;
+
+	lUsedMemory = sizeof(IndexedHeap);
+	lUsedMemory += oaHeapElements.GetUsedMemory() - sizeof(ObjectArray);
+	lUsedMemory += ivHeapHandles.GetUsedMemory() - sizeof(IntVector);
+	lUsedMemory += ivHandleHeapIndexes.GetUsedMemory() - sizeof(IntVector);
+	lUsedMemory += ivFreeHandles.GetUsedMemory() - sizeof(IntVector);
+	return lUsedMemory;
+}
+
+longint IndexedHeap::GetOverallUsedMemory() const
+{
+	longint lUsedMemory;
+	int nHeapIndex;
+
+	lUsedMemory = GetUsedMemory();
+	for (nHeapIndex = 0; nHeapIndex < oaHeapElements.GetSize(); nHeapIndex++)
+		lUsedMemory += oaHeapElements.GetAt(nHeapIndex)->GetUsedMemory();
+	return lUsedMemory;
+}
+
+longint IndexedHeap::GetUsedMemoryPerElement() const
+{
+	return sizeof(Object*) + 2 * sizeof(int);
+}
+
+const ALString IndexedHeap::GetClassLabel() const
+{
+	return "Indexed heap";
+}
+
+void IndexedHeap::Test()
+{
+	IndexedHeap heapTest;
+	SortedList slReference(SampleObjectCompare);
+	ObjectArray oaElements;
+	ObjectArray oaElementHeapPositions;
+	ObjectArray oaElementListPositions;
+	SampleObject* soElement;
+	SampleObject* soHeadElement;
+	POSITION position;
+	int nElementNumber;
+	int nOperationNumber;
+	int nOperation;
+	int nElement;
+	int nErrorNumber;
+	int nStartClock;
+	int nStopClock;
+
+	// Parametrage des tests
+	nElementNumber = AcquireRangedInt("Nombre d'elements", 1, 10000000, 1000);
+	nOperationNumber = AcquireRangedInt("Nombre d'operations aleatoires", 0, 100000000, 100000);
+
+	// Creation des elements
+	cout << "Creation des elements" << endl;
+	SetRandomSeed(1);
+	oaElements.SetSize(nElementNumber);
+	oaElementHeapPositions.SetSize(nElementNumber);
+	oaElementListPositions.SetSize(nElementNumber);
+	for (nElement = 0; nElement < nElementNumber; nElement++)
+	{
+		soElement = new SampleObject;
+		soElement->SetInt(nElement);
+		soElement->SetString(IntToString(nElement));
+		oaElements.SetAt(nElement, soElement);
+	}
+
+	// Test des fonctionnalites de base
+	cout << "Test des fonctionnalites de base" << endl;
+	heapTest.SetCompareFunction(SampleObjectCompare);
+	for (nElement = nElementNumber - 1; nElement >= 0; nElement--)
+		heapTest.Add(oaElements.GetAt(nElement));
+	cout << "\tCount: " << heapTest.GetCount() << endl;
+	cout << "\tCheck: " << heapTest.Check() << endl;
+	cout << "\tHead: " << *heapTest.GetHead() << endl;
+	nErrorNumber = 0;
+	for (nElement = 0; nElement < nElementNumber; nElement++)
+	{
+		if (heapTest.RemoveHead() != oaElements.GetAt(nElement))
+			nErrorNumber++;
+	}
+	cout << "\tRemove head errors: " << nErrorNumber << endl;
+	cout << "\tEmpty: " << heapTest.IsEmpty() << endl;
+
+	// Test de coherence avec une liste triee, pour des operations aleatoires d'ajout, de suppression
+	// et de modification des elements
+	// Les elements ont des cles distinctes, pour que les deux structures aient le meme premier element
+	cout << "Test de coherence avec SortedList" << endl;
+	nStartClock = clock();
+	nErrorNumber = 0;
+	for (nOperation = 0; nOperation < nOperationNumber; nOperation++)
+	{
+		nElement = RandomInt(nElementNumber - 1);
+		soElement = cast(SampleObject*, oaElements.GetAt(nElement));
+
+		// Ajout d'un element absent
+		if (oaElementHeapPositions.GetAt(nElement) == NULL)
+		{
+			oaElementHeapPositions.SetAt(nElement, (Object*)heapTest.Add(soElement));
+			oaElementListPositions.SetAt(nElement, (Object*)slReference.Add(soElement));
+		}
+		// Suppression d'un element present
+		else if (RandomDouble() < 0.5)
+		{
+			heapTest.RemoveAt((POSITION)oaElementHeapPositions.GetAt(nElement));
+			slReference.RemoveAt((POSITION)oaElementListPositions.GetAt(nElement));
+			oaElementHeapPositions.SetAt(nElement, NULL);
+			oaElementListPositions.SetAt(nElement, NULL);
+		}
+		// Modification de la valeur d'un element present, en gardant des valeurs distinctes
+		else
+		{
+			slReference.RemoveAt((POSITION)oaElementListPositions.GetAt(nElement));
+			if (soElement->GetInt() % 2 == 0)
+				soElement->SetInt(soElement->GetInt() + 2 * nElementNumber + 1);
+			else
+				soElement->SetInt(soElement->GetInt() - 2 * nElementNumber - 1);
+			heapTest.UpdateAt((POSITION)oaElementHeapPositions.GetAt(nElement));
+			oaElementListPositions.SetAt(nElement, (Object*)slReference.Add(soElement));
+		}
+
+		// Comparaison des premiers elements
+		if (heapTest.GetCount() != slReference.GetCount())
+			nErrorNumber++;
+		else if (not heapTest.IsEmpty())
+		{
+			soHeadElement = cast(SampleObject*, heapTest.GetHead());
+			if (soHeadElement != slReference.GetHead())
+				nErrorNumber++;
+			position = (POSITION)oaElementHeapPositions.GetAt(StringToInt(soHeadElement->GetString()));
+			if (heapTest.GetAt(position) != soHeadElement)
+				nErrorNumber++;
+		}
+	}
+	nStopClock = clock();
+	cout << "\tCount: " << heapTest.GetCount() << endl;
+	cout << "\tCheck: " << heapTest.Check() << endl;
+	cout << "\tErrors: " << nErrorNumber << endl;
+	cout << "SYS TIME\tIndexedHeap random operations\t"
+	     << SecondsToString((nStopClock - nStartClock) * 1.0 / CLOCKS_PER_SEC) << endl;
+
+	// Nettoyage
+	heapTest.RemoveAll();
+	slReference.RemoveAll();
+	oaElements.DeleteAll();
+}
+
+void IndexedHeap::SwapHeapElements(int nHeapIndex1, int nHeapIndex2)
+{
+	Object* object;
+	int nHandle;
+
+	// Echange des elements
+	object = oaHeapElements.GetAt(nHeapIndex1);
+	oaHeapElements.SetAt(nHeapIndex1, oaHeapElements.GetAt(nHeapIndex2));
+	oaHeapElements.SetAt(nHeapIndex2, object);
+
+	// Echange de leur identifiant
+	nHandle = ivHeapHandles.GetAt(nHeapIndex1);
+	ivHeapHandles.SetAt(nHeapIndex1, ivHeapHandles.GetAt(nHeapIndex2));
+	ivHeapHandles.SetAt(nHeapIndex2, nHandle);
+
+	// Mise a jour de leur index dans le tas
+	ivHandleHeapIndexes.SetAt(ivHeapHandles.GetAt(nHeapIndex1), nHeapIndex1);
+	ivHandleHeapIndexes.SetAt(ivHeapHandles.GetAt(nHeapIndex2), nHeapIndex2);
+}
+
+int IndexedHeap::SiftUp(int nHeapIndex)
+{
+	int nParentHeapIndex;
+
+	require(0 <= nHeapIndex and nHeapIndex < oaHeapElements.GetSize());
+
+	while (nHeapIndex > 0)
+	{
+		nParentHeapIndex = (nHeapIndex - 1) / nArity;
+		if (CompareHeapElements(nHeapIndex, nParentHeapIndex) >= 0)
+			break;
+		SwapHeapElements(nHeapIndex, nParentHeapIndex);
+		nHeapIndex = nParentHeapIndex;
+	}
+	return nHeapIndex;
+}
+
+int IndexedHeap::SiftDown(int nHeapIndex)
+{
+	int nFirstChildHeapIndex;
+	int nLastChildHeapIndex;
+	int nChildHeapIndex;
+	int nMinChildHeapIndex;
+
+	require(0 <= nHeapIndex and nHeapIndex < oaHeapElements.GetSize());
+
+	nFirstChildHeapIndex = nArity * nHeapIndex + 1;
+	while (nFirstChildHeapIndex < oaHeapElements.GetSize())
+	{
+		// Recherche du plus petit fils
+		nLastChildHeapIndex = min(nFirstChildHeapIndex + nArity, oaHeapElements.GetSize()) - 1;
+		nMinChildHeapIndex = nFirstChildHeapIndex;
+		for (nChildHeapIndex = nFirstChildHeapIndex + 1; nChildHeapIndex <= nLastChildHeapIndex;
+		     nChildHeapIndex++)
+		{
+			if (CompareHeapElements(nChildHeapIndex, nMinChildHeapIndex) < 0)
+				nMinChildHeapIndex = nChildHeapIndex;
+		}
+
+		// Arret si l'element est plus petit que son plus petit fils
+		if (CompareHeapElements(nHeapIndex, nMinChildHeapIndex) <= 0)
+			break;
+		SwapHeapElements(nHeapIndex, nMinChildHeapIndex);
+		nHeapIndex = nMinChildHeapIndex;
+		nFirstChildHeapIndex = nArity * nHeapIndex + 1;
+	}
+	return nHeapIndex;
+}
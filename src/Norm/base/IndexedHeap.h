@@ -0,0 +1,200 @@
+// Copyright (c) 2023-2026 Orange. All rights reserved.
+// This software is distributed under the BSD 3-Clause-clear License, the text of which is available
+// at https://spdx.org/licenses/BSD-3-Clause-Clear.html or see the "LICENSE" file for more details.
+
+#pragma once
+
+#include "Object.h"
+#include "Vector.h"
+
+class IndexedHeap;
+
+///////////////////////////////////////////////////////
+// Classe IndexedHeap
+// File de priorite indexee, permettant d'acceder a tout moment au plus petit element
+// selon une fonction de comparaison
+// Alternative a SortedList pour les files de candidats des algorithmes d'optimisation gloutons,
+// quand on a seulement besoin d'acceder au meilleur element et de supprimer des elements quelconques:
+//  . tas d-aire (d=4) stocke dans un tableau contigu, sans allocation par element
+//  . chaque element ajoute est identifie par une position, valide jusqu'a sa suppression,
+//    permettant de le supprimer ou de le repositionner apres modification de sa valeur
+//  . insertion, suppression et repositionnement en O(log(n)), acces au premier element en O(1)
+//
+// Contrairement a SortedList, il n'y a pas de parcours ordonne des elements, et l'ordre entre elements
+// egaux est quelconque: il faut une fonction de comparaison definissant un ordre total pour garantir
+// la reproductibilite des resultats
+//
+// Memoire
+//   Les objets n'appartiennent pas au tas: leur liberation
+//   n'est pas geree par cette classe
+class IndexedHeap : public Object
+{
+public:
+	// Constructeur
+	IndexedHeap();
+	~IndexedHeap();
+
+	// Constructeur avec parametrage de la fonction de comparaison
+	IndexedHeap(CompareFunction fCompare);
+
+	// Parametrage de la fonction de comparaison, uniquement si le tas est vide
+	void SetCompareFunction(CompareFunction fCompare);
+
+	// Acces a la fonction de comparaison
+	CompareFunction GetCompareFunction() const;
+
+	// Nombre d'elements
+	int GetCount() const;
+	boolean IsEmpty() const;
+
+	// Premier element, selon la fonction de comparaison (sur un tas non vide)
+	Object* GetHead() const;
+
+	// Supression du premier element (qui est renvoye)
+	Object* RemoveHead();
+
+	// Ajout d'un element
+	// Sa position dans le tas est renvoyee
+	POSITION Add(Object* object);
+
+	// Recherche d'un element a une position (non NULL) donnee
+	Object* GetAt(POSITION position) const;
+
+	// Supression d'un element a une position donnee
+	void RemoveAt(POSITION position);
+
+	// Repositionnement d'un element dans le tas suite a la modification de sa valeur
+	// La position de l'element reste inchangee
+	void UpdateAt(POSITION position);
+
+	// Supression de tous les elements
+	void RemoveAll();
+	void DeleteAll(); // Destruction des elements eux-meme
+
+	////////////////////////////////////////////////
+	// Services divers
+
+	// Conversion vers un tableau, dans un ordre quelconque
+	// Memoire: le contenu precedent du container resultat n'est plus reference (mais pas detruit)
+	void ExportObjectArray(ObjectArray* oaResult) const;
+
+	// Verification de l'integrite du tas
+	boolean Check() const override;
+
+	// Affichage, des elements dans l'ordre du tas
+	void Write(ostream& ost) const override;
+
+	// Estimation de la memoire utilisee
+	longint GetUsedMemory() const override;
+
+	// Estimation de la memoire utilisee avec prise en compte des objet contenus
+	longint GetOverallUsedMemory() const;
+
+	// Estimation de la memoire utilisee par element, pour le dimensionnement a prior des containers
+	longint GetUsedMemoryPerElement() const;
+
+	// Libelle de la classe
+	const ALString GetClassLabel() const override;
+
+	// Methode de test de la classe
+	static void Test();
+
+	////////////////////////////////////////////////////
+	///// Implementation
+protected:
+	// Comparaison de deux elements du tas
+	int CompareHeapElements(int nHeapIndex1, int nHeapIndex2) const;
+
+	// Echange de deux elements du tas, avec mise a jour de leur index dans le tas
+	void SwapHeapElements(int nHeapIndex1, int nHeapIndex2);
+
+	// Remontee d'un element vers la racine du tas, tant qu'il est plus petit que son parent
+	// Renvoie le nouvel index de l'element
+	int SiftUp(int nHeapIndex);
+
+	// Descente d'un element vers les feuilles du tas, tant qu'il est plus grand que son plus petit fils
+	// Renvoie le nouvel index de l'element
+	int SiftDown(int nHeapIndex);
+
+	// Conversion entre position et index d'identifiant d'element
+	static POSITION HandleToPosition(int nHandle);
+	static int PositionToHandle(POSITION position);
+
+	// Elements ranges selon l'ordre du tas
+	ObjectArray oaHeapElements;
+
+	// Identifiant de chaque element du tas, par index dans le tas
+	IntVector ivHeapHandles;
+
+	// Index dans le tas de chaque identifiant d'element (-1 si identifiant non utilise)
+	IntVector ivHandleHeapIndexes;
+
+	// Identifiants libres, reutilisables pour les nouveaux elements
+	IntVector ivFreeHandles;
+
+	// Fonction de comparaison
+	CompareFunction fCompareFunction;
+
+	// Arite du tas
+	static const int nArity = 4;
+};
+
+////////////////////////////////////////////////////////////////////
+// Methodes en inline
+
+inline CompareFunction IndexedHeap::GetCompareFunction() const
+{
+	return fCompareFunction;
+}
+
+inline int IndexedHeap::GetCount() const
+{
+	return oaHeapElements.GetSize();
+}
+
+inline boolean IndexedHeap::IsEmpty() const
+{
+	return oaHeapElements.GetSize() == 0;
+}
+
+inline Object* IndexedHeap::GetHead() const
+{
+	require(not IsEmpty());
+	return oaHeapElements.GetAt(0);
+}
+
+inline Object* IndexedHeap::GetAt(POSITION position) const
+{
+	int nHandle;
+
+	require(position != NULL);
+
+	nHandle = PositionToHandle(position);
+	require(0 <= nHandle and nHandle < ivHandleHeapIndexes.GetSize());
+	require(ivHandleHeapIndexes.GetAt(nHandle) != -1);
+	return oaHeapElements.GetAt(ivHandleHeapIndexes.GetAt(nHandle));
+}
+
+inline int IndexedHeap::CompareHeapElements(int nHeapIndex1, int nHeapIndex2) const
+{
+	Object* object1;
+	Object* object2;
+
+	require(fCompareFunction != NULL);
+
+	object1 = oaHeapElements.GetAt(nHeapIndex1);
+	object2 = oaHeapElements.GetAt(nHeapIndex2);
+	return fCompareFunction(&object1, &object2);
+}
+
+inline POSITION IndexedHeap::HandleToPosition(int nHandle)
+{
+	require(nHandle >= 0);
+	return (POSITION)(longint)(nHandle + 1);
+}
+
+inline int IndexedHeap::PositionToHandle(POSITION position)
+{
+	require(position != NULL);
+	return (int)((longint)position - 1);
+}
@@ -0,0 +1,1918 @@
+// Copyright (c) 2023-2026 Orange. All rights reserved.
+// This software is distributed under the BSD 3-Clause-clear License, the text of which is available
+// at https://spdx.org/licenses/BSD-3-Clause-Clear.html or see the "LICENSE" file for more details.
+
+#include "RegexAutomaton.h"
+
+RegexAutomaton::RegexAutomaton()
+{
+	nParsePos = 0;
+	nGroupNumber = 0;
+	bCaptureGroupRepeated = false;
+	nClassNumber = 0;
+	bFirstCharsUsed = false;
+	currentThreads = new RegexAutomatonThreadList;
+	nextThreads = new RegexAutomatonThreadList;
+	matchDFA = new RegexAutomatonDFA;
+	searchDFA = new RegexAutomatonDFA;
+	reverseDFA = new RegexAutomatonDFA;
+	bDFAUsed = false;
+	nUsedSlotNumber = 0;
+	nCurrentSearchStart = 0;
+	bCurrentPrevAvail = false;
+}
+
+RegexAutomaton::~RegexAutomaton()
+{
+	delete currentThreads;
+	delete nextThreads;
+	delete matchDFA;
+	delete searchDFA;
+	delete reverseDFA;
+}
+
+boolean RegexAutomaton::Compile(const char* sRegexValue)
+{
+	boolean bOk;
+	RegexAutomatonNode* rootNode;
+	int nSlotNumber;
+	int nInstruction;
+
+	require(sRegexValue != NULL);
+
+	// Nettoyage prealable
+	Clean();
+
+	// Analyse syntaxique de l'expression
+	sRegex = sRegexValue;
+	nParsePos = 0;
+	rootNode = ParseAlternation();
+	bOk = rootNode != NULL and nParsePos == sRegex.GetLength();
+
+	// Verification des contraintes sur l'expression
+	if (bOk)
+		bOk = CheckNode(rootNode, false);
+
+	// Generation du programme, encadre par la capture des positions de debut et de fin d'occurrence
+	if (bOk)
+	{
+		EmitInstruction(false, OpSave, 0, 0);
+		bOk = EmitNode(rootNode, false);
+		EmitInstruction(false, OpSave, 1, 0);
+		EmitInstruction(false, OpMatch, 0, 0);
+		bOk = bOk and ivOpcodes.GetSize() <= nMaxInstructionNumber;
+	}
+
+	// Generation du programme inverse pour les automates deterministes, qui ne gerent pas
+	// les assertions de frontiere de mot
+	if (bOk)
+	{
+		bDFAUsed = true;
+		for (nInstruction = 0; nInstruction < ivOpcodes.GetSize(); nInstruction++)
+		{
+			if (ivOpcodes.GetAt(nInstruction) == OpWordBoundary or
+			    ivOpcodes.GetAt(nInstruction) == OpNotWordBoundary)
+				bDFAUsed = false;
+		}
+		if (bDFAUsed)
+		{
+			bDFAUsed = EmitNode(rootNode, true);
+			EmitInstruction(true, OpMatch, 0, 0);
+			bDFAUsed = bDFAUsed and ivReverseOpcodes.GetSize() <= nMaxInstructionNumber;
+		}
+		if (not bDFAUsed)
+		{
+			ivReverseOpcodes.SetSize(0);
+			ivReverseArgs1.SetSize(0);
+			ivReverseArgs2.SetSize(0);
+		}
+	}
+	if (rootNode != NULL)
+		delete rootNode;
+
+	// Finalisation de l'automate
+	if (bOk)
+	{
+		ComputeFirstChars();
+
+		// Dimensionnement des structures de simulation
+		nSlotNumber = 2 * (nGroupNumber + 1);
+		currentThreads->Initialize(ivOpcodes.GetSize(), nSlotNumber);
+		nextThreads->Initialize(ivOpcodes.GetSize(), nSlotNumber);
+		ivThreadStack.SetSize(2 * (ivOpcodes.GetSize() + 1));
+		ivWorkSlots.SetSize(nSlotNumber);
+		ivMatchSlots.SetSize(nSlotNumber);
+
+		// Initialisation des automates deterministes
+		if (bDFAUsed)
+		{
+			matchDFA->Initialize(this, false, false, false);
+			searchDFA->Initialize(this, false, true, true);
+			reverseDFA->Initialize(this, true, false, false);
+		}
+	}
+	// Nettoyage si echec
+	else
+		Clean();
+	ensure(bOk == IsCompiled());
+	return bOk;
+}
+
+void RegexAutomaton::Clean()
+{
+	sRegex = "";
+	nParsePos = 0;
+	nGroupNumber = 0;
+	bCaptureGroupRepeated = false;
+	ivOpcodes.SetSize(0);
+	ivArgs1.SetSize(0);
+	ivArgs2.SetSize(0);
+	ivReverseOpcodes.SetSize(0);
+	ivReverseArgs1.SetSize(0);
+	ivReverseArgs2.SetSize(0);
+	matchDFA->Clean();
+	searchDFA->Clean();
+	reverseDFA->Clean();
+	bDFAUsed = false;
+	cvClassChars.SetSize(0);
+	nClassNumber = 0;
+	cvFirstChars.SetSize(0);
+	bFirstCharsUsed = false;
+	currentThreads->Initialize(0, 0);
+	nextThreads->Initialize(0, 0);
+	ivThreadStack.SetSize(0);
+	ivWorkSlots.SetSize(0);
+	ivMatchSlots.SetSize(0);
+}
+
+boolean RegexAutomaton::Match(const char* sValue, int nLength)
+{
+	int nMatchEnd;
+
+	require(IsCompiled());
+	require(sValue != NULL);
+	require(nLength >= 0);
+
+	// Utilisation de l'automate deterministe si possible
+	if (bDFAUsed)
+	{
+		nMatchEnd = matchDFA->Scan(sValue, 0, nLength, true, true);
+		if (nMatchEnd != -2)
+			return nMatchEnd == nLength;
+	}
+	return Execute(sValue, nLength, 0, true, true, false, false, 2);
+}
+
+boolean RegexAutomaton::Search(const char* sValue, int nLength, int& nMatchStart, int& nMatchEnd)
+{
+	boolean bFound;
+
+	require(IsCompiled());
+	require(sValue != NULL);
+	require(nLength >= 0);
+
+	bFound = ExecuteSearch(sValue, nLength, 0, false, 2);
+	if (bFound)
+	{
+		nMatchStart = ivMatchSlots.GetAt(0);
+		nMatchEnd = ivMatchSlots.GetAt(1);
+	}
+	else
+	{
+		nMatchStart = -1;
+		nMatchEnd = -1;
+	}
+	return bFound;
+}
+
+void RegexAutomaton::ReplaceAll(const char* sValue, int nLength, const char* sFormat, ALString& sResult)
+{
+	boolean bFound;
+	boolean bPrevAvail;
+	int nSlotNumber;
+	int nPrefixStart;
+	int nSearchStart;
+	int nMatchStart;
+	int nMatchEnd;
+	int i;
+
+	require(IsCompiled());
+	require(sValue != NULL);
+	require(nLength >= 0);
+	require(sFormat != NULL);
+
+	// On ne memorise les captures des groupes que s'ils sont references dans le format
+	nSlotNumber = 2;
+	for (i = 0; sFormat[i] != '\0'; i++)
+	{
+		if (sFormat[i] == '$' and isdigit((unsigned char)sFormat[i + 1]))
+		{
+			nSlotNumber = 2 * (nGroupNumber + 1);
+			break;
+		}
+	}
+
+	// Parcours des occurrences successives, selon la meme strategie que std::regex_iterator,
+	// en particulier pour le traitement des occurrences vides
+	nPrefixStart = 0;
+	bPrevAvail = false;
+	bFound = ExecuteSearch(sValue, nLength, 0, false, nSlotNumber);
+	while (bFound)
+	{
+		nMatchStart = ivMatchSlots.GetAt(0);
+		nMatchEnd = ivMatchSlots.GetAt(1);
+
+		// Remplacement de l'occurrence trouvee
+		AppendBuffer(sResult, sValue + nPrefixStart, nMatchStart - nPrefixStart);
+		AppendFormat(sValue, nLength, sFormat, nPrefixStart, sResult);
+		nPrefixStart = nMatchEnd;
+
+		// Position de la recherche suivante
+		nSearchStart = nMatchEnd;
+		if (nMatchStart == nMatchEnd)
+		{
+			// Arret si occurrence vide en fin de chaine
+			if (nMatchEnd == nLength)
+				break;
+
+			// Recherche d'une occurrence non vide debutant a la meme position
+			bFound = Execute(sValue, nLength, nMatchEnd, true, false, true, bPrevAvail, nSlotNumber);
+			if (bFound)
+				continue;
+
+			// Sinon, on passe au caractere suivant
+			nSearchStart++;
+		}
+		bPrevAvail = true;
+		bFound = ExecuteSearch(sValue, nLength, nSearchStart, true, nSlotNumber);
+	}
+
+	// Ajout de la fin de la chaine
+	AppendBuffer(sResult, sValue + nPrefixStart, nLength - nPrefixStart);
+}
+
+longint RegexAutomaton::GetUsedMemory() const
+{
+	longint lUsedMemory;
+
+	lUsedMemory = sizeof(RegexAutomaton);
+	lUsedMemory += sRegex.GetAllocLength();
+	lUsedMemory += ivOpcodes.GetUsedMemory() - sizeof(IntVector);
+	lUsedMemory += ivArgs1.GetUsedMemory() - sizeof(IntVector);
+	lUsedMemory += ivArgs2.GetUsedMemory() - sizeof(IntVector);
+	lUsedMemory += ivReverseOpcodes.GetUsedMemory() - sizeof(IntVector);
+	lUsedMemory += ivReverseArgs1.GetUsedMemory() - sizeof(IntVector);
+	lUsedMemory += ivReverseArgs2.GetUsedMemory() - sizeof(IntVector);
+	lUsedMemory += matchDFA->GetUsedMemory();
+	lUsedMemory += searchDFA->GetUsedMemory();
+	lUsedMemory += reverseDFA->GetUsedMemory();
+	lUsedMemory += cvClassChars.GetUsedMemory() - sizeof(CharVector);
+	lUsedMemory += cvFirstChars.GetUsedMemory() - sizeof(CharVector);
+	lUsedMemory += currentThreads->GetUsedMemory();
+	lUsedMemory += nextThreads->GetUsedMemory();
+	lUsedMemory += ivThreadStack.GetUsedMemory() - sizeof(IntVector);
+	lUsedMemory += ivWorkSlots.GetUsedMemory() - sizeof(IntVector);
+	lUsedMemory += ivMatchSlots.GetUsedMemory() - sizeof(IntVector);
+	return lUsedMemory;
+}
+
+void RegexAutomaton::Write(ostream& ost) const
+{
+	int nInstruction;
+
+	ost << GetClassLabel() << " " << GetObjectLabel() << "\n";
+	for (nInstruction = 0; nInstruction < ivOpcodes.GetSize(); nInstruction++)
+	{
+		ost << nInstruction << "\t";
+		switch (ivOpcodes.GetAt(nInstruction))
+		{
+		case OpChar:
+			ost << "Char\t" << (char)ivArgs1.GetAt(nInstruction);
+			break;
+		case OpClass:
+			ost << "Class\t" << ivArgs1.GetAt(nInstruction);
+			break;
+		case OpSplit:
+			ost << "Split\t" << ivArgs1.GetAt(nInstruction) << "\t" << ivArgs2.GetAt(nInstruction);
+			break;
+		case OpJump:
+			ost << "Jump\t" << ivArgs1.GetAt(nInstruction);
+			break;
+		case OpSave:
+			ost << "Save\t" << ivArgs1.GetAt(nInstruction);
+			break;
+		case OpLineBegin:
+			ost << "LineBegin";
+			break;
+		case OpLineEnd:
+			ost << "LineEnd";
+			break;
+		case OpWordBoundary:
+			ost << "WordBoundary";
+			break;
+		case OpNotWordBoundary:
+			ost << "NotWordBoundary";
+			break;
+		case OpMatch:
+			ost << "Match";
+			break;
+		}
+		ost << "\n";
+	}
+}
+
+const ALString RegexAutomaton::GetClassLabel() const
+{
+	return "Regex automaton";
+}
+
+const ALString RegexAutomaton::GetObjectLabel() const
+{
+	return sRegex;
+}
+
+RegexAutomatonNode* RegexAutomaton::ParseAlternation()
+{
+	RegexAutomatonNode* node;
+	RegexAutomatonNode* alternationNode;
+
+	// Analyse de la premiere alternative
+	node = ParseConcatenation();
+
+	// Analyse des alternatives suivantes
+	if (node != NULL and nParsePos < sRegex.GetLength() and sRegex.GetAt(nParsePos) == '|')
+	{
+		alternationNode = new RegexAutomatonNode;
+		alternationNode->nType = RegexAutomatonNode::Alternation;
+		alternationNode->oaChildren.Add(node);
+		while (node != NULL and nParsePos < sRegex.GetLength() and sRegex.GetAt(nParsePos) == '|')
+		{
+			nParsePos++;
+			node = ParseConcatenation();
+			if (node != NULL)
+				alternationNode->oaChildren.Add(node);
+		}
+
+		// Nettoyage si echec
+		if (node == NULL)
+			delete alternationNode;
+		else
+			node = alternationNode;
+	}
+	return node;
+}
+
+RegexAutomatonNode* RegexAutomaton::ParseConcatenation()
+{
+	RegexAutomatonNode* concatenationNode;
+	RegexAutomatonNode* node;
+	char c;
+
+	// Analyse des elements jusqu'a la fin de l'alternative ou du groupe en cours
+	concatenationNode = new RegexAutomatonNode;
+	concatenationNode->nType = RegexAutomatonNode::Concatenation;
+	while (nParsePos < sRegex.GetLength())
+	{
+		c = sRegex.GetAt(nParsePos);
+		if (c == '|' or c == ')')
+			break;
+		node = ParseRepetition();
+		if (node == NULL)
+		{
+			delete concatenationNode;
+			return NULL;
+		}
+		concatenationNode->oaChildren.Add(node);
+	}
+
+	// Simplification dans le cas d'une expression vide ou a un seul element
+	if (concatenationNode->oaChildren.GetSize() == 0)
+		concatenationNode->nType = RegexAutomatonNode::Empty;
+	else if (concatenationNode->oaChildren.GetSize() == 1)
+	{
+		node = cast(RegexAutomatonNode*, concatenationNode->oaChildren.GetAt(0));
+		concatenationNode->oaChildren.RemoveAll();
+		delete concatenationNode;
+		concatenationNode = node;
+	}
+	return concatenationNode;
+}
+
+RegexAutomatonNode* RegexAutomaton::ParseRepetition()
+{
+	RegexAutomatonNode* node;
+	RegexAutomatonNode* repetitionNode;
+	int nMin;
+	int nMax;
+	char c;
+
+	// Analyse de l'element a repeter
+	node = ParseAtom();
+	if (node == NULL or nParsePos >= sRegex.GetLength())
+		return node;
+
+	// Analyse du quantificateur
+	c = sRegex.GetAt(nParsePos);
+	if (c != '*' and c != '+' and c != '?' and c != '{')
+		return node;
+	nMin = -1;
+	nMax = -1;
+	nParsePos++;
+	if (c == '*')
+		nMin = 0;
+	else if (c == '+')
+		nMin = 1;
+	else if (c == '?')
+	{
+		nMin = 0;
+		nMax = 1;
+	}
+	else
+	{
+		nMin = ParseQuantifierValue();
+		nMax = nMin;
+		if (nParsePos < sRegex.GetLength() and sRegex.GetAt(nParsePos) == ',')
+		{
+			nParsePos++;
+			nMax = ParseQuantifierValue();
+		}
+		if (nParsePos >= sRegex.GetLength() or sRegex.GetAt(nParsePos) != '}')
+			nMin = -1;
+		nParsePos++;
+		if (nMax != -1 and nMax < nMin)
+			nMin = -1;
+	}
+
+	// Echec si quantificateur invalide ou portant sur une assertion
+	if (nMin == -1 or node->nType == RegexAutomatonNode::LineBegin or
+	    node->nType == RegexAutomatonNode::LineEnd or node->nType == RegexAutomatonNode::WordBoundary or
+	    node->nType == RegexAutomatonNode::NotWordBoundary)
+	{
+		delete node;
+		return NULL;
+	}
+
+	// Creation du noeud de repetition
+	repetitionNode = new RegexAutomatonNode;
+	repetitionNode->nType = RegexAutomatonNode::Repetition;
+	repetitionNode->nMin = nMin;
+	repetitionNode->nMax = nMax;
+	repetitionNode->oaChildren.Add(node);
+
+	// Repetition paresseuse
+	if (nParsePos < sRegex.GetLength() and sRegex.GetAt(nParsePos) == '?')
+	{
+		repetitionNode->bGreedy = false;
+		nParsePos++;
+	}
+
+	// Echec si plusieurs quantificateurs consecutifs
+	if (nParsePos < sRegex.GetLength())
+	{
+		c = sRegex.GetAt(nParsePos);
+		if (c == '*' or c == '+' or c == '?' or c == '{')
+		{
+			delete repetitionNode;
+			return NULL;
+		}
+	}
+	return repetitionNode;
+}
+
+RegexAutomatonNode* RegexAutomaton::ParseAtom()
+{
+	RegexAutomatonNode* node;
+	RegexAutomatonNode* childNode;
+	boolean bCapture;
+	int nClass;
+	int i;
+	char c;
+
+	require(nParsePos < sRegex.GetLength());
+
+	node = NULL;
+	c = sRegex.GetAt(nParsePos);
+	switch (c)
+	{
+	// Groupe
+	case '(':
+		nParsePos++;
+
+		// Seuls les groupes capturants et non capturants sont supportes
+		bCapture = true;
+		if (nParsePos < sRegex.GetLength() and sRegex.GetAt(nParsePos) == '?')
+		{
+			if (nParsePos + 1 < sRegex.GetLength() and sRegex.GetAt(nParsePos + 1) == ':')
+			{
+				bCapture = false;
+				nParsePos += 2;
+			}
+			else
+				return NULL;
+		}
+
+		// Creation du groupe capturant avant d'analyser son contenu, pour respecter la numerotation des groupes
+		if (bCapture)
+		{
+			node = new RegexAutomatonNode;
+			node->nType = RegexAutomatonNode::Group;
+			nGroupNumber++;
+			node->nValue = nGroupNumber;
+		}
+
+		// Analyse du contenu du groupe
+		childNode = ParseAlternation();
+		if (childNode == NULL or nParsePos >= sRegex.GetLength() or sRegex.GetAt(nParsePos) != ')')
+		{
+			if (childNode != NULL)
+				delete childNode;
+			if (node != NULL)
+				delete node;
+			return NULL;
+		}
+		nParsePos++;
+		if (node != NULL)
+			node->oaChildren.Add(childNode);
+		else
+			node = childNode;
+		break;
+	// Classe de caracteres
+	case '[':
+		node = ParseClass();
+		break;
+	// Tout caractere sauf les fins de ligne
+	case '.':
+		nParsePos++;
+		nClass = NewClass();
+		for (i = 0; i < 256; i++)
+		{
+			if (i != '\n' and i != '\r')
+				cvClassChars.SetAt(nClass * 256 + i, 1);
+		}
+		node = new RegexAutomatonNode;
+		node->nType = RegexAutomatonNode::Class;
+		node->nValue = nClass;
+		break;
+	// Assertions
+	case '^':
+		nParsePos++;
+		node = new RegexAutomatonNode;
+		node->nType = RegexAutomatonNode::LineBegin;
+		break;
+	case '$':
+		nParsePos++;
+		node = new RegexAutomatonNode;
+		node->nType = RegexAutomatonNode::LineEnd;
+		break;
+	// Sequence d'echappement
+	case '\\':
+		node = ParseEscape();
+		break;
+	// Caracteres speciaux non supportes en debut d'element
+	case '*':
+	case '+':
+	case '?':
+	case '{':
+	case '}':
+	case ']':
+	case ')':
+	case '|':
+		break;
+	// Caractere litteral
+	default:
+		nParsePos++;
+		node = new RegexAutomatonNode;
+		node->nType = RegexAutomatonNode::Char;
+		node->nValue = (unsigned char)c;
+		break;
+	}
+	return node;
+}
+
+RegexAutomatonNode* RegexAutomaton::ParseEscape()
+{
+	RegexAutomatonNode* node;
+	char c;
+
+	require(nParsePos < sRegex.GetLength() and sRegex.GetAt(nParsePos) == '\\');
+
+	// Caractere echappe
+	nParsePos++;
+	if (nParsePos >= sRegex.GetLength())
+		return NULL;
+	c = sRegex.GetAt(nParsePos);
+	nParsePos++;
+
+	// Creation du noeud selon le caractere echappe
+	node = new RegexAutomatonNode;
+	node->nType = RegexAutomatonNode::Char;
+	switch (c)
+	{
+	case 'd':
+	case 'D':
+	case 'w':
+	case 'W':
+	case 's':
+	case 'S':
+		node->nType = RegexAutomatonNode::Class;
+		node->nValue = NewClass();
+		AddClassName(node->nValue, c);
+		break;
+	case 'b':
+		node->nType = RegexAutomatonNode::WordBoundary;
+		break;
+	case 'B':
+		node->nType = RegexAutomatonNode::NotWordBoundary;
+		break;
+	case 't':
+		node->nValue = '\t';
+		break;
+	case 'n':
+		node->nValue = '\n';
+		break;
+	case 'r':
+		node->nValue = '\r';
+		break;
+	case 'f':
+		node->nValue = '\f';
+		break;
+	case 'v':
+		node->nValue = '\v';
+		break;
+	default:
+		// Les autres sequences alphanumeriques (references arriere, codes hexadecimaux...) ne sont pas supportees
+		if (IsWordChar(c) or (unsigned char)c >= 128)
+		{
+			delete node;
+			node = NULL;
+		}
+		// Caractere special echappe
+		else
+			node->nValue = (unsigned char)c;
+		break;
+	}
+	return node;
+}
+
+RegexAutomatonNode* RegexAutomaton::ParseClass()
+{
+	RegexAutomatonNode* node;
+	boolean bNegated;
+	boolean bRangeOrClassName;
+	int nClass;
+	int nFirstChar;
+	int nLastChar;
+	char cClassName;
+	int i;
+
+	require(nParsePos < sRegex.GetLength() and sRegex.GetAt(nParsePos) == '[');
+
+	// Negation de la classe
+	nParsePos++;
+	bNegated = false;
+	if (nParsePos < sRegex.GetLength() and sRegex.GetAt(nParsePos) == '^')
+	{
+		bNegated = true;
+		nParsePos++;
+	}
+
+	// Les classes vides ou commencant par ']' ne sont pas supportees
+	if (nParsePos >= sRegex.GetLength() or sRegex.GetAt(nParsePos) == ']')
+		return NULL;
+
+	// Analyse des elements de la classe
+	nClass = NewClass();
+	while (true)
+	{
+		if (nParsePos >= sRegex.GetLength())
+			return NULL;
+
+		// Fin de la classe
+		if (sRegex.GetAt(nParsePos) == ']')
+		{
+			nParsePos++;
+			break;
+		}
+
+		// Analyse d'un caractere ou d'une classe predefinie
+		nFirstChar = ParseClassChar(cClassName);
+		if (nFirstChar == -1)
+			return NULL;
+
+		// Cas d'une classe predefinie
+		bRangeOrClassName = true;
+		if (nFirstChar == -2)
+			AddClassName(nClass, cClassName);
+		// Cas d'une plage de caracteres, en se limitant aux caracteres ASCII dont l'ordre est non ambigu
+		else if (nParsePos + 1 < sRegex.GetLength() and sRegex.GetAt(nParsePos) == '-' and
+			 sRegex.GetAt(nParsePos + 1) != ']')
+		{
+			nParsePos++;
+			nLastChar = ParseClassChar(cClassName);
+			if (nLastChar < 0 or nFirstChar >= 128 or nLastChar >= 128 or nLastChar < nFirstChar)
+				return NULL;
+			for (i = nFirstChar; i <= nLastChar; i++)
+				cvClassChars.SetAt(nClass * 256 + i, 1);
+		}
+		// Cas d'un caractere
+		else
+		{
+			cvClassChars.SetAt(nClass * 256 + nFirstChar, 1);
+			bRangeOrClassName = false;
+		}
+
+		// Un '-' suivant une plage ou une classe predefinie n'est supporte qu'en fin de classe
+		if (bRangeOrClassName and nParsePos + 1 < sRegex.GetLength() and sRegex.GetAt(nParsePos) == '-' and
+		    sRegex.GetAt(nParsePos + 1) != ']')
+			return NULL;
+	}
+
+	// Negation si necessaire
+	if (bNegated)
+	{
+		for (i = 0; i < 256; i++)
+			cvClassChars.SetAt(nClass * 256 + i, 1 - cvClassChars.GetAt(nClass * 256 + i));
+	}
+
+	// Creation du noeud
+	node = new RegexAutomatonNode;
+	node->nType = RegexAutomatonNode::Class;
+	node->nValue = nClass;
+	return node;
+}
+
+int RegexAutomaton::ParseClassChar(char& cClassName)
+{
+	char c;
+
+	require(nParsePos < sRegex.GetLength());
+
+	// Caractere simple
+	c = sRegex.GetAt(nParsePos);
+	nParsePos++;
+	if (c == '[')
+		return -1;
+	else if (c != '\\')
+		return (unsigned char)c;
+
+	// Caractere echappe
+	if (nParsePos >= sRegex.GetLength())
+		return -1;
+	c = sRegex.GetAt(nParsePos);
+	nParsePos++;
+	switch (c)
+	{
+	case 'd':
+	case 'D':
+	case 'w':
+	case 'W':
+	case 's':
+	case 'S':
+		cClassName = c;
+		return -2;
+	case 't':
+		return '\t';
+	case 'n':
+		return '\n';
+	case 'r':
+		return '\r';
+	case 'f':
+		return '\f';
+	case 'v':
+		return '\v';
+	default:
+		if (IsWordChar(c) or (unsigned char)c >= 128)
+			return -1;
+		else
+			return (unsigned char)c;
+	}
+}
+
+int RegexAutomaton::ParseQuantifierValue()
+{
+	int nValue;
+	char c;
+
+	nValue = -1;
+	while (nParsePos < sRegex.GetLength())
+	{
+		c = sRegex.GetAt(nParsePos);
+		if (not isdigit((unsigned char)c))
+			break;
+		if (nValue == -1)
+			nValue = 0;
+
+		// On borne la valeur, l'automate etant de toute facon limite en taille
+		if (nValue <= nMaxInstructionNumber)
+			nValue = nValue * 10 + c - '0';
+		nParsePos++;
+	}
+	return nValue;
+}
+
+int RegexAutomaton::NewClass()
+{
+	nClassNumber++;
+	cvClassChars.SetSize(nClassNumber * 256);
+	return nClassNumber - 1;
+}
+
+void RegexAutomaton::AddClassName(int nClass, char cClassName)
+{
+	boolean bInClass;
+	char c;
+	int i;
+
+	require(0 <= nClass and nClass < nClassNumber);
+
+	for (i = 0; i < 256; i++)
+	{
+		c = (char)i;
+		if (cClassName == 'd' or cClassName == 'D')
+			bInClass = '0' <= c and c <= '9';
+		else if (cClassName == 'w' or cClassName == 'W')
+			bInClass = IsWordChar(c);
+		else
+		{
+			assert(cClassName == 's' or cClassName == 'S');
+			bInClass = c == ' ' or ('\t' <= c and c <= '\r');
+		}
+
+		// Complementaire pour les classes en majuscules
+		if (isupper(cClassName))
+			bInClass = not bInClass;
+		if (bInClass)
+			cvClassChars.SetAt(nClass * 256 + i, 1);
+	}
+}
+
+boolean RegexAutomaton::CheckNode(const RegexAutomatonNode* node, boolean bInRepetition)
+{
+	boolean bOk = true;
+	boolean bChildInRepetition;
+	int i;
+
+	require(node != NULL);
+
+	// Memorisation de la presence de groupes capturants repetes
+	if (node->nType == RegexAutomatonNode::Group and bInRepetition)
+		bCaptureGroupRepeated = true;
+
+	// Les repetitions de sous-expressions pouvant etre vides ne sont pas supportees: la semantique
+	// ECMAScript rejette les iterations vides, ce qui ne se traduit pas simplement dans l'automate
+	bChildInRepetition = bInRepetition;
+	if (node->nType == RegexAutomatonNode::Repetition)
+	{
+		if (cast(RegexAutomatonNode*, node->oaChildren.GetAt(0))->IsNullable())
+			bOk = false;
+		if (node->nMax != 1)
+			bChildInRepetition = true;
+	}
+
+	// Verification des sous-expressions
+	for (i = 0; i < node->oaChildren.GetSize(); i++)
+	{
+		if (not bOk)
+			break;
+		bOk = CheckNode(cast(RegexAutomatonNode*, node->oaChildren.GetAt(i)), bChildInRepetition);
+	}
+	return bOk;
+}
+
+boolean RegexAutomaton::EmitNode(const RegexAutomatonNode* node, boolean bReverse)
+{
+	boolean bOk = true;
+	const RegexAutomatonNode* childNode;
+	IntVector* ivTargetOpcodes;
+	IntVector* ivTargetArgs1;
+	IntVector* ivTargetArgs2;
+	IntVector ivJumps;
+	int nSplit;
+	int i;
+
+	require(node != NULL);
+
+	// Programme a generer
+	if (bReverse)
+	{
+		ivTargetOpcodes = &ivReverseOpcodes;
+		ivTargetArgs1 = &ivReverseArgs1;
+		ivTargetArgs2 = &ivReverseArgs2;
+	}
+	else
+	{
+		ivTargetOpcodes = &ivOpcodes;
+		ivTargetArgs1 = &ivArgs1;
+		ivTargetArgs2 = &ivArgs2;
+	}
+
+	// Arret si le programme est trop grand
+	if (ivTargetOpcodes->GetSize() > nMaxInstructionNumber)
+		return false;
+
+	// Generation selon le type de noeud
+	switch (node->nType)
+	{
+	case RegexAutomatonNode::Char:
+		EmitInstruction(bReverse, OpChar, node->nValue, 0);
+		break;
+	case RegexAutomatonNode::Class:
+		EmitInstruction(bReverse, OpClass, node->nValue, 0);
+		break;
+	// Les assertions de debut et de fin sont permutees dans le programme inverse
+	case RegexAutomatonNode::LineBegin:
+		EmitInstruction(bReverse, bReverse ? OpLineEnd : OpLineBegin, 0, 0);
+		break;
+	case RegexAutomatonNode::LineEnd:
+		EmitInstruction(bReverse, bReverse ? OpLineBegin : OpLineEnd, 0, 0);
+		break;
+	case RegexAutomatonNode::WordBoundary:
+		EmitInstruction(bReverse, OpWordBoundary, 0, 0);
+		break;
+	case RegexAutomatonNode::NotWordBoundary:
+		EmitInstruction(bReverse, OpNotWordBoundary, 0, 0);
+		break;
+	case RegexAutomatonNode::Empty:
+		break;
+	case RegexAutomatonNode::Concatenation:
+		for (i = 0; i < node->oaChildren.GetSize() and bOk; i++)
+		{
+			if (bReverse)
+				childNode = cast(RegexAutomatonNode*,
+						 node->oaChildren.GetAt(node->oaChildren.GetSize() - 1 - i));
+			else
+				childNode = cast(RegexAutomatonNode*, node->oaChildren.GetAt(i));
+			bOk = EmitNode(childNode, bReverse);
+		}
+		break;
+	// Alternative: chaque alternative est prioritaire sur les suivantes
+	case RegexAutomatonNode::Alternation:
+		for (i = 0; i < node->oaChildren.GetSize() - 1 and bOk; i++)
+		{
+			nSplit = EmitInstruction(bReverse, OpSplit, ivTargetOpcodes->GetSize() + 1, -1);
+			bOk = EmitNode(cast(RegexAutomatonNode*, node->oaChildren.GetAt(i)), bReverse);
+			ivJumps.Add(EmitInstruction(bReverse, OpJump, -1, 0));
+			ivTargetArgs2->SetAt(nSplit, ivTargetOpcodes->GetSize());
+		}
+		if (bOk)
+			bOk = EmitNode(cast(RegexAutomatonNode*, node->oaChildren.GetAt(i)), bReverse);
+		for (i = 0; i < ivJumps.GetSize(); i++)
+			ivTargetArgs1->SetAt(ivJumps.GetAt(i), ivTargetOpcodes->GetSize());
+		break;
+	// Groupe, sans capture dans le programme inverse
+	case RegexAutomatonNode::Group:
+		if (not bReverse)
+			EmitInstruction(bReverse, OpSave, 2 * node->nValue, 0);
+		bOk = EmitNode(cast(RegexAutomatonNode*, node->oaChildren.GetAt(0)), bReverse);
+		if (not bReverse)
+			EmitInstruction(bReverse, OpSave, 2 * node->nValue + 1, 0);
+		break;
+	// Repetition: duplication de la sous-expression pour les iterations obligatoires,
+	// puis boucle pour une repetition infinie, ou iterations optionnelles imbriquees sinon
+	case RegexAutomatonNode::Repetition:
+		childNode = cast(RegexAutomatonNode*, node->oaChildren.GetAt(0));
+		for (i = 0; i < node->nMin and bOk; i++)
+			bOk = EmitNode(childNode, bReverse);
+		if (bOk and node->nMax == -1)
+		{
+			nSplit = EmitInstruction(bReverse, OpSplit, -1, -1);
+			bOk = EmitNode(childNode, bReverse);
+			EmitInstruction(bReverse, OpJump, nSplit, 0);
+			ivJumps.Add(nSplit);
+		}
+		else
+		{
+			for (i = node->nMin; i < node->nMax and bOk; i++)
+			{
+				ivJumps.Add(EmitInstruction(bReverse, OpSplit, -1, -1));
+				bOk = EmitNode(childNode, bReverse);
+			}
+		}
+
+		// Branchement vers l'iteration, prioritaire si la repetition est gloutonne, et vers la sortie
+		for (i = 0; i < ivJumps.GetSize(); i++)
+		{
+			nSplit = ivJumps.GetAt(i);
+			if (node->bGreedy)
+			{
+				ivTargetArgs1->SetAt(nSplit, nSplit + 1);
+				ivTargetArgs2->SetAt(nSplit, ivTargetOpcodes->GetSize());
+			}
+			else
+			{
+				ivTargetArgs1->SetAt(nSplit, ivTargetOpcodes->GetSize());
+				ivTargetArgs2->SetAt(nSplit, nSplit + 1);
+			}
+		}
+		break;
+	}
+	return bOk and ivTargetOpcodes->GetSize() <= nMaxInstructionNumber;
+}
+
+int RegexAutomaton::EmitInstruction(boolean bReverse, int nOpcode, int nArg1, int nArg2)
+{
+	if (bReverse)
+	{
+		ivReverseOpcodes.Add(nOpcode);
+		ivReverseArgs1.Add(nArg1);
+		ivReverseArgs2.Add(nArg2);
+		return ivReverseOpcodes.GetSize() - 1;
+	}
+	else
+	{
+		ivOpcodes.Add(nOpcode);
+		ivArgs1.Add(nArg1);
+		ivArgs2.Add(nArg2);
+		return ivOpcodes.GetSize() - 1;
+	}
+}
+
+void RegexAutomaton::ComputeFirstChars()
+{
+	IntVector ivInstructionsToVisit;
+	IntVector ivVisited;
+	int nInstruction;
+	int nClass;
+	int i;
+
+	require(ivOpcodes.GetSize() > 0);
+
+	// Parcours des instructions atteignables sans consommer de caractere, en considerant
+	// que toutes les assertions peuvent etre verifiees
+	cvFirstChars.SetSize(256);
+	cvFirstChars.Initialize();
+	bFirstCharsUsed = true;
+	ivVisited.SetSize(ivOpcodes.GetSize());
+	ivInstructionsToVisit.Add(0);
+	while (ivInstructionsToVisit.GetSize() > 0)
+	{
+		nInstruction = ivInstructionsToVisit.GetAt(ivInstructionsToVisit.GetSize() - 1);
+		ivInstructionsToVisit.SetSize(ivInstructionsToVisit.GetSize() - 1);
+		if (ivVisited.GetAt(nInstruction) == 1)
+			continue;
+		ivVisited.SetAt(nInstruction, 1);
+		switch (ivOpcodes.GetAt(nInstruction))
+		{
+		case OpChar:
+			cvFirstChars.SetAt(ivArgs1.GetAt(nInstruction), 1);
+			break;
+		case OpClass:
+			nClass = ivArgs1.GetAt(nInstruction);
+			for (i = 0; i < 256; i++)
+			{
+				if (cvClassChars.GetAt(nClass * 256 + i) != 0)
+					cvFirstChars.SetAt(i, 1);
+			}
+			break;
+		case OpSplit:
+			ivInstructionsToVisit.Add(ivArgs2.GetAt(nInstruction));
+			ivInstructionsToVisit.Add(ivArgs1.GetAt(nInstruction));
+			break;
+		case OpJump:
+			ivInstructionsToVisit.Add(ivArgs1.GetAt(nInstruction));
+			break;
+		// La chaine vide peut etre reconnue: les caracteres de debut ne sont pas exploitables
+		case OpMatch:
+			bFirstCharsUsed = false;
+			break;
+		default:
+			ivInstructionsToVisit.Add(nInstruction + 1);
+			break;
+		}
+	}
+}
+
+boolean RegexAutomaton::ExecuteSearch(const char* sValue, int nLength, int nSearchStart, boolean bPrevAvail,
+				     int nSlotNumber)
+{
+	boolean bFound;
+	int nMatchStart;
+	int nMatchEnd;
+
+	require(IsCompiled());
+	require(0 <= nSearchStart and nSearchStart <= nLength);
+
+	// Simulation de l'automate non deterministe si les automates deterministes ne sont pas utilisables
+	if (not bDFAUsed)
+		return Execute(sValue, nLength, nSearchStart, false, false, false, bPrevAvail, nSlotNumber);
+
+	// Recherche de la fin de l'occurrence
+	nMatchEnd = searchDFA->Scan(sValue, nSearchStart, nLength, not bPrevAvail, true);
+	if (nMatchEnd == -1)
+		return false;
+
+	// Recherche de son debut, en remontant la chaine depuis la fin de l'occurrence: c'est la position
+	// la plus a gauche pour laquelle une occurrence se termine a cette fin
+	nMatchStart = -2;
+	if (nMatchEnd >= 0)
+		nMatchStart = reverseDFA->Scan(sValue, nMatchEnd, nSearchStart, nMatchEnd == nLength, not bPrevAvail);
+	assert(nMatchEnd == -2 or nMatchStart != -1);
+
+	// Simulation de l'automate non deterministe en cas de saturation du cache d'un automate deterministe
+	if (nMatchStart == -2)
+		return Execute(sValue, nLength, nSearchStart, false, false, false, bPrevAvail, nSlotNumber);
+
+	// Memorisation de l'occurrence, s'il n'y a pas de groupe de capture a calculer
+	if (nSlotNumber == 2)
+	{
+		ivMatchSlots.SetAt(0, nMatchStart);
+		ivMatchSlots.SetAt(1, nMatchEnd);
+		bFound = true;
+	}
+	// Sinon, simulation de l'automate non deterministe ancre au debut de l'occurrence
+	else
+	{
+		bFound = Execute(sValue, nLength, nMatchStart, true, false, false,
+				 bPrevAvail or nMatchStart > nSearchStart, nSlotNumber);
+		assert(bFound and ivMatchSlots.GetAt(0) == nMatchStart and ivMatchSlots.GetAt(1) == nMatchEnd);
+	}
+	return bFound;
+}
+
+boolean RegexAutomaton::Execute(const char* sValue, int nLength, int nSearchStart, boolean bAnchored,
+				boolean bFullMatch, boolean bNotNull, boolean bPrevAvail, int nSlotNumber)
+{
+	boolean bMatched;
+	RegexAutomatonThreadList* swapThreads;
+	int nPos;
+	int nThread;
+	int nInstruction;
+	int nThreadSlotStart;
+	int nSlot;
+
+	require(IsCompiled());
+	require(sValue != NULL);
+	require(0 <= nSearchStart and nSearchStart <= nLength);
+	require(2 <= nSlotNumber and nSlotNumber <= ivWorkSlots.GetSize());
+
+	// Initialisation du contexte de recherche
+	nUsedSlotNumber = nSlotNumber;
+	nCurrentSearchStart = nSearchStart;
+	bCurrentPrevAvail = bPrevAvail;
+	currentThreads->Clear();
+
+	// Parcours des positions de la chaine, en faisant progresser tous les etats actifs simultanement
+	bMatched = false;
+	nPos = nSearchStart;
+	while (true)
+	{
+		// Ajout d'un etat initial, de priorite minimale, tant qu'aucune occurrence n'est trouvee
+		if (not bMatched and (not bAnchored or nPos == nSearchStart))
+		{
+			// S'il n'y a aucun etat actif, on passe directement au prochain caractere pouvant
+			// debuter une occurrence
+			if (bFirstCharsUsed and currentThreads->nCount == 0)
+			{
+				if (bAnchored)
+				{
+					if (nPos == nLength or cvFirstChars.GetAt((unsigned char)sValue[nPos]) == 0)
+						break;
+				}
+				else
+				{
+					while (nPos < nLength and cvFirstChars.GetAt((unsigned char)sValue[nPos]) == 0)
+						nPos++;
+					if (nPos == nLength)
+						break;
+				}
+			}
+
+			// Ajout de l'etat initial, sans aucune capture
+			for (nSlot = 0; nSlot < nUsedSlotNumber; nSlot++)
+				ivWorkSlots.SetAt(nSlot, -1);
+			AddThread(currentThreads, 0, sValue, nLength, nPos);
+		}
+
+		// Arret s'il n'y a plus d'etat actif et qu'aucun etat initial ne peut plus etre ajoute
+		if (currentThreads->nCount == 0 and (bMatched or bAnchored or nPos == nLength))
+			break;
+
+		// Calcul des etats actifs apres consommation du caractere courant, par ordre de priorite
+		nextThreads->Clear();
+		for (nThread = 0; nThread < currentThreads->nCount; nThread++)
+		{
+			nInstruction = currentThreads->ivInstructions.GetAt(nThread);
+			nThreadSlotStart = nThread * currentThreads->nSlotNumber;
+			switch (ivOpcodes.GetAt(nInstruction))
+			{
+			case OpMatch:
+				// On ignore l'occurrence si elle ne respecte pas les contraintes de recherche
+				if (bFullMatch and nPos < nLength)
+					break;
+				if (bNotNull and nPos == currentThreads->ivSlots.GetAt(nThreadSlotStart))
+					break;
+
+				// Memorisation de l'occurrence
+				for (nSlot = 0; nSlot < nUsedSlotNumber; nSlot++)
+					ivMatchSlots.SetAt(nSlot, currentThreads->ivSlots.GetAt(nThreadSlotStart + nSlot));
+				bMatched = true;
+
+				// Abandon des etats actifs moins prioritaires
+				nThread = currentThreads->nCount;
+				break;
+			case OpChar:
+				if (nPos < nLength and (unsigned char)sValue[nPos] == ivArgs1.GetAt(nInstruction))
+				{
+					for (nSlot = 0; nSlot < nUsedSlotNumber; nSlot++)
+						ivWorkSlots.SetAt(nSlot,
+								  currentThreads->ivSlots.GetAt(nThreadSlotStart + nSlot));
+					AddThread(nextThreads, nInstruction + 1, sValue, nLength, nPos + 1);
+				}
+				break;
+			case OpClass:
+				if (nPos < nLength and
+				    cvClassChars.GetAt(ivArgs1.GetAt(nInstruction) * 256 + (unsigned char)sValue[nPos]) != 0)
+				{
+					for (nSlot = 0; nSlot < nUsedSlotNumber; nSlot++)
+						ivWorkSlots.SetAt(nSlot,
+								  currentThreads->ivSlots.GetAt(nThreadSlotStart + nSlot));
+					AddThread(nextThreads, nInstruction + 1, sValue, nLength, nPos + 1);
+				}
+				break;
+			}
+		}
+
+		// Arret en fin de chaine
+		if (nPos == nLength)
+			break;
+
+		// Passage a la position suivante
+		swapThreads = currentThreads;
+		currentThreads = nextThreads;
+		nextThreads = swapThreads;
+		nPos++;
+	}
+	return bMatched;
+}
+
+void RegexAutomaton::AddThread(RegexAutomatonThreadList* threadList, int nStartInstruction, const char* sValue,
+			       int nLength, int nPos)
+{
+	int nInstruction;
+	int nValue;
+	int nSlot;
+	int nStackSize;
+	boolean bLeftWord;
+	boolean bRightWord;
+
+	require(threadList != NULL);
+	require(0 <= nPos and nPos <= nLength);
+
+	// Exploration en profondeur des instructions atteignables sans consommer de caractere, la branche
+	// prioritaire de chaque instruction Split etant exploree en premier
+	// La pile est dimensionnee une fois pour toutes, chaque instruction y etant empilee au plus une fois
+	ivThreadStack.SetAt(0, nStartInstruction);
+	ivThreadStack.SetAt(1, 0);
+	nStackSize = 2;
+	while (nStackSize > 0)
+	{
+		nStackSize -= 2;
+		nInstruction = ivThreadStack.GetAt(nStackSize);
+		nValue = ivThreadStack.GetAt(nStackSize + 1);
+
+		// Restauration d'une capture a sa valeur d'avant l'exploration de la branche precedente
+		if (nInstruction < 0)
+		{
+			ivWorkSlots.SetAt(-nInstruction - 1, nValue);
+			continue;
+		}
+
+		// Parcours des instructions successives, tant qu'elles n'ont pas deja ete visitees
+		while (nInstruction != -1)
+		{
+			if (threadList->ivVisitMarks.GetAt(nInstruction) == threadList->nVisitMark)
+				break;
+			threadList->ivVisitMarks.SetAt(nInstruction, threadList->nVisitMark);
+			switch (ivOpcodes.GetAt(nInstruction))
+			{
+			case OpJump:
+				nInstruction = ivArgs1.GetAt(nInstruction);
+				break;
+			case OpSplit:
+				ivThreadStack.SetAt(nStackSize, ivArgs2.GetAt(nInstruction));
+				ivThreadStack.SetAt(nStackSize + 1, 0);
+				nStackSize += 2;
+				nInstruction = ivArgs1.GetAt(nInstruction);
+				break;
+			case OpSave:
+				nSlot = ivArgs1.GetAt(nInstruction);
+				if (nSlot < nUsedSlotNumber)
+				{
+					ivThreadStack.SetAt(nStackSize, -nSlot - 1);
+					ivThreadStack.SetAt(nStackSize + 1, ivWorkSlots.GetAt(nSlot));
+					nStackSize += 2;
+					ivWorkSlots.SetAt(nSlot, nPos);
+				}
+				nInstruction++;
+				break;
+			// Debut de chaine, ou le caractere precedent n'est pas disponible
+			case OpLineBegin:
+				if (nPos == nCurrentSearchStart and not bCurrentPrevAvail)
+					nInstruction++;
+				else
+					nInstruction = -1;
+				break;
+			case OpLineEnd:
+				if (nPos == nLength)
+					nInstruction++;
+				else
+					nInstruction = -1;
+				break;
+			case OpWordBoundary:
+			case OpNotWordBoundary:
+				bLeftWord = nPos > 0 and (nPos > nCurrentSearchStart or bCurrentPrevAvail) and
+					    IsWordChar(sValue[nPos - 1]);
+				bRightWord = nPos < nLength and IsWordChar(sValue[nPos]);
+				if ((bLeftWord != bRightWord) == (ivOpcodes.GetAt(nInstruction) == OpWordBoundary))
+					nInstruction++;
+				else
+					nInstruction = -1;
+				break;
+			// Instruction consommant un caractere ou fin de programme: ajout d'un etat actif
+			default:
+				threadList->ivInstructions.SetAt(threadList->nCount, nInstruction);
+				for (nSlot = 0; nSlot < nUsedSlotNumber; nSlot++)
+					threadList->ivSlots.SetAt(threadList->nCount * threadList->nSlotNumber + nSlot,
+								  ivWorkSlots.GetAt(nSlot));
+				threadList->nCount++;
+				nInstruction = -1;
+				break;
+			}
+		}
+	}
+}
+
+void RegexAutomaton::AppendFormat(const char* sValue, int nLength, const char* sFormat, int nPrefixStart,
+				  ALString& sResult) const
+{
+	const char* sFormatPart;
+	const char* sNext;
+	int nGroup;
+
+	require(sValue != NULL);
+	require(sFormat != NULL);
+
+	// Interpretation du format selon la syntaxe ECMAScript, comme dans match_results::format
+	sFormatPart = sFormat;
+	while (*sFormatPart != '\0')
+	{
+		// Recopie jusqu'au prochain '$'
+		sNext = sFormatPart;
+		while (*sNext != '\0' and *sNext != '$')
+			sNext++;
+		AppendBuffer(sResult, sFormatPart, (int)(sNext - sFormatPart));
+		if (*sNext == '\0')
+			break;
+
+		// Analyse de la reference suivant le '$'
+		sNext++;
+		if (*sNext == '$')
+		{
+			sResult += '$';
+			sNext++;
+		}
+		else if (*sNext == '&')
+		{
+			AppendBuffer(sResult, sValue + ivMatchSlots.GetAt(0), ivMatchSlots.GetAt(1) - ivMatchSlots.GetAt(0));
+			sNext++;
+		}
+		else if (*sNext == '`')
+		{
+			AppendBuffer(sResult, sValue + nPrefixStart, ivMatchSlots.GetAt(0) - nPrefixStart);
+			sNext++;
+		}
+		else if (*sNext == '\'')
+		{
+			AppendBuffer(sResult, sValue + ivMatchSlots.GetAt(1), nLength - ivMatchSlots.GetAt(1));
+			sNext++;
+		}
+		else if (isdigit((unsigned char)*sNext))
+		{
+			// Numero de groupe sur un ou deux chiffres
+			nGroup = *sNext - '0';
+			sNext++;
+			if (isdigit((unsigned char)*sNext))
+			{
+				nGroup = nGroup * 10 + *sNext - '0';
+				sNext++;
+			}
+
+			// Valeur du groupe s'il existe et a ete capture
+			if (nGroup <= nGroupNumber and ivMatchSlots.GetAt(2 * nGroup) != -1 and
+			    ivMatchSlots.GetAt(2 * nGroup + 1) != -1)
+				AppendBuffer(sResult, sValue + ivMatchSlots.GetAt(2 * nGroup),
+					     ivMatchSlots.GetAt(2 * nGroup + 1) - ivMatchSlots.GetAt(2 * nGroup));
+		}
+		else
+			sResult += '$';
+		sFormatPart = sNext;
+	}
+}
+
+void RegexAutomaton::AppendBuffer(ALString& sResult, const char* sBuffer, int nBufferLength)
+{
+	char* sResultBuffer;
+	int nLength;
+
+	require(sBuffer != NULL);
+	require(nBufferLength >= 0);
+
+	if (nBufferLength > 0)
+	{
+		// Agrandissement geometrique du buffer si necessaire
+		nLength = sResult.GetLength();
+		if (nLength + nBufferLength > sResult.GetAllocLength())
+			sResult.GetBuffer(max(2 * sResult.GetAllocLength(), nLength + nBufferLength));
+
+		// Ajout en fin de buffer
+		sResultBuffer = sResult.GetBuffer(nLength + nBufferLength);
+		memcpy(sResultBuffer + nLength, sBuffer, nBufferLength);
+		sResult.ReleaseBuffer(nLength + nBufferLength);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Classe RegexAutomatonNode
+
+RegexAutomatonNode::RegexAutomatonNode()
+{
+	nType = Empty;
+	nValue = 0;
+	nMin = 0;
+	nMax = 0;
+	bGreedy = true;
+}
+
+RegexAutomatonNode::~RegexAutomatonNode()
+{
+	oaChildren.DeleteAll();
+}
+
+boolean RegexAutomatonNode::IsNullable() const
+{
+	boolean bNullable;
+	int i;
+
+	switch (nType)
+	{
+	case Char:
+	case Class:
+		bNullable = false;
+		break;
+	case Concatenation:
+		bNullable = true;
+		for (i = 0; i < oaChildren.GetSize() and bNullable; i++)
+			bNullable = cast(RegexAutomatonNode*, oaChildren.GetAt(i))->IsNullable();
+		break;
+	case Alternation:
+		bNullable = false;
+		for (i = 0; i < oaChildren.GetSize() and not bNullable; i++)
+			bNullable = cast(RegexAutomatonNode*, oaChildren.GetAt(i))->IsNullable();
+		break;
+	case Group:
+		bNullable = cast(RegexAutomatonNode*, oaChildren.GetAt(0))->IsNullable();
+		break;
+	case Repetition:
+		bNullable = nMin == 0 or cast(RegexAutomatonNode*, oaChildren.GetAt(0))->IsNullable();
+		break;
+	// Assertions et expression vide
+	default:
+		bNullable = true;
+		break;
+	}
+	return bNullable;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Classe RegexAutomatonThreadList
+
+RegexAutomatonThreadList::RegexAutomatonThreadList()
+{
+	nCount = 0;
+	nVisitMark = 0;
+	nSlotNumber = 0;
+}
+
+RegexAutomatonThreadList::~RegexAutomatonThreadList() {}
+
+void RegexAutomatonThreadList::Initialize(int nInstructionNumber, int nThreadSlotNumber)
+{
+	require(nInstructionNumber >= 0);
+	require(nThreadSlotNumber >= 0);
+
+	nSlotNumber = nThreadSlotNumber;
+	ivInstructions.SetSize(nInstructionNumber);
+	ivSlots.SetSize(nInstructionNumber * nSlotNumber);
+	ivVisitMarks.SetSize(nInstructionNumber);
+	ivVisitMarks.Initialize();
+	nVisitMark = 0;
+	nCount = 0;
+}
+
+void RegexAutomatonThreadList::Clear()
+{
+	// Reinitialisation des marques en cas de debordement
+	if (nVisitMark == INT_MAX)
+	{
+		ivVisitMarks.Initialize();
+		nVisitMark = 0;
+	}
+	nVisitMark++;
+	nCount = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Classe RegexAutomatonDFA
+
+RegexAutomatonDFA::RegexAutomatonDFA()
+{
+	automaton = NULL;
+	ivOpcodes = NULL;
+	ivArgs1 = NULL;
+	ivArgs2 = NULL;
+	bReverseScan = false;
+	bUnanchoredSearch = false;
+	bStopAtFirstMatch = false;
+	nStartStates[0] = -1;
+	nStartStates[1] = -1;
+	nNewThreadNumber = 0;
+	bNewThreadsStopped = false;
+	nVisitMark = 0;
+}
+
+RegexAutomatonDFA::~RegexAutomatonDFA() {}
+
+void RegexAutomatonDFA::Initialize(const RegexAutomaton* regexAutomaton, boolean bReverse, boolean bUnanchored,
+				   boolean bStopAtMatch)
+{
+	require(regexAutomaton != NULL);
+	require(regexAutomaton->IsCompiled());
+
+	// Nettoyage prealable
+	Clean();
+
+	// Memorisation du programme et du parametrage
+	automaton = regexAutomaton;
+	if (bReverse)
+	{
+		ivOpcodes = &regexAutomaton->ivReverseOpcodes;
+		ivArgs1 = &regexAutomaton->ivReverseArgs1;
+		ivArgs2 = &regexAutomaton->ivReverseArgs2;
+	}
+	else
+	{
+		ivOpcodes = &regexAutomaton->ivOpcodes;
+		ivArgs1 = &regexAutomaton->ivArgs1;
+		ivArgs2 = &regexAutomaton->ivArgs2;
+	}
+	bReverseScan = bReverse;
+	bUnanchoredSearch = bUnanchored;
+	bStopAtFirstMatch = bStopAtMatch;
+
+	// Dimensionnement des structures de construction des listes d'instructions, avec une place
+	// supplementaire pour le marqueur de relance
+	ivNewThreads.SetSize(ivOpcodes->GetSize() + 1);
+	ivStack.SetSize(ivOpcodes->GetSize() + 1);
+	ivVisitMarks.SetSize(ivOpcodes->GetSize());
+	ivVisitMarks.Initialize();
+	nVisitMark = 0;
+	ensure(ivOpcodes->GetSize() > 0);
+}
+
+void RegexAutomatonDFA::Clean()
+{
+	CleanStates();
+	automaton = NULL;
+	ivOpcodes = NULL;
+	ivArgs1 = NULL;
+	ivArgs2 = NULL;
+	bReverseScan = false;
+	bUnanchoredSearch = false;
+	bStopAtFirstMatch = false;
+	ivNewThreads.SetSize(0);
+	nNewThreadNumber = 0;
+	bNewThreadsStopped = false;
+	ivVisitMarks.SetSize(0);
+	nVisitMark = 0;
+	ivStack.SetSize(0);
+}
+
+int RegexAutomatonDFA::Scan(const char* sValue, int nStart, int nStop, boolean bAtBegin, boolean bAtEndAllowed)
+{
+	int nLastMatch;
+	int nState;
+	int nTarget;
+	int nPos;
+	int nChar;
+
+	require(ivOpcodes != NULL);
+	require(sValue != NULL);
+	require((not bReverseScan and nStart <= nStop) or (bReverseScan and nStart >= nStop));
+
+	// Etat initial
+	nState = GetStartState(bAtBegin);
+	if (nState == -1)
+	{
+		CleanStates();
+		return -2;
+	}
+
+	// Parcours des caracteres jusqu'a la position d'arret ou a l'absence d'etat actif
+	nLastMatch = -1;
+	nPos = nStart;
+	while (nPos != nStop)
+	{
+		if ((ivStateFlags.GetAt(nState) & StateMatch) != 0)
+			nLastMatch = nPos;
+
+		// Acces a la transition, calculee si necessaire
+		if (bReverseScan)
+			nChar = (unsigned char)sValue[nPos - 1];
+		else
+			nChar = (unsigned char)sValue[nPos];
+		nTarget = ivTransitions.GetAt(nState * 256 + nChar);
+		if (nTarget == 0)
+		{
+			nTarget = ComputeTransition(nState, nChar);
+			if (nTarget == -2)
+			{
+				CleanStates();
+				return -2;
+			}
+			nTarget = ivTransitions.GetAt(nState * 256 + nChar);
+		}
+
+		// Arret s'il n'y a plus d'etat actif
+		if (nTarget == -1)
+			return nLastMatch;
+		nState = nTarget - 1;
+		if (bReverseScan)
+			nPos--;
+		else
+			nPos++;
+	}
+
+	// Prise en compte des assertions de fin a la position d'arret
+	if ((ivStateFlags.GetAt(nState) & (bAtEndAllowed ? StateMatchAtEnd : StateMatch)) != 0)
+		nLastMatch = nPos;
+	return nLastMatch;
+}
+
+longint RegexAutomatonDFA::GetUsedMemory() const
+{
+	longint lUsedMemory;
+
+	lUsedMemory = sizeof(RegexAutomatonDFA);
+	lUsedMemory += ldStateIndexes.GetUsedMemory() - sizeof(LongintDictionary);
+	lUsedMemory += ivStateThreadStarts.GetUsedMemory() - sizeof(IntVector);
+	lUsedMemory += ivStateThreadNumbers.GetUsedMemory() - sizeof(IntVector);
+	lUsedMemory += ivStateThreads.GetUsedMemory() - sizeof(IntVector);
+	lUsedMemory += ivStateFlags.GetUsedMemory() - sizeof(IntVector);
+	lUsedMemory += ivTransitions.GetUsedMemory() - sizeof(IntVector);
+	lUsedMemory += ivNewThreads.GetUsedMemory() - sizeof(IntVector);
+	lUsedMemory += ivVisitMarks.GetUsedMemory() - sizeof(IntVector);
+	lUsedMemory += ivStack.GetUsedMemory() - sizeof(IntVector);
+	return lUsedMemory;
+}
+
+const ALString RegexAutomatonDFA::GetClassLabel() const
+{
+	return "Regex DFA";
+}
+
+void RegexAutomatonDFA::CleanStates()
+{
+	ldStateIndexes.RemoveAll();
+	ivStateThreadStarts.SetSize(0);
+	ivStateThreadNumbers.SetSize(0);
+	ivStateThreads.SetSize(0);
+	ivStateFlags.SetSize(0);
+	ivTransitions.SetSize(0);
+	nStartStates[0] = -1;
+	nStartStates[1] = -1;
+}
+
+int RegexAutomatonDFA::GetStartState(boolean bAtBegin)
+{
+	int nIndex;
+
+	require(ivOpcodes != NULL);
+
+	nIndex = bAtBegin ? 1 : 0;
+	if (nStartStates[nIndex] == -1)
+	{
+		StartThreadList();
+		AddClosure(0, bAtBegin, false);
+		if (bUnanchoredSearch and not bNewThreadsStopped)
+			ivNewThreads.SetAt(nNewThreadNumber++, nRestartThread);
+		nStartStates[nIndex] = AddState(bAtBegin);
+	}
+	return nStartStates[nIndex];
+}
+
+int RegexAutomatonDFA::ComputeTransition(int nState, int nChar)
+{
+	int nTarget;
+	int nThread;
+	int nThreadStop;
+	int nInstruction;
+	int nOpcode;
+
+	require(0 <= nState and nState < GetStateNumber());
+	require(0 <= nChar and nChar < 256);
+
+	// Avancement de chaque instruction de l'etat selon le caractere, par ordre de priorite
+	StartThreadList();
+	nThreadStop = ivStateThreadStarts.GetAt(nState) + ivStateThreadNumbers.GetAt(nState);
+	for (nThread = ivStateThreadStarts.GetAt(nState); nThread < nThreadStop; nThread++)
+	{
+		if (bNewThreadsStopped)
+			break;
+		nInstruction = ivStateThreads.GetAt(nThread);
+
+		// Relance de la recherche a la position suivante, avec une priorite minimale
+		if (nInstruction == nRestartThread)
+		{
+			AddClosure(0, false, false);
+			if (not bNewThreadsStopped)
+				ivNewThreads.SetAt(nNewThreadNumber++, nRestartThread);
+			continue;
+		}
+
+		// Traitement de l'instruction
+		nOpcode = ivOpcodes->GetAt(nInstruction);
+		if (nOpcode == RegexAutomaton::OpChar)
+		{
+			if (ivArgs1->GetAt(nInstruction) == nChar)
+				AddClosure(nInstruction + 1, false, false);
+		}
+		else if (nOpcode == RegexAutomaton::OpClass)
+		{
+			if (automaton->cvClassChars.GetAt(ivArgs1->GetAt(nInstruction) * 256 + nChar) != 0)
+				AddClosure(nInstruction + 1, false, false);
+		}
+		// Abandon des instructions moins prioritaires qu'une occurrence reconnue
+		else if (nOpcode == RegexAutomaton::OpMatch)
+		{
+			if (bStopAtFirstMatch)
+				bNewThreadsStopped = true;
+		}
+		// Les assertions de fin en attente ne sont pas verifiees avant un caractere
+		else
+			assert(nOpcode == RegexAutomaton::OpLineEnd);
+	}
+
+	// Recherche ou creation de l'etat cible
+	if (nNewThreadNumber == 0)
+		nTarget = -1;
+	else
+	{
+		nTarget = AddState(false);
+		if (nTarget == -1)
+			return -2;
+	}
+
+	// Memorisation de la transition
+	if (nTarget == -1)
+		ivTransitions.SetAt(nState * 256 + nChar, -1);
+	else
+		ivTransitions.SetAt(nState * 256 + nChar, nTarget + 1);
+	return nTarget;
+}
+
+int RegexAutomatonDFA::AddState(boolean bAtBegin)
+{
+	ALString sKey;
+	int nState;
+	int nThread;
+	int nInstruction;
+	int nFlags;
+	int nThreadStart;
+	int nThreadNumber;
+	int i;
+
+	// Construction de la cle de l'etat, qui depend du contexte de debut pour l'evaluation
+	// des assertions de fin en attente
+	sKey = bAtBegin ? "B" : "N";
+	for (nThread = 0; nThread < nNewThreadNumber; nThread++)
+	{
+		sKey += ',';
+		sKey += IntToString(ivNewThreads.GetAt(nThread));
+	}
+
+	// Recherche de l'etat existant
+	nState = (int)ldStateIndexes.Lookup(sKey) - 1;
+	if (nState >= 0)
+		return nState;
+
+	// Arret si le cache est sature
+	if (GetStateNumber() >= nMaxStateNumber)
+		return -1;
+
+	// Creation de l'etat
+	nState = GetStateNumber();
+	ldStateIndexes.SetAt(sKey, nState + 1);
+	nThreadStart = ivStateThreads.GetSize();
+	nThreadNumber = nNewThreadNumber;
+	ivStateThreadStarts.Add(nThreadStart);
+	ivStateThreadNumbers.Add(nThreadNumber);
+	for (nThread = 0; nThread < nThreadNumber; nThread++)
+		ivStateThreads.Add(ivNewThreads.GetAt(nThread));
+	ivTransitions.SetSize(ivTransitions.GetSize() + 256);
+	for (nInstruction = nState * 256; nInstruction < ivTransitions.GetSize(); nInstruction++)
+		ivTransitions.SetAt(nInstruction, 0);
+
+	// Calcul des indicateurs de reconnaissance d'une occurrence
+	nFlags = 0;
+	for (nThread = nThreadStart; nThread < nThreadStart + nThreadNumber; nThread++)
+	{
+		nInstruction = ivStateThreads.GetAt(nThread);
+		if (nInstruction == nRestartThread)
+			continue;
+		if (ivOpcodes->GetAt(nInstruction) == RegexAutomaton::OpMatch)
+			nFlags = StateMatch | StateMatchAtEnd;
+		// Verification des assertions de fin en attente, en supposant qu'on est a la position d'arret
+		else if (ivOpcodes->GetAt(nInstruction) == RegexAutomaton::OpLineEnd and
+			 (nFlags & StateMatchAtEnd) == 0)
+		{
+			StartThreadList();
+			AddClosure(nInstruction + 1, bAtBegin, true);
+			for (i = 0; i < nNewThreadNumber; i++)
+			{
+				if (ivOpcodes->GetAt(ivNewThreads.GetAt(i)) == RegexAutomaton::OpMatch)
+					nFlags |= StateMatchAtEnd;
+			}
+		}
+	}
+	ivStateFlags.Add(nFlags);
+	return nState;
+}
+
+void RegexAutomatonDFA::AddClosure(int nStartInstruction, boolean bAtBegin, boolean bAtEnd)
+{
+	int nStackSize;
+	int nInstruction;
+	int nOpcode;
+
+	require(0 <= nStartInstruction and nStartInstruction < ivOpcodes->GetSize());
+
+	// Arret si les instructions moins prioritaires sont abandonnees
+	if (bNewThreadsStopped)
+		return;
+
+	// Exploration en profondeur par ordre de priorite
+	nStackSize = 0;
+	ivStack.SetAt(nStackSize++, nStartInstruction);
+	while (nStackSize > 0 and not bNewThreadsStopped)
+	{
+		nInstruction = ivStack.GetAt(--nStackSize);
+		while (ivVisitMarks.GetAt(nInstruction) != nVisitMark)
+		{
+			ivVisitMarks.SetAt(nInstruction, nVisitMark);
+			nOpcode = ivOpcodes->GetAt(nInstruction);
+
+			// Instructions sans consommation de caractere
+			if (nOpcode == RegexAutomaton::OpJump)
+				nInstruction = ivArgs1->GetAt(nInstruction);
+			else if (nOpcode == RegexAutomaton::OpSplit)
+			{
+				ivStack.SetAt(nStackSize++, ivArgs2->GetAt(nInstruction));
+				nInstruction = ivArgs1->GetAt(nInstruction);
+			}
+			else if (nOpcode == RegexAutomaton::OpSave)
+				nInstruction++;
+			else if (nOpcode == RegexAutomaton::OpLineBegin)
+			{
+				if (not bAtBegin)
+					break;
+				nInstruction++;
+			}
+			// Assertion de fin, verifiee ou mise en attente
+			else if (nOpcode == RegexAutomaton::OpLineEnd and bAtEnd)
+				nInstruction++;
+			// Instructions memorisees dans la liste
+			else
+			{
+				assert(nOpcode != RegexAutomaton::OpWordBoundary and
+				       nOpcode != RegexAutomaton::OpNotWordBoundary);
+				ivNewThreads.SetAt(nNewThreadNumber++, nInstruction);
+				if (nOpcode == RegexAutomaton::OpMatch and bStopAtFirstMatch)
+					bNewThreadsStopped = true;
+				break;
+			}
+		}
+	}
+}
+
+void RegexAutomatonDFA::StartThreadList()
+{
+	// Reinitialisation des marques en cas de debordement
+	if (nVisitMark == INT_MAX)
+	{
+		ivVisitMarks.Initialize();
+		nVisitMark = 0;
+	}
+	nVisitMark++;
+	nNewThreadNumber = 0;
+	bNewThreadsStopped = false;
+}
@@ -0,0 +1,473 @@
+// Copyright (c) 2023-2026 Orange. All rights reserved.
+// This software is distributed under the BSD 3-Clause-clear License, the text of which is available
+// at https://spdx.org/licenses/BSD-3-Clause-Clear.html or see the "LICENSE" file for more details.
+
+#pragma once
+
+#include "ALString.h"
+#include "Object.h"
+#include "Vector.h"
+#include "CharVector.h"
+
+class RegexAutomaton;
+class RegexAutomatonNode;
+class RegexAutomatonThreadList;
+class RegexAutomatonDFA;
+
+////////////////////////////////////////////////////////////////////////////
+// Classe RegexAutomaton
+// Automate de reconnaissance d'expressions regulieres, alternative a la librairie regex du C++
+// pour un sous-ensemble de la syntaxe ECMAScript
+//
+// L'expression est compilee une seule fois en un programme d'automate non deterministe (Thompson),
+// simule ensuite en parallele sur tous ses etats actifs (Pike VM): le temps de traitement est lineaire
+// dans la longueur de la chaine analysee, sans retour arriere ni allocation par caractere, alors que
+// l'implementation par backtracking de la librairie standard est exponentielle dans le pire des cas
+// Les etats actifs sont explores par ordre de priorite, ce qui reproduit exactement le resultat
+// du backtracking ECMAScript (premiere solution trouvee, et non la plus longue)
+//
+// Quand l'expression ne contient pas d'assertion de frontiere de mot, la recherche est acceleree par
+// des automates deterministes construits paresseusement (RegexAutomatonDFA), dont les etats sont les
+// ensembles ordonnes d'etats actifs rencontres: un premier automate trouve la fin de l'occurrence,
+// un second, sur l'expression inversee, trouve son debut en remontant la chaine a partir de la fin.
+// La simulation de l'automate non deterministe n'est alors utilisee que pour les groupes de capture
+//
+// Sous-ensemble supporte:
+//  . caracteres litteraux, '.', classes de caracteres [...] et [^...] avec plages de caracteres ASCII
+//  . classes predefinies \d \D \w \W \s \S (locale "C"), caracteres de controle \t \n \r \f \v,
+//    caracteres speciaux echappes
+//  . assertions ^ $ \b \B
+//  . groupes capturants (...) et non capturants (?:...), alternatives |
+//  . quantificateurs * + ? {n} {n,} {n,m}, gloutons ou paresseux
+// Les autres constructions (references arriere, assertions avant, classes POSIX, repetitions
+// d'expressions pouvant etre vides...) ne sont pas supportees: la compilation echoue, et il
+// faut alors utiliser la librairie standard
+class RegexAutomaton : public Object
+{
+public:
+	// Constructeur
+	RegexAutomaton();
+	~RegexAutomaton();
+
+	// Compilation d'une expression reguliere, supposee valide selon la syntaxe ECMAScript
+	// Renvoie false si l'expression n'est pas dans le sous-ensemble supporte, auquel cas
+	// l'automate reste vide
+	boolean Compile(const char* sRegexValue);
+
+	// Indique si l'automate est compile
+	boolean IsCompiled() const;
+
+	// Nettoyage de l'automate
+	void Clean();
+
+	// Nombre de groupes de capture de l'expression
+	int GetGroupNumber() const;
+
+	// Indique si un groupe de capture est inclus dans une repetition
+	// Dans ce cas, la valeur capturee par le groupe peut differer de celle de la librairie standard,
+	// qui n'applique pas systematiquement la reinitialisation des captures a chaque iteration
+	// prevue par ECMAScript: il ne faut pas exploiter les captures de groupe dans ce cas
+	boolean IsCaptureGroupRepeated() const;
+
+	////////////////////////////////////////////////////////////////
+	// Utilisation de l'automate, qui doit etre compile
+	// Les chaines sont specifiees par un buffer et une longueur, ce qui permet de traiter
+	// des sous-chaines sans recopie
+	// Les resultats sont identiques a ceux des fonctions regex_match, regex_search et
+	// regex_replace de la librairie standard
+
+	// Renvoie true si l'automate reconnait exactement la chaine de caracteres
+	boolean Match(const char* sValue, int nLength);
+
+	// Recherche de la premiere occurrence dans une chaine de caracteres
+	// Renvoie true si trouve, avec les positions de debut et de fin (exclue) de l'occurrence
+	boolean Search(const char* sValue, int nLength, int& nMatchStart, int& nMatchEnd);
+
+	// Remplacement de toutes les occurrences trouvees, selon une chaine de format pouvant contenir
+	// des references aux groupes de capture ($&, $1...$99, $`, $', $$)
+	// Le resultat est ajoute en fin de la chaine passee en parametre
+	void ReplaceAll(const char* sValue, int nLength, const char* sFormat, ALString& sResult);
+
+	////////////////////////////////////////////////////////////////////
+	// Divers
+
+	// Memoire utilisee
+	longint GetUsedMemory() const override;
+
+	// Affichage du programme de l'automate
+	void Write(ostream& ost) const override;
+
+	// Libelles utilisateurs
+	const ALString GetClassLabel() const override;
+	const ALString GetObjectLabel() const override;
+
+	////////////////////////////////////////////////////////////////////
+	///// Implementation
+protected:
+	// Les automates deterministes exploitent directement le programme de l'automate
+	friend class RegexAutomatonDFA;
+
+	// Types d'instructions du programme de l'automate
+	enum
+	{
+		OpChar,             // Caractere (parametre: caractere)
+		OpClass,            // Classe de caracteres (parametre: index de classe)
+		OpSplit,            // Branchement vers deux instructions, la premiere etant prioritaire
+		OpJump,             // Saut vers une instruction
+		OpSave,             // Memorisation de la position courante (parametre: index de capture)
+		OpLineBegin,        // Assertion de debut de chaine
+		OpLineEnd,          // Assertion de fin de chaine
+		OpWordBoundary,     // Assertion de frontiere de mot
+		OpNotWordBoundary,  // Assertion de non frontiere de mot
+		OpMatch             // Fin du programme avec succes
+	};
+
+	////////////////////////////////////////////////////////////////
+	// Analyse syntaxique de l'expression reguliere en un arbre d'expression
+	// Chaque methode renvoie NULL si l'expression n'est pas supportee
+
+	// Analyse d'une alternative, d'une concatenation, d'une repetition ou d'un element atomique
+	RegexAutomatonNode* ParseAlternation();
+	RegexAutomatonNode* ParseConcatenation();
+	RegexAutomatonNode* ParseRepetition();
+	RegexAutomatonNode* ParseAtom();
+
+	// Analyse d'une sequence d'echappement, hors d'une classe de caracteres
+	RegexAutomatonNode* ParseEscape();
+
+	// Analyse d'une classe de caracteres
+	RegexAutomatonNode* ParseClass();
+
+	// Analyse d'un caractere de classe de caracteres, simple ou echappe
+	// Renvoie -1 si non supporte, et -2 s'il s'agit d'une classe predefinie, dont on renvoie le nom (d, w, s...)
+	int ParseClassChar(char& cClassName);
+
+	// Analyse d'un entier dans un quantificateur, -1 si absent
+	int ParseQuantifierValue();
+
+	// Creation d'une classe de caracteres, initialement vide, dont on renvoie l'index
+	int NewClass();
+
+	// Ajout d'une classe predefinie (d, D, w, W, s, S) a une classe de caracteres
+	void AddClassName(int nClass, char cClassName);
+
+	// Test d'appartenance d'un caractere a la classe \w, en locale "C" comme la librairie standard
+	static boolean IsWordChar(char c);
+
+	////////////////////////////////////////////////////////////////
+	// Generation du programme de l'automate
+
+	// Verification des contraintes sur l'arbre d'expression, avant generation du programme
+	// Renvoie false si l'expression contient une repetition d'une sous-expression pouvant etre vide
+	boolean CheckNode(const RegexAutomatonNode* node, boolean bInRepetition);
+
+	// Generation du programme d'un noeud de l'arbre, ou du programme inverse reconnaissant
+	// les chaines inversees
+	// Renvoie false si le programme depasse sa taille maximale
+	boolean EmitNode(const RegexAutomatonNode* node, boolean bReverse);
+
+	// Ajout d'une instruction au programme ou au programme inverse, dont on renvoie l'index
+	int EmitInstruction(boolean bReverse, int nOpcode, int nArg1, int nArg2);
+
+	// Calcul des caracteres pouvant debuter une occurrence
+	void ComputeFirstChars();
+
+	////////////////////////////////////////////////////////////////
+	// Simulation de l'automate
+
+	// Recherche d'une occurrence a partir d'une position de depart, comme avec Execute en mode non ancre,
+	// en utilisant si possible les automates deterministes
+	boolean ExecuteSearch(const char* sValue, int nLength, int nSearchStart, boolean bPrevAvail, int nSlotNumber);
+
+	// Recherche d'une occurrence a partir d'une position de depart, en reproduisant le comportement
+	// de la librairie standard selon ses options:
+	//  . bAnchored: occurrence debutant exactement a la position de depart (match_continuous)
+	//  . bFullMatch: occurrence allant jusqu'en fin de chaine (regex_match)
+	//  . bNotNull: occurrence non vide (match_not_null)
+	//  . bPrevAvail: caractere precedent la position de depart exploitable par les assertions (match_prev_avail)
+	// Les positions capturees sont disponibles dans ivMatchSlots, pour le nombre de captures demande
+	boolean Execute(const char* sValue, int nLength, int nSearchStart, boolean bAnchored, boolean bFullMatch,
+			boolean bNotNull, boolean bPrevAvail, int nSlotNumber);
+
+	// Ajout d'un etat actif et de tous ses successeurs sans consommation de caractere, par ordre de priorite,
+	// avec les captures courantes de ivWorkSlots
+	void AddThread(RegexAutomatonThreadList* threadList, int nStartInstruction, const char* sValue, int nLength,
+		       int nPos);
+
+	// Ajout du resultat de formatage d'une occurrence trouvee en fin de chaine
+	void AppendFormat(const char* sValue, int nLength, const char* sFormat, int nPrefixStart,
+			  ALString& sResult) const;
+
+	// Ajout d'une sous-chaine en fin de chaine
+	static void AppendBuffer(ALString& sResult, const char* sBuffer, int nBufferLength);
+
+	// Expression reguliere et etat de son analyse syntaxique
+	ALString sRegex;
+	int nParsePos;
+	int nGroupNumber;
+	boolean bCaptureGroupRepeated;
+
+	// Programme de l'automate: type et parametres de chaque instruction
+	IntVector ivOpcodes;
+	IntVector ivArgs1;
+	IntVector ivArgs2;
+
+	// Programme inverse, sans capture, utilise uniquement par les automates deterministes
+	IntVector ivReverseOpcodes;
+	IntVector ivReverseArgs1;
+	IntVector ivReverseArgs2;
+
+	// Automates deterministes, pour la reconnaissance exacte, la recherche de la fin d'une occurrence
+	// et la recherche de son debut, utilises uniquement si l'indicateur associe est vrai
+	RegexAutomatonDFA* matchDFA;
+	RegexAutomatonDFA* searchDFA;
+	RegexAutomatonDFA* reverseDFA;
+	boolean bDFAUsed;
+
+	// Classes de caracteres, chacune codee par un indicateur d'appartenance par caractere
+	CharVector cvClassChars;
+	int nClassNumber;
+
+	// Indicateurs d'appartenance des caracteres pouvant debuter une occurrence,
+	// exploitables uniquement si l'expression ne reconnait pas la chaine vide
+	CharVector cvFirstChars;
+	boolean bFirstCharsUsed;
+
+	// Etats actifs pour la position courante et la position suivante
+	RegexAutomatonThreadList* currentThreads;
+	RegexAutomatonThreadList* nextThreads;
+
+	// Pile d'exploration des etats successeurs lors de l'ajout d'un etat actif, par paires (instruction, valeur)
+	// Une instruction negative correspond a la restauration d'une capture a sa valeur precedente
+	IntVector ivThreadStack;
+
+	// Captures courantes lors de l'ajout d'un etat actif, et captures de l'occurrence trouvee
+	IntVector ivWorkSlots;
+	IntVector ivMatchSlots;
+
+	// Nombre de captures utilisees par la simulation en cours
+	int nUsedSlotNumber;
+
+	// Contexte de la recherche en cours pour l'evaluation des assertions
+	int nCurrentSearchStart;
+	boolean bCurrentPrevAvail;
+
+	// Taille maximale du programme, au dela de laquelle on renonce a utiliser l'automate
+	static const int nMaxInstructionNumber = 10000;
+};
+
+////////////////////////////////////////////////////////////////////////////
+// Classe RegexAutomatonNode
+// Noeud de l'arbre d'expression d'une expression reguliere, utilise uniquement
+// lors de la compilation d'un RegexAutomaton
+class RegexAutomatonNode : public Object
+{
+public:
+	// Constructeur
+	RegexAutomatonNode();
+	~RegexAutomatonNode();
+
+	// Types de noeud
+	enum
+	{
+		Char,            // Caractere (valeur: caractere)
+		Class,           // Classe de caracteres (valeur: index de classe)
+		LineBegin,       // Assertion ^
+		LineEnd,         // Assertion $
+		WordBoundary,    // Assertion \b
+		NotWordBoundary, // Assertion \B
+		Empty,           // Expression vide
+		Concatenation,   // Concatenation des sous-expressions
+		Alternation,     // Alternative entre les sous-expressions
+		Group,           // Groupe de capture (valeur: index de groupe)
+		Repetition       // Repetition de la sous-expression entre Min et Max fois (Max a -1 si infini)
+	};
+
+	// Type de noeud
+	int nType;
+
+	// Valeur associee au type de noeud
+	int nValue;
+
+	// Bornes d'une repetition, et indicateur de repetition gloutonne
+	int nMin;
+	int nMax;
+	boolean bGreedy;
+
+	// Sous-expressions
+	ObjectArray oaChildren;
+
+	// Indique si l'expression peut reconnaitre la chaine vide
+	boolean IsNullable() const;
+};
+
+////////////////////////////////////////////////////////////////////////////
+// Classe RegexAutomatonThreadList
+// Liste des etats actifs d'un RegexAutomaton, par ordre de priorite, avec leurs captures
+class RegexAutomatonThreadList : public Object
+{
+public:
+	// Constructeur
+	RegexAutomatonThreadList();
+	~RegexAutomatonThreadList();
+
+	// Dimensionnement pour un nombre d'instructions et de captures par etat actif
+	void Initialize(int nInstructionNumber, int nThreadSlotNumber);
+
+	// Vidage de la liste, avec mise a jour de la marque des instructions visitees
+	void Clear();
+
+	// Instruction de chaque etat actif
+	IntVector ivInstructions;
+
+	// Captures de chaque etat actif, stockees consecutivement
+	IntVector ivSlots;
+	int nSlotNumber;
+
+	// Nombre d'etats actifs
+	int nCount;
+
+	// Marque de visite par instruction: une instruction est visitee si sa marque est egale a la marque courante
+	IntVector ivVisitMarks;
+	int nVisitMark;
+};
+
+////////////////////////////////////////////////////////////////////////////
+// Classe RegexAutomatonDFA
+// Automate deterministe construit paresseusement a partir du programme d'un RegexAutomaton,
+// sans assertion de frontiere de mot
+// Chaque etat est la liste ordonnee des instructions actives apres lecture d'une sequence de caracteres,
+// ce qui permet de reproduire l'ordre de priorite ECMAScript. Les etats et leurs transitions sont crees
+// a la demande, puis memorises dans un cache de taille limitee
+class RegexAutomatonDFA : public Object
+{
+public:
+	// Constructeur
+	RegexAutomatonDFA();
+	~RegexAutomatonDFA();
+
+	// Initialisation a partir du programme d'un automate, ou de son programme inverse
+	//  . bUnanchored: occurrence pouvant debuter a toute position (sinon, en debut de parcours uniquement)
+	//  . bStopAtMatch: abandon des etats moins prioritaires qu'une occurrence reconnue (premiere solution
+	//    ECMAScript), sinon tous les etats sont conserves (plus longue occurrence)
+	// Le programme est reference et non copie: l'automate doit rester inchange pendant l'utilisation
+	void Initialize(const RegexAutomaton* regexAutomaton, boolean bReverse, boolean bUnanchored,
+			boolean bStopAtMatch);
+
+	// Nettoyage complet
+	void Clean();
+
+	// Parcours des caracteres d'une chaine entre une position de depart et une position d'arret,
+	// en sens croissant, ou decroissant pour un programme inverse
+	// Les assertions de debut sont verifiees en position de depart si bAtBegin est vrai, et les assertions
+	// de fin en position d'arret si bAtEndAllowed est vrai
+	// Renvoie la derniere position atteinte ou une occurrence est reconnue, -1 si aucune,
+	// et -2 si le cache d'etats est sature, auquel cas le resultat n'est pas disponible
+	int Scan(const char* sValue, int nStart, int nStop, boolean bAtBegin, boolean bAtEndAllowed);
+
+	// Nombre d'etats crees
+	int GetStateNumber() const;
+
+	// Memoire utilisee
+	longint GetUsedMemory() const override;
+
+	// Libelle de la classe
+	const ALString GetClassLabel() const override;
+
+	////////////////////////////////////////////////////////////////////
+	///// Implementation
+protected:
+	// Indicateurs des etats
+	enum
+	{
+		StateMatch = 1,      // Occurrence reconnue a la position courante
+		StateMatchAtEnd = 2  // Occurrence reconnue a la position courante si c'est la position d'arret
+	};
+
+	// Marqueur de la relance d'une recherche non ancree a la position suivante, de priorite minimale
+	static const int nRestartThread = -1;
+
+	// Taille maximale du cache d'etats
+	static const int nMaxStateNumber = 1000;
+
+	// Vidage du cache d'etats, en conservant le parametrage
+	void CleanStates();
+
+	// Recherche de l'etat initial, cree si necessaire
+	// Renvoie -1 si le cache est sature
+	int GetStartState(boolean bAtBegin);
+
+	// Calcul d'une transition d'un etat selon un caractere
+	// Renvoie l'index de l'etat cible, -1 si aucun etat actif ne subsiste, et -2 si le cache est sature
+	int ComputeTransition(int nState, int nChar);
+
+	// Recherche ou creation de l'etat correspondant a la liste d'instructions en cours de construction
+	// Renvoie -1 si le cache est sature
+	int AddState(boolean bAtBegin);
+
+	// Ajout a la liste d'instructions en cours de construction des instructions atteignables sans
+	// consommation de caractere, par ordre de priorite
+	void AddClosure(int nStartInstruction, boolean bAtBegin, boolean bAtEnd);
+
+	// Debut de la construction d'une nouvelle liste d'instructions
+	void StartThreadList();
+
+	// Programme de l'automate et parametrage
+	const RegexAutomaton* automaton;
+	const IntVector* ivOpcodes;
+	const IntVector* ivArgs1;
+	const IntVector* ivArgs2;
+	boolean bReverseScan;
+	boolean bUnanchoredSearch;
+	boolean bStopAtFirstMatch;
+
+	// Etats: liste d'instructions (debut et taille dans le tableau de toutes les instructions), indicateurs,
+	// et transitions par caractere (index de l'etat cible plus 1, 0 si non calcule, -1 si aucun etat actif)
+	LongintDictionary ldStateIndexes;
+	IntVector ivStateThreadStarts;
+	IntVector ivStateThreadNumbers;
+	IntVector ivStateThreads;
+	IntVector ivStateFlags;
+	IntVector ivTransitions;
+
+	// Etats initiaux, selon que les assertions de debut sont verifiees ou non (-1 si non calcule)
+	int nStartStates[2];
+
+	// Liste d'instructions en cours de construction, et indicateur d'abandon des etats moins prioritaires
+	IntVector ivNewThreads;
+	int nNewThreadNumber;
+	boolean bNewThreadsStopped;
+
+	// Marques de visite des instructions et pile d'exploration, pour la construction des listes d'instructions
+	IntVector ivVisitMarks;
+	int nVisitMark;
+	IntVector ivStack;
+};
+
+////////////////////////////////////////////////////////////////////
+// Methodes en inline
+
+inline boolean RegexAutomaton::IsCompiled() const
+{
+	return ivOpcodes.GetSize() > 0;
+}
+
+inline int RegexAutomaton::GetGroupNumber() const
+{
+	return nGroupNumber;
+}
+
+inline boolean RegexAutomaton::IsCaptureGroupRepeated() const
+{
+	return bCaptureGroupRepeated;
+}
+
+inline boolean RegexAutomaton::IsWordChar(char c)
+{
+	return ('a' <= c and c <= 'z') or ('A' <= c and c <= 'Z') or ('0' <= c and c <= '9') or c == '_';
+}
+
+inline int RegexAutomatonDFA::GetStateNumber() const
+{
+	return ivStateFlags.GetSize();
+}
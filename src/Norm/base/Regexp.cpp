@@ -16,10 +16,13 @@
 Regex::Regex()
 {
 	regexObject = NULL;
+	regexAutomaton = NULL;
 }
 
 Regex::~Regex()
 {
+	if (regexAutomaton != NULL)
+		delete regexAutomaton;
 #ifdef __REGEX__
 	if (regexObject != NULL)
 	{
@@ -36,6 +39,7 @@ boolean Regex::Initialize(const char* sRegexValue, const Object* errorSender)
 	require(sRegexValue != NULL);
 
 	// Initialisation a vide
+	RemoveAutomaton();
 #ifdef __REGEX__
 	if (regexObject != NULL)
 	{
@@ -91,6 +95,14 @@ boolean Regex::Initialize(const char* sRegexValue, const Object* errorSender)
 				regexObject = NULL;
 			}
 		}
+
+		// Compilation d'un automate si l'expression valide est dans le sous-ensemble supporte
+		if (regexObject != NULL)
+		{
+			regexAutomaton = new RegexAutomaton;
+			if (not regexAutomaton->Compile(sRegex))
+				RemoveAutomaton();
+		}
 	}
 #endif // __REGEX__
 	return regexObject != NULL;
@@ -113,9 +125,12 @@ boolean Regex::Match(const char* sValue)
 
 	require(sValue != NULL);
 
+	// Utilisation de l'automate si possible
+	if (regexAutomaton != NULL)
+		bMatch = regexAutomaton->Match(sValue, (int)strlen(sValue));
 #ifdef __REGEX__
 	// Recherche uniquement si la regex est valide
-	if (IsValid())
+	else if (IsValid())
 	{
 		// Recherche de la regex
 		try
@@ -137,13 +152,17 @@ boolean Regex::Match(const char* sValue)
 int Regex::Find(const char* sValue)
 {
 	int nPosition = -1;
+	int nMatchEnd;
 	ALString sTmp;
 
 	require(sValue != NULL);
 
+	// Utilisation de l'automate si possible
+	if (regexAutomaton != NULL)
+		regexAutomaton->Search(sValue, (int)strlen(sValue), nPosition, nMatchEnd);
 #ifdef __REGEX__
 	// Recherche uniquement si la regex est valide
-	if (IsValid())
+	else if (IsValid())
 	{
 		// Recherche de la regex
 		try
@@ -173,14 +192,30 @@ ALString Regex::Replace(const char* sValue, const char* sReplace)
 {
 	boolean bReplaced = false;
 	ALString sReplacedString;
+	int nMatchStart;
+	int nMatchEnd;
 	ALString sTmp;
 
 	require(sValue != NULL);
 	require(sReplace != NULL);
 
+	// Utilisation de l'automate si possible
+	if (IsAutomatonUsableForReplace(sReplace))
+	{
+		if (regexAutomaton->Search(sValue, (int)strlen(sValue), nMatchStart, nMatchEnd))
+		{
+			// Comme avec la librairie standard, le format est applique a toutes les occurrences
+			// de la regex dans la sous-chaine trouvee, consideree comme une chaine a part entiere
+			sReplacedString = ALString(sValue, nMatchStart);
+			regexAutomaton->ReplaceAll(sValue + nMatchStart, nMatchEnd - nMatchStart, sReplace,
+						   sReplacedString);
+			sReplacedString += sValue + nMatchEnd;
+			bReplaced = true;
+		}
+	}
 #ifdef __REGEX__
 	// Recherche uniquement si la regex est valide
-	if (IsValid())
+	else if (IsValid())
 	{
 		// Recherche de la regex pour remplacer sa premiere occurrence
 		try
@@ -228,9 +263,15 @@ ALString Regex::ReplaceAll(const char* sValue, const char* sReplace)
 	require(sValue != NULL);
 	require(sReplace != NULL);
 
+	// Utilisation de l'automate si possible
+	if (IsAutomatonUsableForReplace(sReplace))
+	{
+		regexAutomaton->ReplaceAll(sValue, (int)strlen(sValue), sReplace, sReplacedString);
+		bReplaced = true;
+	}
 #ifdef __REGEX__
 	// Recherche uniquement si la regex est valide
-	if (IsValid())
+	else if (IsValid())
 	{
 		// Recherche de la regex pour remplacer toutes ses occurrences
 		// On passe ici std::back_inserter qui est plus efficace dans sa gestion memoire, en evitant de passer
@@ -274,6 +315,8 @@ longint Regex::GetUsedMemory() const
 	// grammaire de la regex)
 	if (regexObject != NULL)
 		lUsedMemory += sRegex.GetLength() * 10 * sizeof(void*);
+	if (regexAutomaton != NULL)
+		lUsedMemory += regexAutomaton->GetUsedMemory();
 	return lUsedMemory;
 }
 
@@ -292,6 +335,11 @@ const ALString Regex::GetObjectLabel() const
 	return GetShortValue(sRegex);
 }
 
+boolean Regex::IsAutomatonUsed() const
+{
+	return regexAutomaton != NULL;
+}
+
 boolean Regex::IsAvailableOnCurrentSystem()
 {
 #ifdef __REGEX__
@@ -359,6 +407,9 @@ void Regex::Test()
 		}
 	}
 
+	// Comparaison des resultats de l'automate avec ceux de la librairie standard
+	TestAutomaton();
+
 	// Test en volumetrie
 	sRegex = "A";
 	sReplace = "a";
@@ -368,6 +419,121 @@ void Regex::Test()
 		sTest.SetAt(i, 'A');
 	sTest = regexObject.ReplaceAll(sTest, sReplace);
 	cout << sTest.Left(10) << "...: " << sTest.GetLength() << endl;
+
+	// Test en volumetrie sur la chaine precedente, avec une regex de complexite exponentielle
+	// par backtracking, mais lineaire avec l'automate
+	sRegex = "(a|aa)*b";
+	regexObject.Initialize(sRegex, NULL);
+	cout << sRegex << "\t" << regexObject.IsAutomatonUsed() << "\t" << regexObject.Match(sTest) << "\t"
+	     << regexObject.Find(sTest) << endl;
+}
+
+void Regex::TestAutomaton()
+{
+	Regex regexObject;
+	Regex regexReference;
+	StringVector svRegex;
+	StringVector svReplace;
+	StringVector svTestStrings;
+	int nRegex;
+	int nReplace;
+	int nTest;
+	int nDifferenceNumber;
+	ALString sRegex;
+	ALString sTest;
+
+	// Initialisation des regex, dans et hors du sous-ensemble gere par l'automate
+	svRegex.Add("Bonjour");
+	svRegex.Add("(Mr) (\\w+)");
+	svRegex.Add("a|ab|abc");
+	svRegex.Add("(a|ab)(c|bcd)(d*)");
+	svRegex.Add("a*");
+	svRegex.Add("a*?");
+	svRegex.Add("x*");
+	svRegex.Add("r?");
+	svRegex.Add(".");
+	svRegex.Add("^");
+	svRegex.Add("$");
+	svRegex.Add("^$");
+	svRegex.Add("\\b");
+	svRegex.Add("\\Bo");
+	svRegex.Add("^B\\w+");
+	svRegex.Add("\\w+$");
+	svRegex.Add("\\bD\\w*");
+	svRegex.Add("\\w+?");
+	svRegex.Add("(\\w+?)(\\d*)$");
+	svRegex.Add("[A-Z][a-z]+");
+	svRegex.Add("[^ ]+");
+	svRegex.Add("[a-c-]+");
+	svRegex.Add("[.\\-/]");
+	svRegex.Add("[\\d\\s]+");
+	svRegex.Add("\\d+|\\s+");
+	svRegex.Add("\\S+");
+	svRegex.Add("\\W");
+	svRegex.Add("o{1,2}");
+	svRegex.Add("o{2}");
+	svRegex.Add("(o)+");
+	svRegex.Add("(?:Mr|Mme) (\\w+)");
+	svRegex.Add("colou?r");
+	svRegex.Add("D(u|o)p(o|on)d?");
+	svRegex.Add("(\\w+)@(\\w+)\\.(com|org)");
+	svRegex.Add("https?://([^/?]+)([^?]*)(\\?(.*))?");
+	svRegex.Add("Mozilla/(\\d+)\\.(\\d+)");
+	svRegex.Add("(a*)*");
+	svRegex.Add("(\\w)\\1");
+	svRegex.Add("(?=a)");
+	svRegex.Add("\\x41");
+
+	// Initialisation des valeurs de remplacement
+	svReplace.Add("");
+	svReplace.Add("x");
+	svReplace.Add("<$&>");
+	svReplace.Add("[$1|$2]");
+	svReplace.Add("$`#$'");
+	svReplace.Add("$$");
+	svReplace.Add("$");
+	svReplace.Add("$9x$10");
+
+	// Initialisation des chaines cherchees
+	svTestStrings.Add("");
+	svTestStrings.Add("Bonjour");
+	svTestStrings.Add("Bonjour Mr Dupond et Mr Durand");
+	svTestStrings.Add("Mme Dopon, abcd aaabc");
+	svTestStrings.Add("  color and colour  ");
+	svTestStrings.Add("Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36");
+	svTestStrings.Add("http://www.example.com/path/a-b.c?q=1&r=2");
+	svTestStrings.Add("john@example.com, jane@test.org");
+	svTestStrings.Add("abc123def45\n\t6");
+	svTestStrings.Add("\xC3\xA9t\xC3\xA9 Bonjour");
+
+	// Comparaison pour chaque regex, en comptant les differences sur toutes les fonctions
+	for (nRegex = 0; nRegex < svRegex.GetSize(); nRegex++)
+	{
+		sRegex = svRegex.GetAt(nRegex);
+		regexObject.Initialize(sRegex, NULL);
+		regexReference.Initialize(sRegex, NULL);
+		regexReference.RemoveAutomaton();
+		nDifferenceNumber = 0;
+		for (nTest = 0; nTest < svTestStrings.GetSize(); nTest++)
+		{
+			sTest = svTestStrings.GetAt(nTest);
+			if (regexObject.Match(sTest) != regexReference.Match(sTest))
+				nDifferenceNumber++;
+			if (regexObject.Find(sTest) != regexReference.Find(sTest))
+				nDifferenceNumber++;
+			for (nReplace = 0; nReplace < svReplace.GetSize(); nReplace++)
+			{
+				if (regexObject.Replace(sTest, svReplace.GetAt(nReplace)) !=
+				    regexReference.Replace(sTest, svReplace.GetAt(nReplace)))
+					nDifferenceNumber++;
+				if (regexObject.ReplaceAll(sTest, svReplace.GetAt(nReplace)) !=
+				    regexReference.ReplaceAll(sTest, svReplace.GetAt(nReplace)))
+					nDifferenceNumber++;
+			}
+		}
+		cout << sRegex << "\tautomaton: " << regexObject.IsAutomatonUsed()
+		     << "\tdifferences: " << nDifferenceNumber << endl;
+	}
 }
 
 const ALString Regex::GetShortValue(const ALString& sValue) const
@@ -379,3 +545,34 @@ const ALString Regex::GetShortValue(const ALString& sValue) const
 	else
 		return sValue.Left(nMaxLength) + "...";
 }
+
+boolean Regex::IsAutomatonUsableForReplace(const char* sReplace) const
+{
+	int i;
+
+	require(sReplace != NULL);
+
+	if (regexAutomaton == NULL)
+		return false;
+	else if (not regexAutomaton->IsCaptureGroupRepeated())
+		return true;
+	else
+	{
+		// Recherche d'une reference a un groupe de capture
+		for (i = 0; sReplace[i] != '\0'; i++)
+		{
+			if (sReplace[i] == '$' and isdigit((unsigned char)sReplace[i + 1]))
+				return false;
+		}
+		return true;
+	}
+}
+
+void Regex::RemoveAutomaton()
+{
+	if (regexAutomaton != NULL)
+	{
+		delete regexAutomaton;
+		regexAutomaton = NULL;
+	}
+}
@@ -7,6 +7,7 @@
 #include "ALString.h"
 #include "Object.h"
 #include "Ermgt.h"
+#include "RegexAutomaton.h"
 
 ////////////////////////////////////////////////////////////////////////////
 // Classe Regex
@@ -14,6 +15,8 @@
 // sur les chaines de caracteres
 // La syntaxe de reference est: ECMAScript regular expressions pattern syntax
 // http://www.cplusplus.com/reference/regex/ECMAScript/
+// Les expressions du sous-ensemble de la syntaxe gere par RegexAutomaton sont evaluees par
+// un automate, en temps lineaire, avec des resultats identiques a ceux de la librairie standard
 class Regex : public Object
 {
 public:
@@ -64,6 +67,9 @@ public:
 	const ALString GetClassLabel() const override;
 	const ALString GetObjectLabel() const override;
 
+	// Indique si l'expression reguliere est evaluee par un automate plutot que par la librairie standard
+	boolean IsAutomatonUsed() const;
+
 	// Indique si la gestion des regex est disponible sur le systeme en cours
 	// En effet, comme l'implementation des regex s'appuie sur C++11, il existe
 	// des plate-formes ne supportant pas les regex
@@ -76,9 +82,19 @@ public:
 	////////////////////////////////////////////////////////////////////
 	// Implementation
 protected:
+	// Methode de test de comparaison des resultats de l'automate et de la librairie standard
+	static void TestAutomaton();
+
 	// Renvoie une version courte d'une chaine de caractere en entree
 	const ALString GetShortValue(const ALString& sValue) const;
 
+	// Indique si l'automate peut etre utilise pour un remplacement, ce qui n'est pas le cas
+	// si le format reference des groupes de capture repetes
+	boolean IsAutomatonUsableForReplace(const char* sReplace) const;
+
+	// Destruction de l'automate, pour forcer l'utilisation de la librairie standard (pour les tests)
+	void RemoveAutomaton();
+
 	////////////////////////////////////////////////////////////////////
 	// L'implementation exploite la librairie regex du C++ 11, en passant au maximum
 	// par les variantes exploitant les const char* plutot que les string du C++.
@@ -94,4 +110,8 @@ protected:
 	// Object generique pour stocker un objet de gestion de la regex
 	// Cela permet de gerer les plate-forme ne supportant pas les regex
 	void* regexObject;
+
+	// Automate compile a partir de la regex, si elle est dans le sous-ensemble supporte (NULL sinon)
+	// L'objet regex de la librairie standard est toujours cree, pour la validation de l'expression
+	RegexAutomaton* regexAutomaton;
 };
@@ -262,6 +262,10 @@ boolean SystemFileDriverCreator::IsDriverRegisteredForScheme(const ALString& sSc
 	int i;
 	SystemFileDriver* registeredDriver;
 
+	// Aucun driver si aucun n'a ete enregistre
+	if (oaSystemFileDriver == NULL)
+		return false;
+
 	// On parcourt tous les drivers pour trouver celui qui traite le scheme
 	for (i = 0; i < oaSystemFileDriver->GetSize(); i++)
 	{
@@ -551,6 +551,60 @@ const char* GetSystemInfos()
 	return sInfo;
 }
 
+void* SharedMemoryCreate(const char* sName, longint lSize)
+{
+	HANDLE hMapping;
+	void* pMemory;
+
+	assert(sName != NULL and sName[0] == '/');
+	assert(lSize > 0);
+
+	// Creation d'un objet de mapping adosse au fichier de pagination
+	// Le nom Windows est le nom du segment sans son '/' initial
+	hMapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, (DWORD)(lSize >> 32),
+				      (DWORD)(lSize & 0xFFFFFFFF), &sName[1]);
+	if (hMapping == NULL)
+		return NULL;
+	if (GetLastError() == ERROR_ALREADY_EXISTS)
+	{
+		CloseHandle(hMapping);
+		return NULL;
+	}
+
+	// Projection, puis fermeture du handle : l'objet est maintenu tant qu'une projection existe
+	pMemory = MapViewOfFile(hMapping, FILE_MAP_ALL_ACCESS, 0, 0, (SIZE_T)lSize);
+	CloseHandle(hMapping);
+	return pMemory;
+}
+
+const void* SharedMemoryOpenReadOnly(const char* sName, longint lSize)
+{
+	HANDLE hMapping;
+	const void* pMemory;
+
+	assert(sName != NULL and sName[0] == '/');
+	assert(lSize > 0);
+
+	hMapping = OpenFileMappingA(FILE_MAP_READ, FALSE, &sName[1]);
+	if (hMapping == NULL)
+		return NULL;
+	pMemory = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, (SIZE_T)lSize);
+	CloseHandle(hMapping);
+	return pMemory;
+}
+
+void SharedMemoryUnmap(const void* pMemory, longint lSize)
+{
+	assert(pMemory != NULL);
+	UnmapViewOfFile(pMemory);
+}
+
+void SharedMemoryRemove(const char* sName)
+{
+	// Sous Windows, l'objet de mapping est detruit automatiquement avec sa derniere projection
+	assert(sName != NULL and sName[0] == '/');
+}
+
 #endif // _WIN32
 
 ///////////////////////////////////////////////////////////////////////////////////////////
@@ -568,6 +622,8 @@ const char* GetSystemInfos()
 #include <stdlib.h>
 #include <string.h>
 #include <sys/utsname.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 
 #ifndef __ANDROID__
 #include <ifaddrs.h>
@@ -1341,6 +1397,84 @@ const char* GetMachineGUID()
 #endif // __APPLE__
 }
 
+#ifdef __ANDROID__
+// Pas de shm_open sous Android : on renvoie NULL pour que l'appelant utilise sa memoire privee
+void* SharedMemoryCreate(const char* sName, longint lSize)
+{
+	return NULL;
+}
+
+const void* SharedMemoryOpenReadOnly(const char* sName, longint lSize)
+{
+	return NULL;
+}
+
+void SharedMemoryUnmap(const void* pMemory, longint lSize) {}
+
+void SharedMemoryRemove(const char* sName) {}
+#else // __ANDROID__
+void* SharedMemoryCreate(const char* sName, longint lSize)
+{
+	int nFd;
+	void* pMemory;
+
+	assert(sName != NULL and sName[0] == '/');
+	assert(lSize > 0);
+
+	// Creation exclusive du segment, dimensionnement puis projection en lecture/ecriture
+	nFd = shm_open(sName, O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+	if (nFd == -1)
+		return NULL;
+	if (ftruncate(nFd, (off_t)lSize) != 0)
+	{
+		close(nFd);
+		shm_unlink(sName);
+		return NULL;
+	}
+	pMemory = mmap(NULL, (size_t)lSize, PROT_READ | PROT_WRITE, MAP_SHARED, nFd, 0);
+
+	// Le descripteur n'est plus necessaire une fois le segment projete
+	close(nFd);
+	if (pMemory == MAP_FAILED)
+	{
+		shm_unlink(sName);
+		return NULL;
+	}
+	return pMemory;
+}
+
+const void* SharedMemoryOpenReadOnly(const char* sName, longint lSize)
+{
+	int nFd;
+	void* pMemory;
+
+	assert(sName != NULL and sName[0] == '/');
+	assert(lSize > 0);
+
+	nFd = shm_open(sName, O_RDONLY, 0);
+	if (nFd == -1)
+		return NULL;
+	pMemory = mmap(NULL, (size_t)lSize, PROT_READ, MAP_SHARED, nFd, 0);
+	close(nFd);
+	if (pMemory == MAP_FAILED)
+		return NULL;
+	return pMemory;
+}
+
+void SharedMemoryUnmap(const void* pMemory, longint lSize)
+{
+	assert(pMemory != NULL);
+	assert(lSize > 0);
+	munmap((void*)pMemory, (size_t)lSize);
+}
+
+void SharedMemoryRemove(const char* sName)
+{
+	assert(sName != NULL and sName[0] == '/');
+	shm_unlink(sName);
+}
+#endif // __ANDROID__
+
 int GetMaxOpenedFileNumber()
 {
 	struct rlimit lim;
@@ -39,6 +39,25 @@ longint MemGetFreePhysicalMemory();
 // Memoire virtuelle utilisee par le process courant
 longint MemGetCurrentProcessVirtualMemory();
 
+//////////////////////////////////////////////////////////////////////////////
+// Memoire partagee entre les processus d'une meme machine
+// Les segments sont identifies par un nom, qui doit commencer par '/' et ne plus contenir d'autre '/'
+// Les methodes de creation et d'ouverture renvoient NULL en cas d'echec (ou si la plateforme ne le permet pas),
+// l'appelant devant alors se rabattre sur une memoire privee a chaque processus
+
+// Creation d'un segment de taille donnee, projete en lecture/ecriture dans le processus createur
+void* SharedMemoryCreate(const char* sName, longint lSize);
+
+// Projection en lecture seule d'un segment existant, de meme taille que lors de sa creation
+const void* SharedMemoryOpenReadOnly(const char* sName, longint lSize);
+
+// Fin de projection d'un segment dans le processus courant
+void SharedMemoryUnmap(const void* pMemory, longint lSize);
+
+// Suppression du nom d'un segment: il n'est plus accessible par son nom, et la memoire
+// est liberee quand plus aucun processus ne le projette
+void SharedMemoryRemove(const char* sName);
+
 //////////////////////////////////////////////////////////////////////////////
 // Divers
 
@@ -185,6 +185,10 @@ void PLMPIFileServerSlave::Run(boolean& bOrderToQuit)
 				Fread(status.MPI_SOURCE);
 				break;
 
+			case FILE_SERVER_FREAD_AHEAD:
+				FreadAhead(status.MPI_SOURCE);
+				break;
+
 			default:
 				cout << "FileServer : Unexpected message emitted by " << IntToString(status.MPI_SOURCE)
 				     << " with tag " << IntToString(status.MPI_TAG) << endl;
@@ -292,6 +296,64 @@ void PLMPIFileServerSlave::Fread(int nRank) const
 	}
 }
 
+void PLMPIFileServerSlave::FreadAhead(int nRank) const
+{
+	PLMPIMsgContext context;
+	PLSerializer serializer;
+	ALString sFileName;
+	char* sBuffer;
+	longint lBeginPos;
+	int nSize;
+	longint lHeader[2];
+	FILE* file;
+	boolean bOk;
+
+	errno = 0;
+	lHeader[0] = 0;
+	lHeader[1] = 0;
+
+	// Reception de la demande
+	if (GetTracerMPI()->GetActiveMode())
+		GetTracerMPI()->AddRecv(nRank, FILE_SERVER_FREAD_AHEAD);
+	context.Recv(MPI_COMM_WORLD, nRank, FILE_SERVER_FREAD_AHEAD);
+	serializer.OpenForRead(&context);
+	sFileName = serializer.GetString();
+	lBeginPos = serializer.GetLongint();
+	nSize = serializer.GetInt();
+	serializer.Close();
+
+	// Allocation d'un buffer de grande taille
+	assert(nSize > 0);
+	sBuffer = GetHugeBuffer(nSize);
+
+	// Ouverture et lecture du fichier
+	AddPerformanceTrace("<< Start IO read : FreadAhead");
+	bOk = FileService::OpenInputBinaryFile(sFileName, file);
+	if (bOk)
+	{
+		bOk = FileService::SeekPositionInBinaryFile(file, lBeginPos);
+		if (bOk)
+			lHeader[0] = fread(sBuffer, 1, (size_t)nSize, file);
+
+		// En cas d'erreur on renvoie un buffer vide
+		if (not bOk or ferror(file))
+		{
+			lHeader[0] = 0;
+			lHeader[1] = errno;
+		}
+		fclose(file);
+	}
+	else
+		lHeader[1] = errno;
+	AddPerformanceTrace("<< End IO read : FreadAhead");
+
+	// Envoi de l'entete puis des donnees, eventuellement vides, pour terminer les deux receptions postees
+	if (GetTracerMPI()->GetActiveMode())
+		GetTracerMPI()->AddSend(nRank, FILE_SERVER_FREAD_AHEAD);
+	MPI_Send(lHeader, 2, MPI_LONG_LONG, nRank, FILE_SERVER_FREAD_AHEAD, MPI_COMM_WORLD);
+	MPI_Send(sBuffer, (int)lHeader[0], MPI_CHAR, nRank, FILE_SERVER_FREAD_AHEAD, MPI_COMM_WORLD);
+}
+
 void PLMPIFileServerSlave::GetFileSize(int nRank) const
 {
 	PLMPIMsgContext context;
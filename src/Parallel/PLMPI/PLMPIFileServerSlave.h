@@ -32,6 +32,11 @@ protected:
 	// lit et envoi un buffer
 	void Fread(int nRank) const;
 
+	// Lit et envoie une fenetre de lecture anticipee
+	// L'entete (nombre d'octets lus, errno) et les donnees sont envoyes en deux messages MPI bruts,
+	// recus de facon non bloquante par l'esclave demandeur
+	void FreadAhead(int nRank) const;
+
 	// Envoie de la taille du fichier vers l'esclave de rang nRank
 	void GetFileSize(int nRank) const;
 
@@ -32,6 +32,7 @@ PLMPIMaster::~PLMPIMaster()
 {
 	int i;
 
+	assert(olPendingSends.IsEmpty());
 	if (bSpawnedDone)
 	{
 		// Nettoyage des variables partagees
@@ -409,6 +410,9 @@ boolean PLMPIMaster::Process()
 			// Test si le nombre de messages utilisateur est arrive a saturation
 			UpdateMaxErrorFlow();
 
+			// Liberation des envois non bloquants termines
+			CompletePendingSends(false);
+
 			// Boucle de lancement de tous les esclaves disponibles
 			theWorker = GetTask()->GetReadySlave();
 			while (theWorker != NULL and not bInterruptionRequested and not task->bJobIsTerminated and
@@ -425,8 +429,10 @@ boolean PLMPIMaster::Process()
 				if (not task->bJobIsTerminated and not bMasterError and
 				    not task->bSlaveAtRestWithoutProcessing)
 				{
-					// Reception de tous les messages de progression issus de l'esclave
-					DischargePendingCommunication(theWorker->GetRank(), SLAVE_PROGRESSION);
+					// Reception de tous les messages de progression issus de l'esclave,
+					// sauf s'il est en cours de traitement (envoi en mode pipeline)
+					if (not theWorker->IsProcessing())
+						DischargePendingCommunication(theWorker->GetRank(), SLAVE_PROGRESSION);
 
 					// Lancement de l'eclave
 					GiveNewJob(theWorker, dTaskPercentage);
@@ -465,13 +471,16 @@ boolean PLMPIMaster::Process()
 					}
 				}
 
-				// Reception des fins de traitement
+				// Reception des fins de traitement, y compris celles des taches pre-envoyees en mode
+				// pipeline, sauf en cas d'interruption car l'esclave peut alors s'arreter sans les traiter
 				for (i = 0; i < task->oaSlaves.GetSize(); i++)
 				{
 					theWorker = cast(PLSlaveState*, GetTask()->oaSlaves.GetAt(i));
-					if (theWorker->IsProcessing())
+					while (theWorker->IsProcessing())
 					{
 						ReceiveAndProcessMessage(SLAVE_END_PROCESSING, theWorker->GetRank());
+						if (bInterruptionRequested)
+							break;
 					}
 				}
 			}
@@ -556,6 +565,9 @@ boolean PLMPIMaster::Process()
 
 	TaskProgression::EndTask();
 
+	// Attente de la fin des envois non bloquants : les esclaves dechargent les messages restants
+	CompletePendingSends(true);
+
 	// Tout les messages on ete traites par les esclaves, on peut continuer
 	MPI_Barrier(*PLMPITaskDriver::GetTaskComm()); // BARRIER MSG 2
 
@@ -600,6 +612,7 @@ int PLMPIMaster::ReceiveAndProcessMessage(int nAnyTag, int nAnySource)
 	int nSource;
 	int nTag;
 	boolean bInitializeOk;
+	boolean bSlaveStillWorking;
 
 	context.Recv(MPI_COMM_WORLD, nAnySource, nAnyTag);
 	serializer.OpenForRead(&context);
@@ -672,14 +685,6 @@ int PLMPIMaster::ReceiveAndProcessMessage(int nAnyTag, int nAnySource)
 		// Mise a jour de l'index de la derniere tache
 		task->nSlaveTaskIndex = aSlave->GetTaskIndex();
 
-		// On enleve l'esclave qui a fini de la liste des travailleurs
-		bOk = FindPosOfRank(workers, nSource, position);
-		assert(bOk);
-		workers.RemoveAt(position);
-
-		// Decrementation du nombre d'esclaves qui travaillent
-		nWorkingSlaves--;
-
 		// Autorisation de lecture pour les output variables
 		task->SetSharedVariablesRW(&task->oaOutputVariables);
 		task->DeserializeSharedVariables(&serializer, &task->oaOutputVariables);
@@ -690,16 +695,34 @@ int PLMPIMaster::ReceiveAndProcessMessage(int nAnyTag, int nAnySource)
 			GetTracerMPI()->AddRecv(nSource, nTag);
 
 		// Si le slaveProcess a echoue on demande l'arret
+		// En mode pipeline, l'esclave ne traitera alors pas ses taches en attente
 		if (task->output_bSlaveProcessOk == false)
+		{
 			bSlaveError = true;
+			aSlave->RemoveAllPendingTasks();
+		}
 
-		// Mise a jour de l'esclave qui a fini, en cas d'erreur,
-		// l'esclave ne doit plus etre appele pour travailler
-		if (bSlaveError)
-			aSlave->SetState(State::ERROR);
-		else
-			aSlave->SetState(State::READY);
-		aSlave->SetProgression(0);
+		// L'esclave continue a travailler s'il a des taches en attente (mode pipeline)
+		bSlaveStillWorking = aSlave->GetPendingTaskNumber() > 0;
+
+		// Sinon, on enleve l'esclave qui a fini de la liste des travailleurs
+		if (not bSlaveStillWorking)
+		{
+			bOk = FindPosOfRank(workers, nSource, position);
+			assert(bOk);
+			workers.RemoveAt(position);
+
+			// Decrementation du nombre d'esclaves qui travaillent
+			nWorkingSlaves--;
+
+			// Mise a jour de l'esclave qui a fini, en cas d'erreur,
+			// l'esclave ne doit plus etre appele pour travailler
+			if (bSlaveError)
+				aSlave->SetState(State::ERROR);
+			else
+				aSlave->SetState(State::READY);
+			aSlave->SetProgression(0);
+		}
 
 		// Gestion des messages vers l'utilisateur
 		// Stockage de l'index de la tache et du nombre de ligne lues pour cette tache
@@ -724,6 +747,10 @@ int PLMPIMaster::ReceiveAndProcessMessage(int nAnyTag, int nAnySource)
 		DischargePendingCommunication(nSource, SLAVE_PROGRESSION);
 		bSlaveProcessOnce = true;
 
+		// Passage a la tache suivante de l'esclave, qu'il a deja recue
+		if (bSlaveStillWorking)
+			aSlave->StartNextPendingTask();
+
 		break;
 
 	case SLAVE_FATAL_ERROR:
@@ -871,30 +898,42 @@ void PLMPIMaster::GiveNewJob(PLSlaveState* slave, double dTaskPercent)
 
 	PLSerializer serializer;
 	PLMPIMsgContext context;
+	PLMPIPendingSend* pendingSend;
+	boolean bPipelined;
 
 	check(slave);
 	bSpawnedDone = true;
 
-	// Initialisation de l'etat de l'esclave
-	slave->SetTaskPercent(dTaskPercent);
-	slave->SetProgression(0);
-
-	// Si l'esclave n'est pas encore initialise, il ne passe pas dans l'etat processing
-	// il passera dans cet etat a la reception de sa fin d'initialisation
-	// Ceci a une incidence dur l'affichage de la progression
-	if (slave->IsReady())
+	// En mode pipeline, la tache est mise en attente si l'esclave est deja en cours de traitement
+	bPipelined = slave->IsProcessing();
+	if (bPipelined)
 	{
-		slave->SetState(State::PROCESSING);
-
-		// On met a jour l'index de la tache seulement si l'esclave est deja initialise
-		// Sinon elle sera mise a jour apres le SlaveInitialize (l'esclave enverra l'index de la
-		// tache avec le message de fin d'initialisation)
-		slave->SetTaskIndex(task->nTaskProcessedNumber);
+		assert(task->GetPipelineDepth() > slave->GetPendingTaskNumber() + 1);
+		slave->AddPendingTask(task->nTaskProcessedNumber, dTaskPercent);
 	}
 	else
 	{
-		slave->SetState(State::INIT);
-		nInitialisationCount++;
+		// Initialisation de l'etat de l'esclave
+		slave->SetTaskPercent(dTaskPercent);
+		slave->SetProgression(0);
+
+		// Si l'esclave n'est pas encore initialise, il ne passe pas dans l'etat processing
+		// il passera dans cet etat a la reception de sa fin d'initialisation
+		// Ceci a une incidence dur l'affichage de la progression
+		if (slave->IsReady())
+		{
+			slave->SetState(State::PROCESSING);
+
+			// On met a jour l'index de la tache seulement si l'esclave est deja initialise
+			// Sinon elle sera mise a jour apres le SlaveInitialize (l'esclave enverra l'index de la
+			// tache avec le message de fin d'initialisation)
+			slave->SetTaskIndex(task->nTaskProcessedNumber);
+		}
+		else
+		{
+			slave->SetState(State::INIT);
+			nInitialisationCount++;
+		}
 	}
 
 	// Envoi du TaskId et du mode Silencieux
@@ -904,17 +943,34 @@ void PLMPIMaster::GiveNewJob(PLSlaveState* slave, double dTaskPercent)
 	task->SetSharedVariablesNoPermission(&task->oaInputVariables);
 
 	// On envoie tous les parametres de la tache
-	context.Send(MPI_COMM_WORLD, slave->GetRank(),
-		     MASTER_TASK_INPUT); // TODO Passer cet envoi en non bloquant
-	serializer.OpenForWrite(&context);
-	task->SerializeSharedVariables(&serializer, &GetTask()->oaInputVariables, true);
-	if (GetTracerMPI()->GetActiveMode())
-		GetTracerMPI()->AddSend(slave->GetRank(), MASTER_TASK_INPUT);
-	serializer.Close();
+	// En mode pipeline, l'envoi est non bloquant pour ne pas attendre les esclaves occupes
+	if (task->GetPipelineDepth() > 1)
+	{
+		pendingSend = new PLMPIPendingSend;
+		pendingSend->GetSerializer()->OpenForWrite(NULL);
+		task->SerializeSharedVariables(pendingSend->GetSerializer(), &GetTask()->oaInputVariables, true);
+		pendingSend->GetSerializer()->Close();
+		if (GetTracerMPI()->GetActiveMode())
+			GetTracerMPI()->AddSend(slave->GetRank(), MASTER_TASK_INPUT);
+		pendingSend->Isend(MPI_COMM_WORLD, slave->GetRank(), MASTER_TASK_INPUT);
+		olPendingSends.AddTail(pendingSend);
+	}
+	else
+	{
+		context.Send(MPI_COMM_WORLD, slave->GetRank(), MASTER_TASK_INPUT);
+		serializer.OpenForWrite(&context);
+		task->SerializeSharedVariables(&serializer, &GetTask()->oaInputVariables, true);
+		if (GetTracerMPI()->GetActiveMode())
+			GetTracerMPI()->AddSend(slave->GetRank(), MASTER_TASK_INPUT);
+		serializer.Close();
+	}
 
 	// Incrementation du nombre d'esclaves qui travaillent
-	nWorkingSlaves++;
-	workers.AddTail(slave);
+	if (not bPipelined)
+	{
+		nWorkingSlaves++;
+		workers.AddTail(slave);
+	}
 
 	// Incrementation du taskId
 	task->nTaskProcessedNumber++;
@@ -924,6 +980,29 @@ void PLMPIMaster::GiveNewJob(PLSlaveState* slave, double dTaskPercent)
 	statsWorkingSlave.AddValue(nWorkingSlaves);
 }
 
+void PLMPIMaster::CompletePendingSends(boolean bWait)
+{
+	PLMPIPendingSend* pendingSend;
+	POSITION position;
+	POSITION currentPosition;
+
+	// Parcours des envois en cours pour detruire ceux qui sont termines
+	position = olPendingSends.GetHeadPosition();
+	while (position != NULL)
+	{
+		currentPosition = position;
+		pendingSend = cast(PLMPIPendingSend*, olPendingSends.GetNext(position));
+		if (bWait)
+			pendingSend->Wait();
+		if (bWait or pendingSend->Test())
+		{
+			olPendingSends.RemoveAt(currentPosition);
+			delete pendingSend;
+		}
+	}
+	ensure(not bWait or olPendingSends.IsEmpty());
+}
+
 void PLMPIMaster::ResetSlavesProgression()
 {
 	PLSlaveState* slave;
@@ -1112,3 +1191,74 @@ boolean PLMPIMaster::FindPosOfRank(ObjectList& slavesList, int nValue, POSITION&
 	}
 	return bOk;
 }
+
+////////////////////////////////////////////////////////////////////////////
+// Classe PLMPIPendingSend
+
+PLMPIPendingSend::PLMPIPendingSend()
+{
+	requests = NULL;
+	nRequestNumber = 0;
+}
+
+PLMPIPendingSend::~PLMPIPendingSend()
+{
+	// Les envois doivent etre termines pour pouvoir liberer le buffer
+	Wait();
+	if (requests != NULL)
+		delete[] requests;
+}
+
+void PLMPIPendingSend::Isend(const MPI_Comm& comm, int nRank, int nTag)
+{
+	int nSize;
+	int nBlockSize;
+	int nMessageSize;
+	int i;
+
+	require(requests == NULL);
+	require(not serializer.IsOpenForRead() and not serializer.IsOpenForWrite());
+
+	// Nombre de blocs, comme pour l'envoi au fil de l'eau : un message vide est envoye si le buffer est vide
+	nSize = serializer.cvBuffer.GetSize();
+	nBlockSize = serializer.InternalGetBlockSize();
+	nRequestNumber = (nSize + nBlockSize - 1) / nBlockSize;
+	if (nRequestNumber == 0)
+		nRequestNumber = 1;
+	requests = new MPI_Request[nRequestNumber];
+
+	// Envoi du buffer mono-bloc
+	if (serializer.InternalGetAllocSize() <= nBlockSize)
+	{
+		assert(nRequestNumber == 1);
+		MPI_Isend(serializer.InternalGetMonoBlockBuffer(), nSize, MPI_CHAR, nRank, nTag, comm, &requests[0]);
+	}
+	// Envoi de chaque bloc du buffer multi-blocs
+	else
+	{
+		for (i = 0; i < nRequestNumber; i++)
+		{
+			nMessageSize = nBlockSize;
+			if (i == nRequestNumber - 1)
+				nMessageSize = nSize - i * nBlockSize;
+			MPI_Isend(serializer.InternalGetMultiBlockBuffer(i), nMessageSize, MPI_CHAR, nRank, nTag, comm,
+				  &requests[i]);
+		}
+	}
+}
+
+boolean PLMPIPendingSend::Test()
+{
+	int nIsCompleted;
+
+	if (requests == NULL)
+		return true;
+	MPI_Testall(nRequestNumber, requests, &nIsCompleted, MPI_STATUSES_IGNORE);
+	return nIsCompleted != 0;
+}
+
+void PLMPIPendingSend::Wait()
+{
+	if (requests != NULL)
+		MPI_Waitall(nRequestNumber, requests, MPI_STATUSES_IGNORE);
+}
@@ -15,6 +15,8 @@
 #include "PLSerializer.h"
 #include "PLMPITaskDriver.h"
 
+class PLMPIPendingSend;
+
 ////////////////////////////////////////////////////////////////////////////
 // Classe PLMPIMaster.
 // Cette classe technique implemente un maitre MPI.
@@ -75,8 +77,14 @@ protected:
 
 	// Donne l'orde de travail a l'esclave passe en parametre
 	// lui envoie prealablement les taskParameters
+	// En mode pipeline, si l'esclave est deja en cours de traitement, la tache est ajoutee
+	// a sa file d'attente et ses inputs lui sont envoyes de facon non bloquante
 	void GiveNewJob(PLSlaveState*, double dTaskPercent);
 
+	// Liberation des envois non bloquants termines (mode pipeline)
+	// Si bWait, on attend la fin de tous les envois en cours
+	void CompletePendingSends(boolean bWait);
+
 	// Test la presence de nouveaux messages
 	boolean CheckNewMessage(int source, MPI_Comm com, MPI_Status& status, int nTag);
 
@@ -207,6 +215,42 @@ private:
 	int nFirstSlaveFinalizeMessageRank;
 
 	PLMPIMessageManager messageManager;
+
+	// Envois non bloquants des inputs en cours (mode pipeline)
+	ObjectList olPendingSends;
+};
+
+////////////////////////////////////////////////////////////////////////////
+// Classe PLMPIPendingSend
+// Envoi non bloquant du contenu d'un serializer, dont le buffer est conserve
+// jusqu'a la completion des envois de chacun de ses blocs.
+// Le decoupage en blocs est le meme que celui de l'envoi au fil de l'eau, ce qui
+// permet a l'esclave de recevoir le message de facon standard
+class PLMPIPendingSend : public Object
+{
+public:
+	// Constructeur
+	PLMPIPendingSend();
+	~PLMPIPendingSend();
+
+	// Serializer a alimenter en mode standard (OpenForWrite(NULL)), puis a fermer avant l'envoi
+	PLSerializer* GetSerializer();
+
+	// Envoi non bloquant de tous les blocs du serializer
+	void Isend(const MPI_Comm& comm, int nRank, int nTag);
+
+	// Renvoie true si tous les envois sont termines (non bloquant)
+	boolean Test();
+
+	// Attente de la fin de tous les envois
+	void Wait();
+
+	///////////////////////////////////////////////////////////////////////////////
+	///// Implementation
+protected:
+	PLSerializer serializer;
+	MPI_Request* requests;
+	int nRequestNumber;
 };
 
 ////////////////////////////////////////////////////////////
@@ -252,3 +296,8 @@ inline const PLMPITaskDriver* PLMPIMaster::GetDriver() const
 {
 	return cast(PLMPITaskDriver*, GetTask()->GetDriver());
 }
+
+inline PLSerializer* PLMPIPendingSend::GetSerializer()
+{
+	return &serializer;
+}
@@ -38,11 +38,12 @@ enum MESSAGE_TAG
 	FILE_SERVER_REQUEST_FILE_EXISTS,
 	FILE_SERVER_REQUEST_DIR_EXISTS,
 	FILE_SERVER_REQUEST_REMOVE,
-	FILE_SERVER_FREAD
+	FILE_SERVER_FREAD,
+	FILE_SERVER_FREAD_AHEAD
 };
 
 // Status en string pour les traces
-const ALString sTags[25] = {"SLAVE_END_PROCESSING", "SLAVE_DONE", "SLAVE_FATAL_ERROR", "SLAVE_INITIALIZE_DONE",
+const ALString sTags[26] = {"SLAVE_END_PROCESSING", "SLAVE_DONE", "SLAVE_FATAL_ERROR", "SLAVE_INITIALIZE_DONE",
 			    "SLAVE_PROGRESSION", "SLAVE_RANKS_HOSTNAME", "SLAVE_USER_MESSAGE", "MASTER_LAUNCH_WORKERS",
 			    "MASTER_LAUNCH_FILE_SERVERS", "MASTER_STOP_FILE_SERVERS", "MASTER_QUIT", "MASTER_RESOURCES",
 			    "MASTER_STOP_ORDER", "MASTER_TASK_INPUT", "MASTER_LOG_FILE", "MASTER_TRACER_MPI",
@@ -54,7 +55,8 @@ const ALString sTags[25] = {"SLAVE_END_PROCESSING", "SLAVE_DONE", "SLAVE_FATAL_E
 
 			    // Status utilises pour les acces aux fichiers distants
 			    "FILE_SERVER_REQUEST_SIZE", "FILE_SERVER_REQUEST_FILE_EXISTS",
-			    "FILE_SERVER_REQUEST_DIR_EXISTS", "FILE_SERVER_REQUEST_REMOVE", "FILE_SERVER_FREAD"};
+			    "FILE_SERVER_REQUEST_DIR_EXISTS", "FILE_SERVER_REQUEST_REMOVE", "FILE_SERVER_FREAD",
+			    "FILE_SERVER_FREAD_AHEAD"};
 
 inline ALString GetTagAsString(int i)
 {
@@ -288,6 +288,16 @@ boolean PLMPISlave::Process()
 					// de travailler)
 					SendResults();
 				}
+				// En mode pipeline, une tache pre-envoyee peut arriver apres un echec : elle n'est pas
+				// traitee, le maitre ayant supprime les taches en attente de l'esclave lors de la
+				// reception de l'echec
+				else
+				{
+					for (i = 0; i < task->oaInputVariables.GetSize(); i++)
+					{
+						cast(PLSharedVariable*, task->oaInputVariables.GetAt(i))->Clean();
+					}
+				}
 				break;
 
 			case MASTER_STOP_ORDER:
@@ -4,6 +4,8 @@
 
 #include "PLMPISystemFileDriverRemote.h"
 
+int PLMPISystemFileDriverRemote::nReadAheadBlockNumber = 16;
+
 PLMPISystemFileDriverRemote::PLMPISystemFileDriverRemote() {}
 
 PLMPISystemFileDriverRemote::~PLMPISystemFileDriverRemote() {}
@@ -210,6 +212,7 @@ void* PLMPISystemFileDriverRemote::Open(const char* sFilePathName, char cMode)
 	boolean bOk;
 	ALString sMessage;
 	RemoteFile* file;
+	int i;
 
 	require(cMode == 'r');
 
@@ -227,6 +230,17 @@ void* PLMPISystemFileDriverRemote::Open(const char* sFilePathName, char cMode)
 		file->lPos = 0;
 		file->bIsOpen = true;
 		file->sFileName = sFilePathName;
+		file->nFileServerRank = PLMPITaskDriver::GetDriver()->nFileServerRank;
+		file->lLastReadEnd = 0;
+		file->nCurrentWindow = 0;
+		for (i = 0; i < 2; i++)
+		{
+			file->readAheadWindows[i].sBuffer = NULL;
+			file->readAheadWindows[i].nSize = 0;
+			file->readAheadWindows[i].lPos = 0;
+			file->readAheadWindows[i].nAvailable = 0;
+			file->readAheadWindows[i].bPending = false;
+		}
 		return file;
 	}
 	else
@@ -241,11 +255,21 @@ void* PLMPISystemFileDriverRemote::Open(const char* sFilePathName, char cMode)
 boolean PLMPISystemFileDriverRemote::Close(void* stream)
 {
 	RemoteFile* file;
+	int i;
 
 	assert(stream != NULL);
 	file = (RemoteFile*)stream; // TODO la methode cast ne fonctionne pas, pourquoi ?
 
 	assert(file->bIsOpen == true);
+
+	// Fin des lectures anticipees en cours et liberation des buffers
+	for (i = 0; i < 2; i++)
+	{
+		if (file->readAheadWindows[i].bPending)
+			WaitReadAhead(&file->readAheadWindows[i]);
+		if (file->readAheadWindows[i].sBuffer != NULL)
+			delete[] file->readAheadWindows[i].sBuffer;
+	}
 	delete file;
 	file = NULL;
 
@@ -259,15 +283,14 @@ longint PLMPISystemFileDriverRemote::Fread(void* ptr, size_t size, size_t count,
 {
 	longint lRes;
 	RemoteFile* file;
+	RemoteReadAheadWindow* window;
+	RemoteReadAheadWindow* nextWindow;
 	boolean bOk;
-	PLMPIMsgContext context;
-	PLSerializer serializer;
-	int nSizeToRecv;
-	int nPos;
-	int nLocalSize;
-	MPI_Status status;
-	// TODO etudier les perfs en faisant varier la taille du buffer
-	const int nBlocSize = InputBufferedFile::InternalGetBlockSize();
+	longint lCount;
+	longint lStartPos;
+	longint lRead;
+	int nOffset;
+	int nCopySize;
 
 	assert(stream != NULL);
 	file = (RemoteFile*)stream;
@@ -279,47 +302,63 @@ longint PLMPISystemFileDriverRemote::Fread(void* ptr, size_t size, size_t count,
 
 	if (bOk)
 	{
-		// Envoi du nom du fichier, de la position et de la taille du buffer
-		// On envoie egalement la taille du bloc : le buffer resultat n'est pas envoye en entier mais par blocs
-		context.Send(MPI_COMM_WORLD, PLMPITaskDriver::GetDriver()->nFileServerRank, FILE_SERVER_FREAD);
-		serializer.OpenForWrite(&context);
-		serializer.PutString(FileService::GetURIFilePathName(file->sFileName));
-		serializer.PutLongint(file->lPos);
-		serializer.PutLongint(size);
-		serializer.PutLongint(count);
-		serializer.PutInt(nBlocSize);
-		serializer.Close();
+		lCount = (longint)size * count;
+		lStartPos = file->lPos;
+		lRes = 0;
 
-		// Reception du nombre d'octets lus et du code d'erreur
-		context.Recv(MPI_COMM_WORLD, PLMPITaskDriver::GetDriver()->nFileServerRank, FILE_SERVER_FREAD);
-		serializer.OpenForRead(&context);
-		lRes = serializer.GetLongint();
-		errno = serializer.GetInt();
-		serializer.Close();
+		// Copie des donnees deja recues par lecture anticipee, en passant d'une fenetre a l'autre
+		while (lRes < lCount)
+		{
+			window = &file->readAheadWindows[file->nCurrentWindow];
+			if (window->bPending)
+				WaitReadAhead(window);
+			if (file->lPos >= window->lPos and file->lPos < window->lPos + window->nAvailable)
+			{
+				nOffset = (int)(file->lPos - window->lPos);
+				nCopySize = (int)min((longint)window->nAvailable - nOffset, lCount - lRes);
+				memcpy(&((char*)ptr)[lRes], &window->sBuffer[nOffset], nCopySize);
+				lRes += nCopySize;
+				file->lPos += nCopySize;
+			}
+			else
+			{
+				// Passage a la fenetre suivante si elle debute a la position courante
+				nextWindow = &file->readAheadWindows[1 - file->nCurrentWindow];
+				if ((nextWindow->bPending or nextWindow->nAvailable > 0) and nextWindow->lPos == file->lPos)
+					file->nCurrentWindow = 1 - file->nCurrentWindow;
+				else
+					break;
+			}
+		}
 
-		// Reception du buffer (on n'utilise pas de serializer pour ne pas avoir a recopier la memoire)
-		assert(lRes <= INT_MAX);
-		nSizeToRecv = (int)lRes;
-		nPos = 0;
-		while (nSizeToRecv > 0)
+		// Lecture synchrone de ce qui n'a pas ete lu par anticipation
+		if (lRes < lCount)
 		{
-			nLocalSize = min(nSizeToRecv, nBlocSize);
-			MPI_Recv(&((char*)ptr)[nPos], nLocalSize, MPI_CHAR,
-				 PLMPITaskDriver::GetDriver()->nFileServerRank, FILE_SERVER_FREAD, MPI_COMM_WORLD,
-				 &status);
-			debug(int nCount);
-			debug(MPI_Get_count(&status, MPI_CHAR, &nCount));
-			debug(assert(nCount == nLocalSize));
-
-			nPos += nLocalSize;
-			nSizeToRecv -= nLocalSize;
+			lRead = RemoteRead(file, &((char*)ptr)[lRes], lCount - lRes);
+			if (lRead < 0)
+				lRes = -1;
+			else
+			{
+				lRes += lRead;
+				file->lPos += lRead;
+			}
 		}
 
-		// Mise a jour de la position courante
-		file->lPos += lRes;
+		// Relance des lectures anticipees uniquement dans le cas d'un acces sequentiel,
+		// pour ne pas penaliser les acces aleatoires
+		if (lRes >= 0)
+		{
+			if (lStartPos == file->lLastReadEnd and lRes == lCount)
+				UpdateReadAhead(file);
+			file->lLastReadEnd = file->lPos;
+		}
 	}
 	if (errno != 0)
 		lRes = -1;
+
+	// On renvoie un nombre d'elements, comme fread
+	if (lRes > 0 and size > 1)
+		lRes /= size;
 	return lRes;
 }
 
@@ -436,3 +475,178 @@ boolean PLMPISystemFileDriverRemote::ReserveExtraSize(longint lSize, void* strea
 	assert(false);
 	return false;
 }
+
+void PLMPISystemFileDriverRemote::SetReadAheadBlockNumber(int nValue)
+{
+	require(nValue >= 0);
+	nReadAheadBlockNumber = nValue;
+}
+
+int PLMPISystemFileDriverRemote::GetReadAheadBlockNumber()
+{
+	return nReadAheadBlockNumber;
+}
+
+longint PLMPISystemFileDriverRemote::RemoteRead(RemoteFile* file, char* sBuffer, longint lCount)
+{
+	longint lRes;
+	PLMPIMsgContext context;
+	PLSerializer serializer;
+	int nSizeToRecv;
+	int nPos;
+	int nLocalSize;
+	MPI_Status status;
+	// TODO etudier les perfs en faisant varier la taille du buffer
+	const int nBlocSize = InputBufferedFile::InternalGetBlockSize();
+
+	require(file != NULL);
+	require(sBuffer != NULL);
+	require(lCount >= 0);
+
+	// Envoi du nom du fichier, de la position et de la taille du buffer
+	// On envoie egalement la taille du bloc : le buffer resultat n'est pas envoye en entier mais par blocs
+	context.Send(MPI_COMM_WORLD, file->nFileServerRank, FILE_SERVER_FREAD);
+	serializer.OpenForWrite(&context);
+	serializer.PutString(FileService::GetURIFilePathName(file->sFileName));
+	serializer.PutLongint(file->lPos);
+	serializer.PutLongint(1);
+	serializer.PutLongint(lCount);
+	serializer.PutInt(nBlocSize);
+	serializer.Close();
+
+	// Reception du nombre d'octets lus et du code d'erreur
+	context.Recv(MPI_COMM_WORLD, file->nFileServerRank, FILE_SERVER_FREAD);
+	serializer.OpenForRead(&context);
+	lRes = serializer.GetLongint();
+	errno = serializer.GetInt();
+	serializer.Close();
+
+	// Reception du buffer (on n'utilise pas de serializer pour ne pas avoir a recopier la memoire)
+	assert(lRes <= INT_MAX);
+	nSizeToRecv = (int)lRes;
+	nPos = 0;
+	while (nSizeToRecv > 0)
+	{
+		nLocalSize = min(nSizeToRecv, nBlocSize);
+		MPI_Recv(&sBuffer[nPos], nLocalSize, MPI_CHAR, file->nFileServerRank, FILE_SERVER_FREAD,
+			 MPI_COMM_WORLD, &status);
+		debug(int nCount);
+		debug(MPI_Get_count(&status, MPI_CHAR, &nCount));
+		debug(assert(nCount == nLocalSize));
+
+		nPos += nLocalSize;
+		nSizeToRecv -= nLocalSize;
+	}
+	if (errno != 0)
+		lRes = -1;
+	return lRes;
+}
+
+void PLMPISystemFileDriverRemote::PostReadAhead(RemoteFile* file, RemoteReadAheadWindow* window, longint lPos)
+{
+	PLMPIMsgContext context;
+	PLSerializer serializer;
+
+	require(file != NULL);
+	require(window != NULL);
+	require(nReadAheadBlockNumber > 0);
+	require(lPos >= 0);
+
+	// Attente de la reception en cours, le buffer devant etre reutilise
+	if (window->bPending)
+		WaitReadAhead(window);
+
+	// Allocation du buffer lors de la premiere utilisation
+	if (window->sBuffer == NULL)
+	{
+		window->nSize = nReadAheadBlockNumber * InputBufferedFile::InternalGetBlockSize();
+		window->sBuffer = new char[window->nSize];
+	}
+	window->lPos = lPos;
+	window->nAvailable = 0;
+	window->bPending = true;
+
+	// Les receptions sont postees avant l'envoi de la requete: la reponse du serveur ne peut ainsi pas etre
+	// interceptee par une autre reception, et est recue pendant que l'appelant traite les donnees precedentes
+	// Les reponses d'un serveur arrivent dans l'ordre des requetes, qui est aussi l'ordre des receptions postees
+	MPI_Irecv(window->lHeader, 2, MPI_LONG_LONG, file->nFileServerRank, FILE_SERVER_FREAD_AHEAD, MPI_COMM_WORLD,
+		  &window->requests[0]);
+	MPI_Irecv(window->sBuffer, window->nSize, MPI_CHAR, file->nFileServerRank, FILE_SERVER_FREAD_AHEAD,
+		  MPI_COMM_WORLD, &window->requests[1]);
+
+	// Envoi du nom du fichier, de la position et de la taille de la fenetre
+	context.Send(MPI_COMM_WORLD, file->nFileServerRank, FILE_SERVER_FREAD_AHEAD);
+	serializer.OpenForWrite(&context);
+	serializer.PutString(FileService::GetURIFilePathName(file->sFileName));
+	serializer.PutLongint(lPos);
+	serializer.PutInt(window->nSize);
+	serializer.Close();
+}
+
+void PLMPISystemFileDriverRemote::WaitReadAhead(RemoteReadAheadWindow* window)
+{
+	require(window != NULL);
+	require(window->bPending);
+
+	MPI_Waitall(2, window->requests, MPI_STATUSES_IGNORE);
+	window->bPending = false;
+
+	// En cas d'erreur, la fenetre est ignoree: c'est la lecture synchrone qui remontera l'erreur
+	if (window->lHeader[1] != 0)
+		window->nAvailable = 0;
+	else
+	{
+		assert(0 <= window->lHeader[0] and window->lHeader[0] <= window->nSize);
+		window->nAvailable = (int)window->lHeader[0];
+	}
+}
+
+void PLMPISystemFileDriverRemote::UpdateReadAhead(RemoteFile* file)
+{
+	RemoteReadAheadWindow* window;
+	RemoteReadAheadWindow* nextWindow;
+	longint lNextPos;
+	int nFlag;
+
+	require(file != NULL);
+
+	if (nReadAheadBlockNumber == 0)
+		return;
+
+	// La fenetre courante doit couvrir la position courante
+	window = &file->readAheadWindows[file->nCurrentWindow];
+	nextWindow = &file->readAheadWindows[1 - file->nCurrentWindow];
+	if (not window->bPending and
+	    not(file->lPos >= window->lPos and file->lPos < window->lPos + window->nAvailable))
+	{
+		// On passe a la fenetre suivante si elle debute a la position courante, sinon on relance la
+		// fenetre courante a partir de la position courante
+		if ((nextWindow->bPending or nextWindow->nAvailable > 0) and nextWindow->lPos == file->lPos)
+		{
+			file->nCurrentWindow = 1 - file->nCurrentWindow;
+			window = nextWindow;
+			nextWindow = &file->readAheadWindows[1 - file->nCurrentWindow];
+		}
+		else
+			PostReadAhead(file, window, file->lPos);
+	}
+
+	// La fenetre suivante est chainee a la fin de la fenetre courante, sauf si la fin de fichier est atteinte
+	if (window->bPending or window->nAvailable == window->nSize)
+	{
+		lNextPos = window->lPos + window->nSize;
+		if (not((nextWindow->bPending or nextWindow->nAvailable > 0) and nextWindow->lPos == lNextPos))
+			PostReadAhead(file, nextWindow, lNextPos);
+	}
+
+	// Progression des receptions en cours, pour ne pas bloquer le serveur de fichiers sur ses envois
+	if (nextWindow->bPending)
+	{
+		MPI_Testall(2, nextWindow->requests, &nFlag, MPI_STATUSES_IGNORE);
+		if (nFlag)
+		{
+			// Les requetes terminees sont remplacees par MPI_REQUEST_NULL, l'attente est alors immediate
+			WaitReadAhead(nextWindow);
+		}
+	}
+}
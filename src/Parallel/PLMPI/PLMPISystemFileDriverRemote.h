@@ -9,6 +9,41 @@
 #include "PLMPImpi_wrapper.h"
 #include "PLMPITaskDriver.h"
 
+// Fenetre de lecture anticipee d'un fichier distant
+struct RemoteReadAheadWindow
+{
+	// Buffer de reception, de taille nSize
+	char* sBuffer;
+	int nSize;
+
+	// Position du debut de la fenetre dans le fichier, et nombre d'octets recus
+	longint lPos;
+	int nAvailable;
+
+	// Reception en cours: requetes MPI de reception de l'entete (nombre d'octets lus, errno) et des donnees
+	boolean bPending;
+	MPI_Request requests[2];
+	longint lHeader[2];
+};
+
+// Handle sur un fichier distant
+struct RemoteFile
+{
+	longint lPos;
+	boolean bIsOpen;
+	ALString sFileName;
+
+	// Rang du serveur de fichier
+	int nFileServerRank;
+
+	// Fin de la derniere lecture, pour detecter les acces sequentiels
+	longint lLastReadEnd;
+
+	// Fenetres de lecture anticipee, utilisees alternativement
+	RemoteReadAheadWindow readAheadWindows[2];
+	int nCurrentWindow;
+};
+
 ///////////////////////////////////////////////////////////////////////////
 // Classe PLMPISystemFileDriverRemote
 // Classe d'acces aux fichiers distants
@@ -45,12 +80,30 @@ public:
 	boolean ReserveExtraSize(longint lSize, void* stream) override;
 
 	// TODO ?? boolean CopyFileToLocal(const char* sSourceFilePathName, const char* sDestFilePathName);
-};
 
-// Handle sur un fichier distant
-struct RemoteFile
-{
-	longint lPos;
-	boolean bIsOpen;
-	ALString sFileName;
+	// Nombre de blocs lus par anticipation lors d'une lecture sequentielle (defaut: 16)
+	// Chaque fichier ouvert utilise deux fenetres de lecture anticipee de cette taille: pendant que
+	// l'appelant consomme l'une, l'autre est en cours de reception depuis le serveur de fichiers
+	// Une valeur de 0 desactive la lecture anticipee
+	static void SetReadAheadBlockNumber(int nValue);
+	static int GetReadAheadBlockNumber();
+
+	///////////////////////////////////////////////////////////////////////
+	///// Implementation
+protected:
+	// Lecture synchrone aupres du serveur de fichiers, a partir de la position courante du fichier
+	// Renvoie le nombre d'octets lus, -1 en cas d'erreur
+	longint RemoteRead(RemoteFile* file, char* sBuffer, longint lCount);
+
+	// Lecture anticipee: emission de la requete pour une fenetre et reception non bloquante de la reponse
+	void PostReadAhead(RemoteFile* file, RemoteReadAheadWindow* window, longint lPos);
+
+	// Attente de la fin de reception d'une fenetre en cours de lecture anticipee
+	void WaitReadAhead(RemoteReadAheadWindow* window);
+
+	// Mise a jour des fenetres de lecture anticipee apres une lecture
+	void UpdateReadAhead(RemoteFile* file);
+
+	// Nombre de blocs lus par anticipation
+	static int nReadAheadBlockNumber;
 };
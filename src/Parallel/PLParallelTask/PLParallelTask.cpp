@@ -54,6 +54,7 @@ PLParallelTask::PLParallelTask()
 	bSlaveInitializeErrorsOnce = true;
 	bSlaveFinalizeErrorsOnce = true;
 	bSlaveAtRestWithoutProcessing = false;
+	nPipelineDepth = 1;
 
 	// Declaration des variables partagees qui contiennent les constantes systeme
 	DeclareSharedParameter(&input_bVerbose);
@@ -2314,6 +2315,10 @@ PLSlaveState* PLParallelTask::GetReadySlave()
 			if (readySlave != NULL)
 				return readySlave;
 		}
+
+		// En mode pipeline, on pre-envoie du travail aux esclaves occupes
+		if (nPipelineDepth > 1)
+			return GetPipelineSlave();
 		return NULL;
 	}
 	else
@@ -2365,6 +2370,29 @@ PLSlaveState* PLParallelTask::GetReadySlaveOnHost(ObjectArray* oaSlavesInHost)
 	return NULL;
 }
 
+PLSlaveState* PLParallelTask::GetPipelineSlave()
+{
+	PLSlaveState* slave;
+	PLSlaveState* pipelineSlave;
+	int i;
+
+	require(nPipelineDepth > 1);
+
+	// Recherche de l'esclave en cours de traitement qui a le moins de taches en attente
+	pipelineSlave = NULL;
+	for (i = 0; i < oaSlaves.GetSize(); i++)
+	{
+		slave = cast(PLSlaveState*, oaSlaves.GetAt(i));
+		if (slave->IsProcessing() and not slave->GetAtRest() and
+		    slave->GetPendingTaskNumber() < nPipelineDepth - 1)
+		{
+			if (pipelineSlave == NULL or slave->GetPendingTaskNumber() < pipelineSlave->GetPendingTaskNumber())
+				pipelineSlave = slave;
+		}
+	}
+	return pipelineSlave;
+}
+
 void PLParallelTask::SerializeSharedVariables(PLSerializer* serializer, ObjectArray* oaVariables, boolean bClean) const
 {
 	Object* oElement;
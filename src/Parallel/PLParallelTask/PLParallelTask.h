@@ -450,6 +450,18 @@ protected:
 	void SetBoostMode(boolean bBoost);
 	boolean GetBoostMode() const;
 
+	// Mode pipeline : nombre maximum de taches confiees simultanement a un meme esclave (par defaut 1)
+	// Au dela de 1, le maitre pre-envoie (de facon non bloquante) les inputs des taches suivantes a des esclaves
+	// deja en cours de traitement, lorsqu'aucun esclave n'est disponible : l'esclave enchaine alors ses
+	// SlaveProcess sans attendre l'aller-retour avec le maitre. Les resultats sont agreges dans leur ordre
+	// d'arrivee, comme dans le mode standard.
+	// A reserver aux taches a grain fin dont le MasterPrepareTaskInput ne depend pas des resultats
+	// des taches en cours (les taches pre-envoyees ne peuvent pas etre reprises)
+	// Sans effet en mode sequentiel ou parallele simule
+	// A parametrer avant le lancement de la tache (typiquement dans le constructeur)
+	void SetPipelineDepth(int nDepth);
+	int GetPipelineDepth() const;
+
 	// Methode utilitaire pour l'affectation de la taille du buffer de lecture pour eviter que les esclaves accedent
 	// au fichier tous en meme temps. La taille est comprise entre nBufferSizeMin et nBufferSizeMax
 	// - pour les GetProcessNumber() premiers chunks, on fait une marche d'escalier reguliere de nBufferSizeMin a
@@ -587,6 +599,11 @@ private:
 	// Les esclaves deja initialises sont privilegies
 	PLSlaveState* GetReadySlaveOnHost(ObjectArray* oaSlaves);
 
+	// En mode pipeline, renvoie l'esclave en cours de traitement ayant le moins de taches en attente,
+	// s'il peut encore en recevoir (cf. SetPipelineDepth)
+	// Renvoie NULL sinon
+	PLSlaveState* GetPipelineSlave();
+
 	// Renvoie le slave dont le rang est rank
 	// Renvoie NULL si aucun esclave n'a ce rang
 	PLSlaveState* GetSlaveWithRank(int nRank) const;
@@ -790,6 +807,9 @@ private:
 	// Mode boost : les esclaves ne font plus de prob et SystemSleep
 	PLShared_Boolean shared_bBoostedMode;
 
+	// Nombre maximum de taches confiees simultanement a un esclave (mode pipeline)
+	int nPipelineDepth;
+
 	// Nom de la tache dans les traces de performance
 	// on ajoute le nombre d'instances au nom de la tache : la meme tache peut etre lancee plusieurs fois
 	ALString sPerformanceTaskName;
@@ -993,6 +1013,17 @@ inline boolean PLParallelTask::GetBoostMode() const
 	return shared_bBoostedMode;
 }
 
+inline void PLParallelTask::SetPipelineDepth(int nDepth)
+{
+	require(nDepth >= 1);
+	nPipelineDepth = nDepth;
+}
+
+inline int PLParallelTask::GetPipelineDepth() const
+{
+	return nPipelineDepth;
+}
+
 inline boolean PLParallelTask::IsSlaveAtRest() const
 {
 	require(method == MASTER_AGGREGATE);
@@ -156,6 +156,7 @@ protected:
 
 	friend class PLMPITaskDriver;
 	friend class PLMPISlaveProgressionManager; // Pour envoi assynchrone
+	friend class PLMPIPendingSend;             // Pour envoi assynchrone des inputs en mode pipeline
 
 	// Methodes privees tres techniques
 	// Mise a disposition des attributs protected aux classes friends
@@ -29,6 +29,7 @@ void PLSlaveState::Initialize()
 	sHostName = "";
 	bMustRest = false;
 	nTaskIndex = -1;
+	RemoveAllPendingTasks();
 }
 
 void PLSlaveState::SetRank(int nValue)
@@ -95,6 +96,43 @@ double PLSlaveState::GetTaskPercent() const
 	return dPercentOfTheJob;
 }
 
+void PLSlaveState::AddPendingTask(int nIndex, double dPercent)
+{
+	require(nIndex >= 0);
+	require(0 <= dPercent and dPercent <= 1);
+	require(IsProcessing());
+
+	ivPendingTaskIndexes.Add(nIndex);
+	dvPendingTaskPercents.Add(dPercent);
+}
+
+void PLSlaveState::StartNextPendingTask()
+{
+	int i;
+
+	require(GetPendingTaskNumber() > 0);
+
+	// La premiere tache en attente devient la tache courante
+	nTaskIndex = ivPendingTaskIndexes.GetAt(0);
+	dPercentOfTheJob = dvPendingTaskPercents.GetAt(0);
+	nProgression = 0;
+
+	// Decalage des taches restantes (la file est de petite taille)
+	for (i = 1; i < ivPendingTaskIndexes.GetSize(); i++)
+	{
+		ivPendingTaskIndexes.SetAt(i - 1, ivPendingTaskIndexes.GetAt(i));
+		dvPendingTaskPercents.SetAt(i - 1, dvPendingTaskPercents.GetAt(i));
+	}
+	ivPendingTaskIndexes.SetSize(ivPendingTaskIndexes.GetSize() - 1);
+	dvPendingTaskPercents.SetSize(dvPendingTaskPercents.GetSize() - 1);
+}
+
+void PLSlaveState::RemoveAllPendingTasks()
+{
+	ivPendingTaskIndexes.SetSize(0);
+	dvPendingTaskPercents.SetSize(0);
+}
+
 const ALString& PLSlaveState::PrintState() const
 {
 	return GetStateAsString(state);
@@ -173,6 +211,8 @@ void PLSlaveState::Write(ostream& ost) const
 {
 	ost << nRank << " on " << sHostName << " " << PrintState() << " progression : " << IntToString(GetProgression())
 	    << " Task% : " << DoubleToString(dPercentOfTheJob * 100);
+	if (GetPendingTaskNumber() > 0)
+		cout << " pending tasks : " << GetPendingTaskNumber();
 	if (bMustRest)
 		cout << " AT REST";
 	cout << endl;
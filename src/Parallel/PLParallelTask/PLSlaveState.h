@@ -73,6 +73,18 @@ public:
 	// Est-ce que l'esclave a travaille
 	boolean HasWorked() const;
 
+	// Gestion des taches pre-envoyees a l'esclave en mode pipeline (cf. PLParallelTask::SetPipelineDepth)
+	// Ces taches sont en file d'attente derriere la tache courante (index et pourcentage courants)
+	// et seront traitees par l'esclave dans leur ordre d'envoi
+	void AddPendingTask(int nIndex, double dPercent);
+	int GetPendingTaskNumber() const;
+
+	// Passage a la premiere tache en attente, qui devient la tache courante
+	void StartNextPendingTask();
+
+	// Suppression des taches en attente (l'esclave ne les traitera pas, par exemple apres une erreur)
+	void RemoveAllPendingTasks();
+
 	void SetState(State nState);
 	State GetState() const;
 	const ALString& PrintState() const;
@@ -114,6 +126,10 @@ protected:
 	// Est-ce qu el'esclave doit se reposer
 	boolean bMustRest;
 
+	// Index et pourcentages des taches en attente (mode pipeline)
+	IntVector ivPendingTaskIndexes;
+	DoubleVector dvPendingTaskPercents;
+
 	static const ALString sVOID;
 	static const ALString sINIT;
 	static const ALString sREADY;
@@ -165,6 +181,11 @@ inline boolean PLSlaveState::HasWorked() const
 	return bHasWorked;
 }
 
+inline int PLSlaveState::GetPendingTaskNumber() const
+{
+	return ivPendingTaskIndexes.GetSize();
+}
+
 inline State PLSlaveState::GetState() const
 {
 	return state;
@@ -396,6 +396,15 @@ void RMParallelResourceManager::Test()
 
 	test.Solve();
 
+	// Exigence partagee par machine : comptabilisee une seule fois, quel que soit le nombre d'esclaves
+	test.Reset();
+	test.SetTestLabel("1 machine : host shared requirement");
+	test.SetCluster(RMResourceSystem::CreateSyntheticCluster(1, 64, 64 * lGB, 0, 0));
+	test.GetTaskRequirement()->GetSlaveRequirement()->GetMemory()->Set(512 * lMB);
+	test.GetTaskRequirement()->GetMasterRequirement()->GetMemory()->Set(512 * lMB);
+	test.GetTaskRequirement()->GetHostSharedRequirement()->GetMemory()->Set(20 * lGB);
+	test.Solve();
+
 	// Contrainte globale
 	test.Reset();
 	test.SetTestLabel("Global Constraint");
@@ -1285,7 +1294,8 @@ PLHostClassDefinition* PLHostClassDefinition::BuildClassDefinitionForHost(const
 		lHostOverallMax = requirements->GetMasterMin(nRT) + requirements->GetSharedMin(nRT) +
 				  host->GetLogicalProcessNumber() *
 				      (requirements->GetSlaveMin(nRT) + requirements->GetSharedMin(nRT)) +
-				  requirements->GetSlaveGlobalMin(nRT) / host->GetLogicalProcessNumber();
+				  requirements->GetSlaveGlobalMin(nRT) / host->GetLogicalProcessNumber() +
+				  requirements->GetHostSharedMin(nRT);
 		lHostResource = host->GetResourceFree(nRT);
 		if (lHostResource >= lHostOverallMax)
 		{
@@ -1503,6 +1513,7 @@ PLSolutionResources* PLHostClass::SaturateResource(const RMTaskResourceRequireme
 	longint lSlaveMax;           // Exigence
 	longint lGlobalMax;          // Exigence
 	longint lSharedMax;          // Exigence
+	longint lHostSharedMin;      // Exigence comptabilisee une seule fois sur la machine
 	longint lHostOverallMin;     // Exigences minimales sur cette machine
 	longint lHostOverallMax;     // Exigences maximales sur cette machine
 	longint lHostResource;       // Ressources physiques disponibles sur cette machine
@@ -1565,6 +1576,7 @@ PLSolutionResources* PLHostClass::SaturateResource(const RMTaskResourceRequireme
 		lSlaveMin = taskRequirements->GetSlaveMin(nRT);
 		lGlobalMin = taskRequirements->GetSlaveGlobalMin(nRT);
 		lSharedMin = taskRequirements->GetSharedMin(nRT);
+		lHostSharedMin = taskRequirements->GetHostSharedMin(nRT);
 
 		// Pour eviter les problemes d'infini dans les calculs (INF+INF=INF) On borne les max par la memoire
 		// disonible
@@ -1580,9 +1592,9 @@ PLSolutionResources* PLHostClass::SaturateResource(const RMTaskResourceRequireme
 		// Calcul de la somme ressources min et max
 		if (bIsSequential)
 		{
-			lHostOverallMin = lMasterMin + lSlaveMin + lSharedMin + lGlobalMin +
+			lHostOverallMin = lMasterMin + lSlaveMin + lSharedMin + lGlobalMin + lHostSharedMin +
 					  RMParallelResourceManager::GetMasterHiddenResource(bIsSequential, nRT);
-			lHostOverallMax = lsum(lMasterMax, lSlaveMax, lSharedMax, lGlobalMax,
+			lHostOverallMax = lsum(lsum(lMasterMax, lSlaveMax, lSharedMax, lGlobalMax, lHostSharedMin),
 					       RMParallelResourceManager::GetMasterHiddenResource(bIsSequential, nRT));
 		}
 		else
@@ -1593,9 +1605,10 @@ PLSolutionResources* PLHostClass::SaturateResource(const RMTaskResourceRequireme
 				 lSharedMin) +
 			    nSlaveNumberOnHost *
 				(lSlaveMin + RMParallelResourceManager::GetSlaveHiddenResource(bIsSequential, nRT) +
-				 lGlobalMin / nSlaveNumberOnCluster + lSharedMin);
+				 lGlobalMin / nSlaveNumberOnCluster + lSharedMin) +
+			    lHostSharedMin;
 			lHostOverallMax = lsum(
-			    lprod((nSlaveNumberOnHost + nMasterNumberOnHost), lSharedMax),
+			    lsum(lprod((nSlaveNumberOnHost + nMasterNumberOnHost), lSharedMax), lHostSharedMin),
 			    lprod(nSlaveNumberOnHost, lGlobalMax / nSlaveNumberOnCluster),
 			    lprod(nMasterNumberOnHost,
 				  lsum(lMasterMax,
@@ -2332,6 +2345,7 @@ boolean PLSolution::FitMinimalRequirements(int nRT, longint& lMissingResource, b
 	longint lHostUsableResource;
 	longint lMasterSum;
 	longint lSlaveMin;
+	longint lHostSharedSum;
 
 	// Nombre d'esclave utilises sur le cluster
 	nSlaveNumberOnCluster = GetUsedProcessNumber();
@@ -2358,6 +2372,7 @@ boolean PLSolution::FitMinimalRequirements(int nRT, longint& lMissingResource, b
 		lHostUsableResource = hostClass->GetAvaiblableResource(nRT);
 		lUsedResource = taskRequirements->GetMasterMin(nRT) + taskRequirements->GetSlaveMin(nRT) +
 				taskRequirements->GetSharedMin(nRT) + taskRequirements->GetSlaveGlobalMin(nRT) +
+				taskRequirements->GetHostSharedMin(nRT) +
 				RMParallelResourceManager::GetMasterHiddenResource(bIsSequential, nRT);
 		lLocalMissingResource = lUsedResource - lHostUsableResource;
 		if (lLocalMissingResource > 0)
@@ -2372,10 +2387,11 @@ boolean PLSolution::FitMinimalRequirements(int nRT, longint& lMissingResource, b
 	{
 
 		// Precalcul des ressources utilises par le maitre et chaque esclave avant la boucle pour plus
-		// d'efficacite
+		// d'efficacite (ainsi que des ressources comptabilisees une seule fois par machine)
 		lMasterSum = taskRequirements->GetMasterMin(nRT) +
 			     RMParallelResourceManager::GetMasterHiddenResource(bIsSequential, nRT) +
 			     taskRequirements->GetSharedMin(nRT);
+		lHostSharedSum = taskRequirements->GetHostSharedMin(nRT);
 		lSlaveMin = taskRequirements->GetSlaveMin(nRT) +
 			    RMParallelResourceManager::GetSlaveHiddenResource(bIsSequential, nRT) +
 			    taskRequirements->GetSlaveGlobalMin(nRT) / nSlaveNumberOnCluster +
@@ -2402,7 +2418,8 @@ boolean PLSolution::FitMinimalRequirements(int nRT, longint& lMissingResource, b
 					if (hostClassSolution->GetHostCountPerProcNumber()->GetAt(nProcNumber) != 0)
 					{
 						// Resources necessaires sur ce host
-						lUsedResource = lMasterSum + ((longint)nProcNumber - 1) * lSlaveMin;
+						lUsedResource =
+						    lMasterSum + ((longint)nProcNumber - 1) * lSlaveMin + lHostSharedSum;
 
 						// Ressources disponibles sur le host
 						lLocalMissingResource = lUsedResource - lHostUsableResource;
@@ -2428,7 +2445,7 @@ boolean PLSolution::FitMinimalRequirements(int nRT, longint& lMissingResource, b
 					if (hostClassSolution->GetHostCountPerProcNumber()->GetAt(nProcNumber) != 0)
 					{
 						// Resources necessaires sur ce host
-						lUsedResource = nProcNumber * lSlaveMin;
+						lUsedResource = nProcNumber * lSlaveMin + lHostSharedSum;
 
 						// Ressources disponibles sur le host
 						lLocalMissingResource = lUsedResource - lHostUsableResource;
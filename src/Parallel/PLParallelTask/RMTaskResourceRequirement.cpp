@@ -20,6 +20,7 @@ RMTaskResourceRequirement::RMTaskResourceRequirement()
 	slaveRequirement = new RMResourceRequirement;
 	globalSlaveRequirement = new RMResourceRequirement;
 	sharedRequirement = new RMResourceRequirement;
+	hostSharedRequirement = new RMResourceRequirement;
 	nSlaveProcessNumber =
 	    INT_MAX - 1; // on enleve 1 pour que  nSlaveProcessNumber +1 = INT_MAX (= nb de proc sur le systeme)
 
@@ -29,6 +30,8 @@ RMTaskResourceRequirement::RMTaskResourceRequirement()
 	globalSlaveRequirement->GetMemory()->Set(0);
 	sharedRequirement->GetDisk()->Set(0);
 	sharedRequirement->GetMemory()->Set(0);
+	hostSharedRequirement->GetDisk()->Set(0);
+	hostSharedRequirement->GetMemory()->Set(0);
 
 	// Politiques d'allocation
 	ivResourcesPolicy.SetSize(RESOURCES_NUMBER);
@@ -58,6 +61,7 @@ RMTaskResourceRequirement::~RMTaskResourceRequirement()
 	delete slaveRequirement;
 	delete sharedRequirement;
 	delete globalSlaveRequirement;
+	delete hostSharedRequirement;
 }
 
 RMTaskResourceRequirement* RMTaskResourceRequirement::Clone() const
@@ -77,6 +81,7 @@ void RMTaskResourceRequirement::CopyFrom(const RMTaskResourceRequirement* trRequ
 	sharedRequirement->CopyFrom(trRequirement->GetSharedRequirement());
 	slaveRequirement->CopyFrom(trRequirement->GetSlaveRequirement());
 	globalSlaveRequirement->CopyFrom(trRequirement->GetGlobalSlaveRequirement());
+	hostSharedRequirement->CopyFrom(trRequirement->GetHostSharedRequirement());
 	nSlaveProcessNumber = trRequirement->GetMaxSlaveProcessNumber();
 
 	// Recopie des politiques
@@ -91,6 +96,7 @@ void RMTaskResourceRequirement::Write(ostream& ost) const
 	ost << "Master requirement: " << endl << *masterRequirement;
 	ost << "Shared variables requirement: " << endl << *sharedRequirement;
 	ost << "Slave global requirement: " << endl << *globalSlaveRequirement;
+	ost << "Host shared requirement: " << endl << *hostSharedRequirement;
 	ost << "Slave system at start: " << endl << slaveSystemAtStart;
 	ost << "Master system at start: " << endl << masterSystemAtStart;
 	ost << "Number of slaves processes: ";
@@ -115,6 +121,8 @@ void RMTaskResourceRequirement::WriteDetails(ostream& ost) const
 	sharedRequirement->WriteDetails(ost);
 	ost << "Slave global requirement: " << endl;
 	globalSlaveRequirement->WriteDetails(ost);
+	ost << "Host shared requirement: " << endl;
+	hostSharedRequirement->WriteDetails(ost);
 	ost << "Slave system at start: " << endl;
 	slaveSystemAtStart.WriteDetails(ost);
 	ost << "Master system at start: " << endl;
@@ -178,6 +186,11 @@ boolean RMTaskResourceRequirement::Check() const
 		AddError("Global slave requirements are not consistent");
 		bOk = false;
 	}
+	if (not hostSharedRequirement->Check())
+	{
+		AddError("Host shared requirements are not consistent");
+		bOk = false;
+	}
 	return bOk;
 }
 
@@ -244,6 +257,11 @@ RMResourceRequirement* RMTaskResourceRequirement::GetSharedRequirement() const
 	return sharedRequirement;
 }
 
+RMResourceRequirement* RMTaskResourceRequirement::GetHostSharedRequirement() const
+{
+	return hostSharedRequirement;
+}
+
 void RMTaskResourceRequirement::SetMaxSlaveProcessNumber(int nValue)
 {
 	require(nValue >= 0);
@@ -14,6 +14,7 @@
 //	- les exigences du maitre
 //  - les exigences partagees par le maitre et l'esclave
 //	- les exigences partagees par tous les esclaves
+//	- les exigences partagees par tous les processus d'une meme machine
 //	- une politique d'allocation de l'espace disque
 //	- une politique d'allocation de la memoire
 //  - un nombre maximum de taches elementaires (SlaveProcess)
@@ -112,6 +113,13 @@ public:
 	// moment donne en meme temps chez le maitre et chez l'esclave.
 	RMResourceRequirement* GetSharedRequirement() const;
 
+	// Acces aux exigences de la tache comptabilisees une seule fois par machine, quel que soit le nombre de
+	// processus qui y sont lances. Correspond aux donnees en lecture seule placees en memoire partagee
+	// par le maitre (cf. SharedMemoryCreate), et projetees par tous les esclaves de la meme machine.
+	// Seul le min est pris en compte : cette exigence n'est pas saturee par le gestionnaire de ressources.
+	// Par defaut a 0
+	RMResourceRequirement* GetHostSharedRequirement() const;
+
 	// Max des resources utilisees par les esclaves au lancement
 	static RMResourceRequirement* GetSlaveSystemAtStart();
 
@@ -140,6 +148,7 @@ public:
 	longint GetSharedMax(int nResourceType) const;
 	longint GetSlaveGlobalMin(int nResourceType) const;
 	longint GetSlaveGlobalMax(int nResourceType) const;
+	longint GetHostSharedMin(int nResourceType) const;
 
 	//////////////////////////////////////////////////////////////////
 	///// Implementation
@@ -161,6 +170,9 @@ protected:
 	// Exigences liees aux variables partagees
 	RMResourceRequirement* sharedRequirement;
 
+	// Exigences partagees par les processus d'une meme machine
+	RMResourceRequirement* hostSharedRequirement;
+
 	// Nombre de SlaveProcess maximum
 	int nSlaveProcessNumber;
 
@@ -211,6 +223,10 @@ inline longint RMTaskResourceRequirement::GetSlaveGlobalMax(int nResourceType) c
 {
 	return globalSlaveRequirement->GetResource(nResourceType)->GetMax();
 }
+inline longint RMTaskResourceRequirement::GetHostSharedMin(int nResourceType) const
+{
+	return hostSharedRequirement->GetResource(nResourceType)->GetMin();
+}
 
 inline RMResourceRequirement* RMTaskResourceRequirement::GetMasterSystemAtStart()
 {
@@ -8,6 +8,8 @@
 #include "KWProbabilityTable.h"
 #include "KWQuantileBuilder.h"
 #include "KWKey.h"
+#include "KWValueBlock.h"
+#include "KWQuantileSketch.h"
 
 #include "TestServices.h"
 
@@ -19,6 +21,11 @@ namespace
 KHIOPS_TEST(KWData, KWClass, KWClass::Test);
 KHIOPS_TEST(KWData, KWClassDomain, KWClassDomain::Test);
 KHIOPS_TEST(KWData, KWKey, KWKey::Test);
+KHIOPS_TEST(KWData, KWContinuousValueBlock, KWContinuousValueBlock::Test);
+KHIOPS_TEST(KWData, KWSymbolValueBlock, KWSymbolValueBlock::Test);
+
+// Librairie KWDataUtils
+KHIOPS_TEST(KWDataUtils, KWQuantileSketch, KWQuantileSketch::Test);
 
 // Librairie KWDataPreparation
 KHIOPS_TEST(KWDataPreparation, KWQuantileIntervalBuilder, KWQuantileIntervalBuilder::Test);
@@ -8,7 +8,9 @@
 #include "Ermgt.h"
 #include "ALString.h"
 #include "Object.h"
+#include "CompactNumericKeyDictionary.h"
 #include "SortedList.h"
+#include "IndexedHeap.h"
 #include "SystemResource.h"
 #include "CharVector.h"
 #include "InputBufferedFile.h"
@@ -30,10 +32,12 @@ KHIOPS_TEST(base, Timer, Timer::Test);
 KHIOPS_TEST(base, ObjectArray, ObjectArray::Test);
 KHIOPS_TEST(base, ObjectList, ObjectList::Test);
 KHIOPS_TEST(base, SortedList, SortedList::Test);
+KHIOPS_TEST(base, IndexedHeap, IndexedHeap::Test);
 KHIOPS_TEST(base, ObjectDictionary, ObjectDictionary::Test);
 KHIOPS_TEST(base, NumericKeyDictionary, NumericKeyDictionary::Test);
 KHIOPS_TEST(base, LongintDictionary, LongintDictionary::Test);
 KHIOPS_TEST(base, LongintNumericKeyDictionary, LongintNumericKeyDictionary::Test);
+KHIOPS_TEST(base, CompactNumericKeyDictionary, CompactNumericKeyDictionary::Test);
 KHIOPS_TEST(base, DoubleVector, DoubleVector::Test);
 KHIOPS_TEST(base, IntVector, IntVector::Test);
 KHIOPS_TEST(base, LongintVector, LongintVector::Test);